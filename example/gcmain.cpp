@@ -100,6 +100,9 @@ omr_main_entry(int argc, char ** argv, char **envp)
 				omrtty_printf("failed to add new root to root table!\n");
 			}
 			/* update entry if it already exists in table */
+			if (obj != entryInTable->rootPtr) {
+				OMR_GC_PreObjectStore(omrVMThread, entryInTable->rootPtr);
+			}
 			entryInTable->rootPtr = obj;
 			allocatedCount++;
 		} else {
@@ -77,8 +77,15 @@ public:
 	void
 	verifyHeap(MM_EnvironmentBase *env, MM_MarkMap *markMap) { }
 
+	/**
+	 * Update the root table, the object table and the threads' saved objects to the new addresses
+	 * of the objects they refer to.
+	 *
+	 * @param env[in] the current thread
+	 * @param compactScheme[in] the compact scheme answering the new addresses
+	 */
 	void
-	fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme) { }
+	fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme);
 
 	void
 	workerCleanupAfterGC(MM_EnvironmentBase *env) { }
@@ -87,9 +94,9 @@ public:
 	mainSetupForGC(MM_EnvironmentBase *env) { }
 
 	MM_CompactDelegate()
-		: _compactScheme(NULL)
+		: _omrVM(NULL)
+		, _compactScheme(NULL)
 		, _markMap(NULL)
-		, _omrVM(NULL)
 	{}
 };
 
@@ -21,23 +21,30 @@
 
 #include "omr.h"
 #include "objectdescription.h"
+#include "ModronAssertions.h"
 
 #include "CompactSchemeFixupObject.hpp"
 #include "EnvironmentStandard.hpp"
+#include "ObjectIterator.hpp"
 
 #if defined(OMR_GC_MODRON_COMPACTION)
 
 void
 MM_CompactSchemeFixupObject::fixupObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
 {
-#error provide an implementation to fix objects during a compact
+	GC_ObjectIterator objectIterator(_omrVM, objectPtr);
+	GC_SlotObject *slotObject = NULL;
+	while (NULL != (slotObject = objectIterator.nextSlot())) {
+		_compactScheme->fixupObjectSlot(slotObject);
+	}
 }
 
 
 void
 MM_CompactSchemeFixupObject::verifyForwardingPtr(omrobjectptr_t objectPtr, omrobjectptr_t forwardingPtr)
 {
-#error provide an implementation to verify objects after a compact is complete
+	/* compaction only ever slides objects towards the base of the heap */
+	Assert_MM_true(forwardingPtr <= objectPtr);
 }
 
 #endif /* OMR_GC_MODRON_COMPACTION */
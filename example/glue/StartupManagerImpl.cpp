@@ -36,6 +36,14 @@
 #if defined(OMR_GC_SEGREGATED_HEAP)
 #define OMR_SEGREGATEDHEAP "-Xgcpolicy:segregated"
 #define OMR_SEGREGATEDHEAP_LENGTH 21
+#define OMR_BACKGROUNDSWEEP "-Xgc:backgroundSweep"
+#define OMR_BACKGROUNDSWEEP_LENGTH 20
+#define OMR_ALLOCATIONCACHEMAGAZINESIZE "-Xgc:allocationCacheMagazineSize="
+#define OMR_ALLOCATIONCACHEMAGAZINESIZE_LENGTH 33
+#define OMR_SIZECLASSHISTOGRAM "-Xgc:sizeClassHistogram"
+#define OMR_SIZECLASSHISTOGRAM_LENGTH 23
+#define OMR_SIZECLASSES "-Xgc:sizeClasses="
+#define OMR_SIZECLASSES_LENGTH 17
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 bool
@@ -51,6 +59,24 @@ MM_StartupManagerImpl::handleOption(MM_GCExtensionsBase *extensions, char *optio
 			 */
 			_useSegregatedGC = true;
 			result = true;
+		} else if (0 == strncmp(option, OMR_BACKGROUNDSWEEP, OMR_BACKGROUNDSWEEP_LENGTH)) {
+			extensions->backgroundSweep = true;
+			result = true;
+		} else if (0 == strncmp(option, OMR_ALLOCATIONCACHEMAGAZINESIZE, OMR_ALLOCATIONCACHEMAGAZINESIZE_LENGTH)) {
+			result = (0 < getUDATAValue(option + OMR_ALLOCATIONCACHEMAGAZINESIZE_LENGTH, &extensions->allocationCacheMagazineSize));
+		} else if (0 == strncmp(option, OMR_SIZECLASSHISTOGRAM, OMR_SIZECLASSHISTOGRAM_LENGTH)) {
+			extensions->sizeClassHistogram = true;
+			result = true;
+		} else if (0 == strncmp(option, OMR_SIZECLASSES, OMR_SIZECLASSES_LENGTH)) {
+			/* comma separated cell size of every small size class, as reported by -Xgc:sizeClassHistogram */
+			char *cellSize = option + OMR_SIZECLASSES_LENGTH;
+			result = true;
+			for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; result && (sizeClass <= OMR_SIZECLASSES_MAX_SMALL); sizeClass++) {
+				uintptr_t digits = getUDATAValue(cellSize, &extensions->sizeClassCellSizes[sizeClass]);
+				char separator = (OMR_SIZECLASSES_MAX_SMALL == sizeClass) ? '\0' : ',';
+				result = (0 < digits) && (separator == cellSize[digits]);
+				cellSize += digits + 1;
+			}
 		}
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 	}
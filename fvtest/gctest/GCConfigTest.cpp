@@ -28,6 +28,7 @@
 #include "omrgc.h"
 #include "SlotObject.hpp"
 #include "StandardWriteBarrier.hpp"
+#include "VerboseBinaryFormat.hpp"
 #include "VerboseWriterChain.hpp"
 
 //#define OMRGCTEST_PRINTFILE
@@ -43,12 +44,31 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_lazy_sweep_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_adaptive_tlh_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_free_list_size_index_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_binary_logging_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_mapped_logging_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_lock_free_work_packets_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_overflow_spill_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_overflow_spill_tiny_config.xml"
+#if defined(OMR_GC_MODRON_COMPACTION)
+                        , "fvtest/gctest/configuration/global_GC_compact_summary_table_config.xml"
+#endif
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_kickoff_forecast_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_numa_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_worksteal_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_adaptive_cache_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_remset_chunk_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_tenure_occupancy_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_pause_target_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_dispatcher_spin_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
@@ -57,7 +77,12 @@ const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         };
 
 const char *perfTests[] = {"perftest/gctest/configuration/21645_core.20150126.202455.11862202.0001.xml",
-								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"};
+								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"
+#if defined(OMR_GC_MODRON_SCAVENGER)
+								, "perftest/gctest/configuration/scavenger_slot_batch_off.xml"
+								, "perftest/gctest/configuration/scavenger_slot_batch_on.xml"
+#endif
+								};
 void
 GCConfigTest::SetUp()
 {
@@ -809,6 +834,23 @@ printFile(const char *name)
 }
 #endif
 
+pugi::xml_parse_result
+GCConfigTest::loadVerboseLog(pugi::xml_document *verboseDoc, const char *fileName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	if (env->getExtensions()->binaryLogging) {
+		/* convert the binary log back to the XML the other writers produce */
+		uintptr_t length = 0;
+		char *text = MM_VerboseBinaryFormat::readAsXML(gcTestEnv->portLib, fileName, &length);
+		if (NULL != text) {
+			pugi::xml_parse_result result = verboseDoc->load_buffer(text, length);
+			omrmem_free_memory(text);
+			return result;
+		}
+	}
+	return verboseDoc->load_file(fileName);
+}
+
 int32_t
 GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 {
@@ -830,7 +872,7 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 	do {
 		pugi::xml_document verboseDoc;
 		if (0 == numOfFiles) {
-			verboseDoc.load_file(verboseFile);
+			loadVerboseLog(&verboseDoc, verboseFile);
 			gcTestEnv->log("Parsing verbose log %s:\n", verboseFile);
 #if defined(OMRGCTEST_PRINTFILE)
 			printFile(verboseFile);
@@ -838,7 +880,7 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 		} else {
 			char currentVerboseFile[MAX_NAME_LENGTH];
 			omrstr_printf(currentVerboseFile, MAX_NAME_LENGTH, "%s.%03zu", verboseFile, seq++);
-			pugi::xml_parse_result result = verboseDoc.load_file(currentVerboseFile);
+			pugi::xml_parse_result result = loadVerboseLog(&verboseDoc, currentVerboseFile);
 			if (pugi::status_file_not_found == result.status) {
 				break;
 			}
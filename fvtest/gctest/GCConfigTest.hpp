@@ -107,6 +107,7 @@ protected:
 #if defined(OMRGCTEST_PRINTFILE)
 	void printFile(const char *name);
 #endif
+	pugi::xml_parse_result loadVerboseLog(pugi::xml_document *verboseDoc, const char *fileName);
 	int32_t verifyVerboseGC(pugi::xpath_node_set verboseGCs);
 	int32_t parseGarbagePolicy(pugi::xml_node node);
 	int32_t triggerOperation(pugi::xml_node node);
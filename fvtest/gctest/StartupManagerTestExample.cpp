@@ -37,7 +37,7 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 		/* parse options */
 		pugi::xpath_node option = doc.select_node("/gc-config/option");
 
-		int32_t unitSize = 1;
+		uintptr_t unitSize = 1;
 		const char *unit = option.node().attribute("sizeUnit").value();
 		if (0 != strcmp(unit, "")) {
 			if (0 == j9_cmdla_stricmp(unit, "B")) {
@@ -83,7 +83,10 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountForced = true;
+				} else if (0 == strcmp(attr.name(), "dispatcherWorkerSpinCount")) {
+					extensions->dispatcherWorkerSpinCount = atoi(attr.value());
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -91,8 +94,12 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=gencon ignored, requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "segregated")) {
+						_useSegregatedGC = true;
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 					} else  if (0 != j9_cmdla_stricmp(attr.value(), "optavgpause")) {
-						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon or optavgpause): %s\n", attr.value());
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon, optavgpause or segregated): %s\n", attr.value());
 						result = false;
 					}
 				} else if (0 == strcmp(attr.name(), "concurrentMark")) {
@@ -101,11 +108,81 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+				} else if (0 == strcmp(attr.name(), "concurrentKickoffForecast")) {
+					extensions->concurrentKickoffForecast = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "concurrentKickoffForecastMargin")) {
+					extensions->concurrentKickoffForecastMargin = atoi(attr.value()) * unitSize;
+#if defined(OMR_GC_REALTIME)
+				} else if (0 == strcmp(attr.name(), "snapshotAtTheBeginningBarrier")) {
+					extensions->configurationOptions._forceOptionWriteBarrierSATB = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "sATBBarrierBufferSize")) {
+					extensions->sATBBarrierBufferSize = atoi(attr.value());
+#endif /* defined(OMR_GC_REALTIME) */
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_MODRON_COMPACTION)
+				} else if (0 == strcmp(attr.name(), "compactOnGlobalGC")) {
+					/* compaction is disabled by default, so forcing it must lift that too */
+					extensions->compactOnGlobalGC = (0 == j9_cmdla_stricmp(attr.value(), "true")) ? 1 : 0;
+					extensions->noCompactOnGlobalGC = (0 == extensions->compactOnGlobalGC) ? 1 : 0;
+				} else if (0 == strcmp(attr.name(), "compactUsingSummaryTable")) {
+					extensions->compactUsingSummaryTable = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+				} else if (0 == strcmp(attr.name(), "backgroundSweep")) {
+					extensions->backgroundSweep = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "allocationCacheMagazineSize")) {
+					extensions->allocationCacheMagazineSize = atoi(attr.value());
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+				} else if (0 == strcmp(attr.name(), "lazySweep")) {
+					extensions->lazySweep = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveSizing")) {
+					extensions->tlhAdaptiveSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "freeListSizeIndex")) {
+					extensions->freeListSizeIndex = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "binaryLogging")) {
+					extensions->binaryLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "mappedLogging")) {
+					extensions->mappedLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "mappedLogFileSize")) {
+					extensions->mappedLogFileSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "deferredHeapDecommit")) {
+					extensions->deferredHeapDecommit = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "heapDecommitLazyFree")) {
+					extensions->heapDecommitLazyFree = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "heapDecommitBatchSize")) {
+					extensions->heapDecommitBatchSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "heapPrecommit")) {
+					extensions->heapPrecommit = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "workPacketLockFreeLists")) {
+					extensions->workPacketLockFreeLists = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "workPacketCache")) {
+					extensions->workPacketCache = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "workpacketCount")) {
+					extensions->workpacketCount = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "workPacketOverflowSpillSize")) {
+					extensions->workPacketOverflowSpillSize = atoi(attr.value()) * unitSize;
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerNumaAwareCopy")) {
+					extensions->scavengerNumaAwareCopy = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerWorkStealing")) {
+					extensions->scavengerWorkStealing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerSlotBatchSize")) {
+					extensions->scavengerSlotBatchSize = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerAdaptiveCacheSize")) {
+					extensions->scavengerAdaptiveCacheSize = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerAdaptiveCacheSizeStallThreshold")) {
+					extensions->scavengerAdaptiveCacheSizeStallThreshold = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerPauseTarget")) {
+					extensions->scavengerPauseTarget = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerRememberedSetChunkSize")) {
+					extensions->scavengerRememberedSetChunkSize = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scvTenureAdaptiveSurvivorOccupancy")) {
+					extensions->scvTenureAdaptiveSurvivorOccupancy = atof(attr.value());
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "SegregatedGC.hpp"
+#include "SweepSchemeSegregated.hpp"
+#include "gcTestHelpers.hpp"
+#include "omrgc.h"
+#include "sizeclasses.h"
+
+#include <gtest/gtest.h>
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/* Number of GCs to allocate through before letting the background sweeper catch up */
+#define GC_COUNT 2
+/* Bound on the allocation, as a multiple of the heap size, in case GCs are not triggered */
+#define ALLOCATION_HEAP_MULTIPLE 16
+/* How long to give the background sweeper to reach the regions left by the last GC */
+#define BACKGROUND_SWEEP_TIMEOUT_MS 10000
+
+/**
+ * Allocate garbage of every small size class on a segregated heap with background sweep, so that each GC leaves
+ * its small regions to the background sweeper. Once allocation stops the sweeper must get through the regions
+ * left by the last GC on its own, and must then exit when the collector shuts down.
+ */
+TEST(TestBackgroundSweep, sweepAndShutdown)
+{
+	OMR_VM_Example *exampleVM = &gcTestEnv->exampleVM;
+	ASSERT_EQ(OMR_ERROR_NONE, gcTestEnv->GCHeapSetUp("fvtest/gctest/configuration/segregated_GC_background_sweep_config.xml"));
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	ASSERT_TRUE(extensions->isSegregatedHeap());
+	ASSERT_TRUE(extensions->backgroundSweep);
+	MM_SweepSchemeSegregated *sweepScheme = ((MM_SegregatedGC *)extensions->getGlobalCollector())->getSweepScheme();
+	ASSERT_FALSE(sweepScheme->isBackgroundSweepTerminated());
+
+	/* nothing is kept alive, but the example glue walks both tables in every collection */
+	exampleVM->rootTable = hashTableNew(
+			exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(RootEntry), 0, 0, OMRMEM_CATEGORY_MM,
+			rootTableHashFn, rootTableHashEqualFn, NULL, NULL);
+	exampleVM->objectTable = hashTableNew(
+			exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(ObjectEntry), 0, 0, OMRMEM_CATEGORY_MM,
+			objectTableHashFn, objectTableHashEqualFn, NULL, NULL);
+	ASSERT_TRUE((NULL != exampleVM->rootTable) && (NULL != exampleVM->objectTable));
+
+	static const uintptr_t cellSizes[] = SMALL_SIZECLASSES;
+	uintptr_t gcCount = extensions->globalGCStats.gcCount;
+	uintptr_t allocationTarget = extensions->heap->getActiveMemorySize() * ALLOCATION_HEAP_MULTIPLE;
+	uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL;
+	/* stop as soon as a GC has queued regions, so that allocation sweeps as few of them as possible */
+	for (uintptr_t allocated = 0; ((extensions->globalGCStats.gcCount - gcCount) < GC_COUNT) && (allocated < allocationTarget); allocated += cellSizes[sizeClass]) {
+		sizeClass = OMR_SIZECLASSES_MIN_SMALL + ((allocated / 64) % OMR_SIZECLASSES_NUM_SMALL);
+		MM_ObjectAllocationModel withGc(env, cellSizes[sizeClass], 0);
+		ASSERT_TRUE(NULL != OMR_GC_AllocateObject(exampleVM->_omrVMThread, &withGc)) << "after " << allocated << " bytes";
+	}
+	ASSERT_EQ(gcCount + GC_COUNT, extensions->globalGCStats.gcCount) << "no GC left regions to the background sweeper";
+	uintptr_t queuedRegions = extensions->globalGCStats.sweepStats._backgroundSweepRegions;
+	ASSERT_LT((uintptr_t)0, queuedRegions);
+
+	/* with nothing allocating, the sweeper finishes the regions the last GC left it */
+	for (uintptr_t waited = 0; sweepScheme->isBackgroundSweepActive() && (waited < BACKGROUND_SWEEP_TIMEOUT_MS); waited++) {
+		omrthread_sleep(1);
+	}
+	EXPECT_FALSE(sweepScheme->isBackgroundSweepActive());
+	EXPECT_LT((uintptr_t)0, sweepScheme->getBackgroundSweptRegions());
+	EXPECT_GE(queuedRegions, sweepScheme->getBackgroundSweptRegions());
+	gcTestEnv->log("background sweep: gcs=%zu queued=%zu swept=%zu\n",
+			extensions->globalGCStats.gcCount - gcCount, queuedRegions, sweepScheme->getBackgroundSweptRegions());
+
+	/* the collector stops the sweeper on shutdown; stopping it here as well must be harmless */
+	sweepScheme->shutdownBackgroundSweep();
+	EXPECT_TRUE(sweepScheme->isBackgroundSweepTerminated());
+
+	hashTableFree(exampleVM->rootTable);
+	exampleVM->rootTable = NULL;
+	hashTableFree(exampleVM->objectTable);
+	exampleVM->objectTable = NULL;
+	gcTestEnv->GCHeapTearDown();
+}
+
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
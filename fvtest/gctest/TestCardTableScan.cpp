@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "CardTable.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+#include <string.h>
+
+/* Cards for a 32GB heap with 512 byte cards */
+#define BENCHMARK_CARD_COUNT ((uintptr_t)64 * 1024 * 1024)
+
+static Card *
+referenceNextNonCleanCard(Card *card, Card *endCard)
+{
+	while ((card < endCard) && (CARD_CLEAN == *card)) {
+		card += 1;
+	}
+	return card;
+}
+
+static Card *
+slotNextNonCleanCard(Card *card, Card *endCard)
+{
+	/* The uintptr_t at a time scan the card cleaning loops used before vector scanning */
+	while ((card < endCard) && (CARD_CLEAN == *card)) {
+		if (0 == ((uintptr_t)card % sizeof(uintptr_t))) {
+			uintptr_t *slot = (uintptr_t *)card;
+			uintptr_t *lastSlot = (uintptr_t *)((uintptr_t)endCard & ~(sizeof(uintptr_t) - 1));
+			while ((slot < lastSlot) && (0 == *slot)) {
+				slot += 1;
+			}
+			card = (Card *)slot;
+			if ((card >= endCard) || (CARD_CLEAN != *card)) {
+				break;
+			}
+		}
+		card += 1;
+	}
+	return card;
+}
+
+TEST(TestCardTableScan, findNextNonCleanCard)
+{
+	Card cards[256];
+
+	for (uintptr_t start = 0; start < 64; start++) {
+		for (uintptr_t end = start; end < 256; end += 7) {
+			/* all clean */
+			memset(cards, CARD_CLEAN, sizeof(cards));
+			EXPECT_EQ(cards + end, MM_CardTable::findNextNonCleanCard(cards + start, cards + end));
+
+			/* one dirty card anywhere in (or around) the range */
+			for (uintptr_t dirty = 0; dirty < 256; dirty += 3) {
+				memset(cards, CARD_CLEAN, sizeof(cards));
+				cards[dirty] = CARD_DIRTY;
+				EXPECT_EQ(referenceNextNonCleanCard(cards + start, cards + end), MM_CardTable::findNextNonCleanCard(cards + start, cards + end));
+			}
+		}
+	}
+}
+
+TEST(TestCardTableScan, clearCards)
+{
+	Card cards[1024];
+
+	for (uintptr_t start = 0; start < 64; start += 5) {
+		for (uintptr_t end = 1024 - 64; end < 1024; end += 11) {
+			memset(cards, CARD_DIRTY, sizeof(cards));
+			for (uintptr_t i = start; i < end; i += 97) {
+				cards[i] = CARD_CLEAN;
+			}
+			MM_CardTable::clearCards(cards + start, cards + end);
+			for (uintptr_t i = 0; i < 1024; i++) {
+				ASSERT_EQ(((i < start) || (i >= end)) ? CARD_DIRTY : CARD_CLEAN, cards[i]) << "start=" << start << " end=" << end << " i=" << i;
+			}
+		}
+	}
+}
+
+/**
+ * Time a walk over every non-clean card of a large card table, at various densities of dirty cards,
+ * with the byte at a time, uintptr_t at a time and vector scans.
+ */
+TEST(perfTestCardTableScan, density)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	const double densities[] = {0.0, 0.0001, 0.001, 0.01, 0.1, 0.5};
+	typedef Card *(*ScanFunction)(Card *card, Card *endCard);
+	const ScanFunction scans[] = {referenceNextNonCleanCard, slotNextNonCleanCard, MM_CardTable::findNextNonCleanCard};
+	const char *scanNames[] = {"byte", "uintptr_t", "vector"};
+
+	Card *cards = (Card *)omrmem_allocate_memory(BENCHMARK_CARD_COUNT, OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != cards);
+	Card *endCard = cards + BENCHMARK_CARD_COUNT;
+
+	for (uintptr_t d = 0; d < sizeof(densities) / sizeof(densities[0]); d++) {
+		/* scatter dirty cards with a fixed seed so each run sees the same table */
+		uint32_t seed = 12345;
+		uint32_t threshold = (uint32_t)(densities[d] * (double)0xFFFFFFFFu);
+		uintptr_t expectedCount = 0;
+		for (uintptr_t i = 0; i < BENCHMARK_CARD_COUNT; i++) {
+			seed = (seed * 1103515245u) + 12345u;
+			if ((0 != threshold) && (seed <= threshold)) {
+				cards[i] = CARD_DIRTY;
+				expectedCount += 1;
+			} else {
+				cards[i] = CARD_CLEAN;
+			}
+		}
+
+		for (uintptr_t s = 0; s < sizeof(scans) / sizeof(scans[0]); s++) {
+			uintptr_t count = 0;
+			uint64_t startTime = omrtime_hires_clock();
+			Card *card = scans[s](cards, endCard);
+			while (card < endCard) {
+				count += 1;
+				card = scans[s](card + 1, endCard);
+			}
+			uint64_t elapsed = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			EXPECT_EQ(expectedCount, count) << scanNames[s] << " scan at density " << densities[d];
+			gcTestEnv->log("card scan: cards=%zu density=%.4f dirty=%zu scan=%s time=%llu us\n",
+					BENCHMARK_CARD_COUNT, densities[d], count, scanNames[s], elapsed);
+		}
+	}
+
+	omrmem_free_memory(cards);
+}
@@ -0,0 +1,269 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#include "CellMagazine.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "ObjectAllocationInterface.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "gcTestHelpers.hpp"
+#include "omrgc.h"
+#include "sizeclasses.h"
+
+#include <gtest/gtest.h>
+#include <string.h>
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/* Allocation rounds per configuration and thread count, with a GC emptying the heap between rounds */
+#define BENCHMARK_ROUNDS 4
+/* Fraction of the heap allocated by all threads together in each round */
+#define BENCHMARK_HEAP_FRACTION 2
+
+static const uintptr_t benchmarkCellSizes[] = SMALL_SIZECLASSES;
+
+struct BenchmarkThread {
+	OMR_VM *omrVM;
+	uint32_t seed;
+	uintptr_t allocationBudget; /**< bytes to allocate, without triggering a GC */
+	uintptr_t allocatedBytes;
+	uintptr_t allocationCount;
+	uint64_t startTime;
+	uint64_t endTime;
+	omrthread_t handle;
+};
+
+/**
+ * Attach as a mutator and allocate mixed small sizes until the budget is spent. Allocation does not GC, so
+ * that the threads can run without coordinating VM access; the main thread collects between rounds.
+ */
+static int J9THREAD_PROC
+allocatingThread(void *arg)
+{
+	BenchmarkThread *thread = (BenchmarkThread *)arg;
+	OMR_VMThread *omrVMThread = NULL;
+
+	if (OMR_ERROR_NONE == OMR_Thread_Init(thread->omrVM, NULL, &omrVMThread, "perfTestCellMagazine")) {
+		OMRPORT_ACCESS_FROM_OMRVM(thread->omrVM);
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+		uint32_t seed = thread->seed;
+
+		thread->startTime = omrtime_hires_clock();
+		while (thread->allocatedBytes < thread->allocationBudget) {
+			/* mixed small sizes, skewed towards the smaller size classes */
+			seed = (seed * 1103515245u) + 12345u;
+			uintptr_t first = (seed >> 16) % OMR_SIZECLASSES_NUM_SMALL;
+			seed = (seed * 1103515245u) + 12345u;
+			uintptr_t second = (seed >> 16) % OMR_SIZECLASSES_NUM_SMALL;
+			uintptr_t cellSize = benchmarkCellSizes[OMR_SIZECLASSES_MIN_SMALL + OMR_MIN(first, second)];
+
+			MM_ObjectAllocationModel noGc(env, cellSize, OMR_GC_ALLOCATE_OBJECT_NO_GC);
+			if (NULL == OMR_GC_AllocateObject(omrVMThread, &noGc)) {
+				break;
+			}
+			thread->allocatedBytes += cellSize;
+			thread->allocationCount += 1;
+		}
+		thread->endTime = omrtime_hires_clock();
+
+		/* hand back the unused cells, as a runtime does when a thread exits */
+		env->_objectAllocationInterface->flushCache(env);
+		OMR_Thread_Free(omrVMThread);
+	}
+	return 0;
+}
+
+TEST(TestCellMagazine, magazine)
+{
+	uintptr_t cells[OMR_SEGREGATED_MAGAZINE_CAPACITY];
+	MM_CellMagazine magazine;
+	MM_CellMagazine other;
+	uintptr_t size = 0;
+
+	EXPECT_TRUE(magazine.isEmpty());
+	EXPECT_TRUE(NULL == magazine.pop(&size));
+	for (uintptr_t i = 0; i < OMR_SEGREGATED_MAGAZINE_CAPACITY; i++) {
+		EXPECT_TRUE(magazine.push(&cells[i], i + 1));
+	}
+	EXPECT_FALSE(magazine.push(&cells[0], 1));
+	EXPECT_EQ((uintptr_t)OMR_SEGREGATED_MAGAZINE_CAPACITY, magazine.getCount());
+
+	/* ranges come out in the order they went in */
+	EXPECT_EQ(&cells[0], magazine.pop(&size));
+	EXPECT_EQ((uintptr_t)1, size);
+	EXPECT_EQ(&cells[1], magazine.getCells(0));
+	EXPECT_EQ((uintptr_t)2, magazine.getSize(0));
+
+	other.takeAll(&magazine);
+	EXPECT_TRUE(magazine.isEmpty());
+	EXPECT_EQ((uintptr_t)OMR_SEGREGATED_MAGAZINE_CAPACITY - 1, other.getCount());
+	for (uintptr_t i = 1; i < OMR_SEGREGATED_MAGAZINE_CAPACITY; i++) {
+		EXPECT_EQ(&cells[i], other.pop(&size));
+		EXPECT_EQ(i + 1, size);
+	}
+	EXPECT_TRUE(other.isEmpty());
+
+	/* an emptied magazine can be filled to capacity again */
+	for (uintptr_t i = 0; i < OMR_SEGREGATED_MAGAZINE_CAPACITY; i++) {
+		EXPECT_TRUE(other.push(&cells[i], sizeof(uintptr_t)));
+	}
+}
+
+TEST(TestCellMagazine, flush)
+{
+	uintptr_t cells[64];
+	MM_CellMagazine magazine;
+	uintptr_t size = 0;
+
+	memset(cells, 0xFF, sizeof(cells));
+	EXPECT_TRUE(magazine.push(&cells[0], 16 * sizeof(uintptr_t)));
+	EXPECT_TRUE(magazine.push(&cells[16], 16 * sizeof(uintptr_t)));
+	EXPECT_TRUE(magazine.push(&cells[32], 32 * sizeof(uintptr_t)));
+	EXPECT_EQ(&cells[0], magazine.pop(&size));
+
+	/* only the ranges left in the magazine are turned into holes */
+	magazine.flush(false);
+	EXPECT_TRUE(magazine.isEmpty());
+	EXPECT_EQ((uintptr_t)-1, cells[0]);
+	EXPECT_EQ(16 * sizeof(uintptr_t), ((MM_HeapLinkedFreeHeader *)&cells[16])->getSize());
+	EXPECT_EQ(32 * sizeof(uintptr_t), ((MM_HeapLinkedFreeHeader *)&cells[32])->getSize());
+}
+
+TEST(TestCellMagazine, depot)
+{
+	uintptr_t cells[OMR_SEGREGATED_DEPOT_CAPACITY + 1];
+	MM_CellMagazineDepot depot;
+	MM_CellMagazine magazine;
+	uintptr_t size = 0;
+
+	EXPECT_TRUE(depot.isEmpty());
+	EXPECT_FALSE(depot.get(&magazine));
+	for (uintptr_t i = 0; i < OMR_SEGREGATED_DEPOT_CAPACITY; i++) {
+		magazine.push(&cells[i], sizeof(uintptr_t));
+		EXPECT_TRUE(depot.put(&magazine));
+		EXPECT_TRUE(magazine.isEmpty());
+	}
+	EXPECT_TRUE(depot.isFull());
+
+	/* a full depot leaves the magazine alone */
+	magazine.push(&cells[OMR_SEGREGATED_DEPOT_CAPACITY], sizeof(uintptr_t));
+	EXPECT_FALSE(depot.put(&magazine));
+	EXPECT_EQ((uintptr_t)1, magazine.getCount());
+	magazine.pop(&size);
+
+	for (uintptr_t i = OMR_SEGREGATED_DEPOT_CAPACITY; i > 0; i--) {
+		EXPECT_TRUE(depot.get(&magazine));
+		EXPECT_EQ(&cells[i - 1], magazine.pop(&size));
+		EXPECT_TRUE(magazine.isEmpty());
+	}
+	EXPECT_TRUE(depot.isEmpty());
+}
+
+/**
+ * Time many mutator threads allocating mixed small sizes on a segregated heap, with allocation caches
+ * replenished one locked carve at a time and from magazines.
+ */
+TEST(perfTestCellMagazine, allocationRate)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	const char *configs[] = {
+		"fvtest/gctest/configuration/segregated_GC_magazine_off_config.xml",
+		"fvtest/gctest/configuration/segregated_GC_magazine_on_config.xml"
+	};
+	const uintptr_t threadCounts[] = {1, 2, 4, 8, 16, 32, 64};
+	const uintptr_t threadCountCount = sizeof(threadCounts) / sizeof(threadCounts[0]);
+	OMR_VM_Example *exampleVM = &gcTestEnv->exampleVM;
+
+	BenchmarkThread *threads = (BenchmarkThread *)omrmem_allocate_memory(sizeof(BenchmarkThread) * threadCounts[threadCountCount - 1], OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != threads);
+
+	for (uintptr_t c = 0; c < sizeof(configs) / sizeof(configs[0]); c++) {
+		ASSERT_EQ(OMR_ERROR_NONE, gcTestEnv->GCHeapSetUp(configs[c]));
+		MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(exampleVM->_omrVM);
+		ASSERT_TRUE(extensions->isSegregatedHeap());
+		/* nothing is kept alive, but the example glue walks both tables in every collection */
+		exampleVM->rootTable = hashTableNew(
+				exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(RootEntry), 0, 0, OMRMEM_CATEGORY_MM,
+				rootTableHashFn, rootTableHashEqualFn, NULL, NULL);
+		exampleVM->objectTable = hashTableNew(
+				exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(ObjectEntry), 0, 0, OMRMEM_CATEGORY_MM,
+				objectTableHashFn, objectTableHashEqualFn, NULL, NULL);
+		ASSERT_TRUE((NULL != exampleVM->rootTable) && (NULL != exampleVM->objectTable));
+		uintptr_t roundBytes = extensions->heap->getActiveMemorySize() / BENCHMARK_HEAP_FRACTION;
+
+		for (uintptr_t t = 0; t < threadCountCount; t++) {
+			uintptr_t threadCount = threadCounts[t];
+			uintptr_t allocatedBytes = 0;
+			uintptr_t allocationCount = 0;
+			uint64_t elapsed = 0;
+
+			for (uintptr_t round = 0; round < BENCHMARK_ROUNDS; round++) {
+				ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, 0));
+
+				omrthread_attr_t attr = NULL;
+				ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+				ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+				for (uintptr_t i = 0; i < threadCount; i++) {
+					memset(&threads[i], 0, sizeof(BenchmarkThread));
+					threads[i].omrVM = exampleVM->_omrVM;
+					threads[i].seed = (uint32_t)(12345 + (round * threadCount) + i);
+					threads[i].allocationBudget = roundBytes / threadCount;
+					ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&threads[i].handle, &attr, 0, allocatingThread, &threads[i]));
+				}
+				uint64_t startTime = 0;
+				uint64_t endTime = 0;
+				for (uintptr_t i = 0; i < threadCount; i++) {
+					EXPECT_EQ(J9THREAD_SUCCESS, omrthread_join(threads[i].handle));
+					EXPECT_LE(threads[i].allocationBudget, threads[i].allocatedBytes) << configs[c] << " threads " << threadCount;
+					allocatedBytes += threads[i].allocatedBytes;
+					allocationCount += threads[i].allocationCount;
+					/* from the first thread starting to allocate to the last one finishing, leaving out attach and detach */
+					if ((0 == startTime) || (threads[i].startTime < startTime)) {
+						startTime = threads[i].startTime;
+					}
+					if (threads[i].endTime > endTime) {
+						endTime = threads[i].endTime;
+					}
+				}
+				omrthread_attr_destroy(&attr);
+				elapsed += omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			}
+
+			gcTestEnv->log("segregated allocation: threads=%zu magazine=%zu allocations=%zu bytes=%zu time=%llu us (%.1f Mallocs/s)\n",
+					threadCount, extensions->allocationCacheMagazineSize, allocationCount, allocatedBytes, elapsed,
+					(0 == elapsed) ? 0.0 : ((double)allocationCount / (double)elapsed));
+		}
+
+		hashTableFree(exampleVM->rootTable);
+		exampleVM->rootTable = NULL;
+		hashTableFree(exampleVM->objectTable);
+		exampleVM->objectTable = NULL;
+		gcTestEnv->GCHeapTearDown();
+	}
+
+	omrmem_free_memory(threads);
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
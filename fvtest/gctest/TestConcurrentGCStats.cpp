@@ -0,0 +1,60 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+
+#include "ConcurrentGCStats.hpp"
+
+#include <gtest/gtest.h>
+
+/**
+ * Completed modes are kept as one bit per mode, so root tracing only counts as complete once
+ * CONCURRENT_ROOT_TRACING itself has been completed, whatever other modes have completed with it.
+ */
+TEST(TestConcurrentGCStats, rootTracingComplete)
+{
+	MM_ConcurrentGCStats stats;
+	EXPECT_FALSE(stats.isRootTracingComplete());
+
+	/* the modes before root tracing, including CONCURRENT_INIT_RUNNING whose bit has the value of CONCURRENT_ROOT_TRACING */
+	stats.setModeComplete(CONCURRENT_INIT_RUNNING);
+	stats.setModeComplete(CONCURRENT_INIT_COMPLETE);
+	EXPECT_FALSE(stats.isRootTracingComplete());
+
+	/* a client language mode after root tracing */
+	stats.setModeComplete((ConcurrentStatus)(CONCURRENT_ROOT_TRACING + 1));
+	EXPECT_FALSE(stats.isRootTracingComplete());
+
+	stats.setModeComplete(CONCURRENT_ROOT_TRACING);
+	EXPECT_TRUE(stats.isRootTracingComplete());
+
+	/* completing it again, or another mode, leaves it complete until the next cycle */
+	stats.setModeComplete(CONCURRENT_ROOT_TRACING);
+	stats.setModeComplete(CONCURRENT_TRACE_ONLY);
+	EXPECT_TRUE(stats.isRootTracingComplete());
+	stats.reset();
+	EXPECT_FALSE(stats.isRootTracingComplete());
+}
+
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
@@ -0,0 +1,114 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "VerboseManager.hpp"
+#include "gcTestHelpers.hpp"
+#include "omrgc.h"
+#include "pugixml.hpp"
+
+#include <gtest/gtest.h>
+
+/* Size of each garbage object, small enough to be allocated from a TLH so each refresh pays the concurrent tax */
+#define GARBAGE_OBJECT_SIZE ((uintptr_t)1024)
+/* Total allocated, as a multiple of the heap size, giving room for several concurrent cycles */
+#define ALLOCATION_HEAP_MULTIPLE 4
+
+/**
+ * Allocate garbage with collection allowed, as a mutator at a safe point would, so that a concurrent
+ * cycle is kicked off on the forecast, traced by the allocation tax and completed by a final collection.
+ * Both the forecast logged at kickoff and its outcome logged with the final collection must be present.
+ */
+TEST(TestConcurrentKickoffForecast, forecastOutcome)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	OMR_VM_Example *exampleVM = &gcTestEnv->exampleVM;
+	ASSERT_EQ(OMR_ERROR_NONE, gcTestEnv->GCHeapSetUp("fvtest/gctest/configuration/concurrent_kickoff_forecast_config.xml"));
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	ASSERT_TRUE(extensions->concurrentMark);
+
+	/* nothing is kept alive, but the example glue walks both tables in every collection */
+	exampleVM->rootTable = hashTableNew(
+			exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(RootEntry), 0, 0, OMRMEM_CATEGORY_MM,
+			rootTableHashFn, rootTableHashEqualFn, NULL, NULL);
+	exampleVM->objectTable = hashTableNew(
+			exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(ObjectEntry), 0, 0, OMRMEM_CATEGORY_MM,
+			objectTableHashFn, objectTableHashEqualFn, NULL, NULL);
+	ASSERT_TRUE((NULL != exampleVM->rootTable) && (NULL != exampleVM->objectTable));
+
+	char fileName[64];
+	omrstr_printf(fileName, sizeof(fileName), "VerboseGC-TestConcurrentKickoffForecast_%d.xml", omrsysinfo_get_pid());
+	MM_VerboseManager *manager = MM_VerboseManager::newInstance(env, exampleVM->_omrVM);
+	ASSERT_TRUE(NULL != manager);
+	manager->configureVerboseGC(exampleVM->_omrVM, fileName, 1, 0);
+	manager->enableVerboseGC();
+	manager->setInitializedTime(omrtime_hires_clock());
+
+	uintptr_t allocationTarget = extensions->heap->getActiveMemorySize() * ALLOCATION_HEAP_MULTIPLE;
+	uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+	for (uintptr_t allocated = 0; allocated < allocationTarget; allocated += GARBAGE_OBJECT_SIZE) {
+		MM_ObjectAllocationModel *withGc = new(objectAllocationModelSpace)
+				MM_ObjectAllocationModel(env, GARBAGE_OBJECT_SIZE, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, false));
+		ASSERT_TRUE(NULL != OMR_GC_AllocateObject(exampleVM->_omrVMThread, withGc)) << "after " << allocated << " bytes";
+	}
+
+	manager->closeStreams(env);
+	manager->disableVerboseGC();
+	manager->kill(env);
+	hashTableFree(exampleVM->rootTable);
+	exampleVM->rootTable = NULL;
+	hashTableFree(exampleVM->objectTable);
+	exampleVM->objectTable = NULL;
+
+	pugi::xml_document doc;
+	pugi::xml_parse_result result = doc.load_file(fileName);
+	ASSERT_TRUE(result) << fileName << ": " << result.description();
+	pugi::xpath_node_set kickoffs = doc.select_nodes("/verbosegc/concurrent-kickoff/kickoff-forecast");
+	pugi::xpath_node_set outcomes = doc.select_nodes("/verbosegc/concurrent-global-final/kickoff-forecast");
+	ASSERT_LT((size_t)0, outcomes.size()) << "no concurrent cycle completed";
+	EXPECT_LE(outcomes.size(), kickoffs.size());
+	for (pugi::xpath_node_set::const_iterator it = outcomes.begin(); it != outcomes.end(); ++it) {
+		pugi::xml_node outcome = it->node();
+		EXPECT_TRUE(outcome.attribute("predictedms"));
+		EXPECT_TRUE(outcome.attribute("predictedFreeBytes"));
+		/* the outcome is measured from kickoff to the final collection */
+		EXPECT_LT(0.0, outcome.attribute("actualms").as_double());
+		EXPECT_GE(extensions->heap->getActiveMemorySize(), (uintptr_t)outcome.attribute("actualFreeBytes").as_ullong());
+	}
+	gcTestEnv->log("concurrent kickoff forecast: kickoffs=%zu completed=%zu first predictedms=%s actualms=%s\n",
+			kickoffs.size(), outcomes.size(),
+			outcomes.first().node().attribute("predictedms").value(), outcomes.first().node().attribute("actualms").value());
+
+	if (!gcTestEnv->keepLog) {
+		omrfile_unlink(fileName);
+	}
+	gcTestEnv->GCHeapTearDown();
+}
+
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
@@ -0,0 +1,153 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ParallelDispatcher.hpp"
+#include "ParallelTask.hpp"
+#include "gcTestHelpers.hpp"
+#include "omrgc.h"
+#include "omrmodroncore.h"
+
+#include <gtest/gtest.h>
+
+/* Spin count used when measuring spin-then-park dispatch */
+#define DISPATCH_SPIN_COUNT ((uintptr_t)100000)
+
+/**
+ * A task that does nothing but count the threads that ran it, so that dispatching it measures only
+ * the cost of waking the threads and synchronizing them at the end of the task.
+ */
+class EmptyTask : public MM_ParallelTask
+{
+public:
+	volatile uintptr_t runCount;
+
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_DISPATCHER_IDLE; }
+
+	virtual void run(MM_EnvironmentBase *env)
+	{
+		MM_AtomicOperations::add(&runCount, 1);
+	}
+
+	EmptyTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher)
+		: MM_ParallelTask(env, dispatcher)
+		, runCount(0)
+	{
+	}
+};
+
+class DispatchLatencyTest
+{
+public:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	MM_GCExtensionsBase *extensions;
+	MM_ParallelDispatcher *dispatcher;
+
+	bool
+	setUp(const char *configFile)
+	{
+		exampleVM = &gcTestEnv->exampleVM;
+		if (OMR_ERROR_NONE != gcTestEnv->GCHeapSetUp(configFile)) {
+			return false;
+		}
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+		extensions = env->getExtensions();
+		dispatcher = extensions->dispatcher;
+		return true;
+	}
+
+	void
+	tearDown()
+	{
+		gcTestEnv->GCHeapTearDown();
+	}
+
+	/**
+	 * Dispatch an empty task back to back, checking that each dispatch ran on every thread asked for.
+	 * @return the average time per dispatch in nanoseconds
+	 */
+	uint64_t
+	dispatch(uintptr_t threadCount, uintptr_t spinCount, uintptr_t iterations)
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+		uintptr_t savedSpinCount = extensions->dispatcherWorkerSpinCount;
+		extensions->dispatcherWorkerSpinCount = spinCount;
+
+		/* one untimed dispatch so that every thread starts out parked or spinning after a task */
+		EmptyTask warmup(env, dispatcher);
+		dispatcher->run(env, &warmup, threadCount);
+
+		uint64_t startTime = omrtime_hires_clock();
+		for (uintptr_t i = 0; i < iterations; i++) {
+			EmptyTask task(env, dispatcher);
+			dispatcher->run(env, &task, threadCount);
+			EXPECT_EQ(threadCount, task.runCount) << "threads=" << threadCount << " spinCount=" << spinCount;
+		}
+		uint64_t elapsed = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+
+		extensions->dispatcherWorkerSpinCount = savedSpinCount;
+		return elapsed / iterations;
+	}
+};
+
+TEST(TestDispatchLatency, allThreadsRun)
+{
+	DispatchLatencyTest test;
+	ASSERT_TRUE(test.setUp("fvtest/gctest/configuration/dispatch_latency_config.xml"));
+
+	uintptr_t threadCountMaximum = test.dispatcher->threadCountMaximum();
+	for (uintptr_t threadCount = 1; threadCount <= threadCountMaximum; threadCount++) {
+		test.dispatch(threadCount, 0, 20);
+		/* short spins, so that workers both find tasks while spinning and time out and park */
+		test.dispatch(threadCount, 1, 20);
+		test.dispatch(threadCount, DISPATCH_SPIN_COUNT, 20);
+	}
+
+	/* shut down with the workers spinning after the last task */
+	test.extensions->dispatcherWorkerSpinCount = DISPATCH_SPIN_COUNT;
+	test.dispatch(threadCountMaximum, DISPATCH_SPIN_COUNT, 1);
+	test.tearDown();
+}
+
+/**
+ * Time back to back dispatch of an empty task with increasing numbers of GC threads, with workers
+ * parking as soon as a task completes and with workers spinning before they park.
+ */
+TEST(perfTestDispatchLatency, threads)
+{
+	DispatchLatencyTest test;
+	ASSERT_TRUE(test.setUp("fvtest/gctest/configuration/dispatch_latency_perf_config.xml"));
+
+	const uintptr_t iterations = 1000;
+	uintptr_t threadCountMaximum = test.dispatcher->threadCountMaximum();
+	for (uintptr_t threadCount = 1; threadCount <= threadCountMaximum; threadCount *= 2) {
+		uint64_t parkTime = test.dispatch(threadCount, 0, iterations);
+		uint64_t spinTime = test.dispatch(threadCount, DISPATCH_SPIN_COUNT, iterations);
+		gcTestEnv->log("dispatch latency: threads=%zu iterations=%zu park=%llu ns spin=%llu ns (spinCount=%zu)\n",
+				threadCount, iterations, parkTime, spinTime, DISPATCH_SPIN_COUNT);
+	}
+
+	test.tearDown();
+}
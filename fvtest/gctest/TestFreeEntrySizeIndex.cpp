@@ -0,0 +1,392 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#include "FreeEntrySizeIndex.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "Math.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Allocation granularity of the simulated heap */
+#define HEAP_GRANULE 16
+/* Smallest free entry kept on the simulated free list, as for a card aligned pool */
+#define HEAP_MINIMUM_FREE_ENTRY 512
+/* Heap and allocations of the latency benchmark */
+#define BENCHMARK_HEAP_SIZE ((uintptr_t)64 * 1024 * 1024)
+#define BENCHMARK_ALLOCATIONS ((uintptr_t)200 * 1024)
+
+#if defined(OMR_GC_FULL_POINTERS)
+
+/**
+ * A heap managed by an address ordered first fit free list the way MM_MemoryPoolAddressOrderedList manages one,
+ * searched either linearly or from a size index. Objects record their size in their first slot and the start
+ * of each object is flagged in a side table, so a simulated collection can rebuild the free list.
+ */
+struct FragmentedHeap {
+	uint8_t *base;
+	uintptr_t size;
+	uint8_t *objectStarts; /**< one flag per granule */
+	MM_HeapLinkedFreeHeader *freeList;
+	MM_FreeEntrySizeIndex *index; /**< NULL to always search from the head */
+	uintptr_t walkCount; /**< free entries examined and found too small */
+	uint32_t seed;
+};
+
+static uint32_t
+nextRandom(uint32_t *seed)
+{
+	*seed = (*seed * 1103515245u) + 12345u;
+	return *seed >> 8;
+}
+
+static bool
+initializeHeap(OMRPortLibrary *portLibrary, FragmentedHeap *heap, uintptr_t size, MM_FreeEntrySizeIndex *index)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	memset(heap, 0, sizeof(FragmentedHeap));
+	heap->base = (uint8_t *)omrmem_allocate_memory(size, OMRMEM_CATEGORY_MM);
+	heap->objectStarts = (uint8_t *)omrmem_allocate_memory(size / HEAP_GRANULE, OMRMEM_CATEGORY_MM);
+	if ((NULL == heap->base) || (NULL == heap->objectStarts)) {
+		return false;
+	}
+	heap->size = size;
+	heap->index = index;
+	memset(heap->objectStarts, 0, size / HEAP_GRANULE);
+	MM_HeapLinkedFreeHeader::fillWithHoles(heap->base, size, false);
+	heap->freeList = (MM_HeapLinkedFreeHeader *)heap->base;
+	return true;
+}
+
+static void
+tearDownHeap(OMRPortLibrary *portLibrary, FragmentedHeap *heap)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	omrmem_free_memory(heap->base);
+	omrmem_free_memory(heap->objectStarts);
+}
+
+static void
+unlinkEntry(FragmentedHeap *heap, MM_HeapLinkedFreeHeader *previous, MM_HeapLinkedFreeHeader *next)
+{
+	if (NULL == previous) {
+		heap->freeList = next;
+	} else {
+		previous->setNext(next, false);
+	}
+}
+
+/**
+ * Put the unused tail of a free entry back in its place on the list, or drop it if it is too small.
+ * @return the remainder, or NULL if it was dropped
+ */
+static MM_HeapLinkedFreeHeader *
+recycleRemainder(FragmentedHeap *heap, uint8_t *remainder, uintptr_t remainderSize, MM_HeapLinkedFreeHeader *previous, MM_HeapLinkedFreeHeader *next)
+{
+	MM_HeapLinkedFreeHeader *entry = NULL;
+	if (remainderSize >= HEAP_MINIMUM_FREE_ENTRY) {
+		MM_HeapLinkedFreeHeader::fillWithHoles(remainder, remainderSize, false);
+		entry = (MM_HeapLinkedFreeHeader *)remainder;
+		entry->setNext(next, false);
+		unlinkEntry(heap, previous, entry);
+	} else {
+		unlinkEntry(heap, previous, next);
+	}
+	return entry;
+}
+
+static void
+placeObject(FragmentedHeap *heap, uint8_t *object, uintptr_t size)
+{
+	*(uintptr_t *)object = size;
+	heap->objectStarts[(object - heap->base) / HEAP_GRANULE] = 1;
+}
+
+/**
+ * First fit allocation as done by MM_MemoryPoolAddressOrderedList::internalAllocate.
+ */
+static uint8_t *
+allocateObject(FragmentedHeap *heap, uintptr_t size)
+{
+	MM_HeapLinkedFreeHeader *previous = NULL;
+	MM_HeapLinkedFreeHeader *current = heap->freeList;
+	uintptr_t maximumSize = 0;
+
+	if (NULL != heap->index) {
+		MM_HeapLinkedFreeHeader *indexEntry = heap->index->find(size, heap->freeList, &maximumSize);
+		if (NULL != indexEntry) {
+			previous = indexEntry;
+			current = indexEntry->getNext(false);
+		}
+	}
+	while ((NULL != current) && (current->getSize() < size)) {
+		maximumSize = OMR_MAX(maximumSize, current->getSize());
+		heap->walkCount += 1;
+		previous = current;
+		current = current->getNext(false);
+	}
+
+	if (NULL == current) {
+		if ((NULL != heap->index) && (NULL != previous)) {
+			heap->index->exhausted(size, previous, maximumSize, heap->freeList);
+		}
+		return NULL;
+	}
+	if ((NULL != heap->index) && (NULL != previous)) {
+		heap->index->update(size, previous, maximumSize, heap->freeList);
+	}
+
+	uint8_t *object = (uint8_t *)current;
+	MM_HeapLinkedFreeHeader *remainder = recycleRemainder(heap, object + size, current->getSize() - size, previous, current->getNext(false));
+	if (NULL != heap->index) {
+		heap->index->replace(current, (NULL == remainder) ? previous : remainder);
+	}
+	placeObject(heap, object, size);
+	return object;
+}
+
+/**
+ * Allocation from the head of the list as done by MM_MemoryPoolAddressOrderedList::internalAllocateTLH,
+ * which leaves the size index alone.
+ */
+static uint8_t *
+allocateTLH(FragmentedHeap *heap, uintptr_t maximumSize)
+{
+	MM_HeapLinkedFreeHeader *head = heap->freeList;
+	if (NULL == head) {
+		return NULL;
+	}
+	uintptr_t size = OMR_MIN(maximumSize, head->getSize());
+	if ((head->getSize() - size) < HEAP_MINIMUM_FREE_ENTRY) {
+		size = head->getSize();
+	}
+	uint8_t *object = (uint8_t *)head;
+	recycleRemainder(heap, object + size, head->getSize() - size, NULL, head->getNext(false));
+	placeObject(heap, object, size);
+	return object;
+}
+
+/**
+ * Kill objects at random and rebuild the free list from the gaps between the survivors, as a sweep does.
+ * Gaps too small for the free list are left as dark matter until their neighbours die.
+ */
+static void
+collect(FragmentedHeap *heap, uint32_t survivalPercent)
+{
+	uintptr_t granules = heap->size / HEAP_GRANULE;
+	MM_HeapLinkedFreeHeader *tail = NULL;
+
+	heap->freeList = NULL;
+	if (NULL != heap->index) {
+		heap->index->clear();
+	}
+
+	uintptr_t granule = 0;
+	while (granule < granules) {
+		if (0 != heap->objectStarts[granule]) {
+			uintptr_t size = *(uintptr_t *)(heap->base + (granule * HEAP_GRANULE));
+			if ((nextRandom(&heap->seed) % 100) < survivalPercent) {
+				granule += size / HEAP_GRANULE;
+				continue;
+			}
+			heap->objectStarts[granule] = 0;
+		}
+		uintptr_t gapStart = granule;
+		while ((granule < granules) && (0 == heap->objectStarts[granule])) {
+			granule += 1;
+		}
+		uintptr_t gapSize = (granule - gapStart) * HEAP_GRANULE;
+		if (gapSize >= HEAP_MINIMUM_FREE_ENTRY) {
+			uint8_t *gap = heap->base + (gapStart * HEAP_GRANULE);
+			MM_HeapLinkedFreeHeader::fillWithHoles(gap, gapSize, false);
+			unlinkEntry(heap, tail, (MM_HeapLinkedFreeHeader *)gap);
+			tail = (MM_HeapLinkedFreeHeader *)gap;
+		}
+	}
+}
+
+/**
+ * A fragmenting workload: mostly small objects, which leave small gaps behind when they die, and some large ones
+ * that have to search past those gaps.
+ */
+static uintptr_t
+nextObjectSize(uint32_t *seed)
+{
+	uint32_t kind = nextRandom(seed) % 100;
+	uintptr_t size = 0;
+	if (kind < 85) {
+		size = 32 + (nextRandom(seed) % 2048);
+	} else {
+		size = (8 * 1024) + (nextRandom(seed) % (256 * 1024));
+	}
+	return MM_Math::roundToCeiling(HEAP_GRANULE, size);
+}
+
+static int
+compareLatency(const void *left, const void *right)
+{
+	uint64_t leftValue = *(const uint64_t *)left;
+	uint64_t rightValue = *(const uint64_t *)right;
+	return (leftValue < rightValue) ? -1 : ((leftValue > rightValue) ? 1 : 0);
+}
+
+#endif /* OMR_GC_FULL_POINTERS */
+
+TEST(TestFreeEntrySizeIndex, bounds)
+{
+	MM_FreeEntrySizeIndex index;
+	EXPECT_EQ((uintptr_t)1, index.getBucketCount());
+	EXPECT_EQ((uintptr_t)0, index.getBucket(12345));
+
+	const uintptr_t sizes[] = {4096, 512, 65536, 512, 1024, 0, 4096};
+	index.setBounds(sizes, sizeof(sizes) / sizeof(sizes[0]));
+	ASSERT_EQ((uintptr_t)5, index.getBucketCount());
+	const uintptr_t expectedBounds[] = {0, 512, 1024, 4096, 65536};
+	for (uintptr_t bucket = 0; bucket < 5; bucket++) {
+		EXPECT_EQ(expectedBounds[bucket], index.getBound(bucket));
+	}
+	EXPECT_EQ((uintptr_t)0, index.getBucket(16));
+	EXPECT_EQ((uintptr_t)1, index.getBucket(512));
+	EXPECT_EQ((uintptr_t)1, index.getBucket(1023));
+	EXPECT_EQ((uintptr_t)3, index.getBucket(65535));
+	EXPECT_EQ((uintptr_t)4, index.getBucket(UDATA_MAX));
+
+	/* the largest candidates are dropped once the index is full */
+	uintptr_t manySizes[2 * OMR_FREE_ENTRY_SIZE_INDEX_BUCKETS];
+	for (uintptr_t i = 0; i < 2 * OMR_FREE_ENTRY_SIZE_INDEX_BUCKETS; i++) {
+		manySizes[i] = ((2 * OMR_FREE_ENTRY_SIZE_INDEX_BUCKETS) - i) * 1024;
+	}
+	index.setBounds(manySizes, 2 * OMR_FREE_ENTRY_SIZE_INDEX_BUCKETS);
+	ASSERT_EQ((uintptr_t)OMR_FREE_ENTRY_SIZE_INDEX_BUCKETS, index.getBucketCount());
+	for (uintptr_t bucket = 1; bucket < OMR_FREE_ENTRY_SIZE_INDEX_BUCKETS; bucket++) {
+		EXPECT_EQ(bucket * 1024, index.getBound(bucket));
+	}
+}
+
+#if defined(OMR_GC_FULL_POINTERS)
+
+/**
+ * Searching from the index must pick exactly the entries a search from the head of the list would.
+ */
+TEST(TestFreeEntrySizeIndex, firstFit)
+{
+	FragmentedHeap linearHeap;
+	FragmentedHeap indexedHeap;
+	MM_FreeEntrySizeIndex index;
+	const uintptr_t bounds[] = {1024, 4096, 16384, 65536, 131072};
+	index.setBounds(bounds, sizeof(bounds) / sizeof(bounds[0]));
+
+	ASSERT_TRUE(initializeHeap(gcTestEnv->getPortLibrary(), &linearHeap, 4 * 1024 * 1024, NULL));
+	ASSERT_TRUE(initializeHeap(gcTestEnv->getPortLibrary(), &indexedHeap, 4 * 1024 * 1024, &index));
+
+	uint32_t seed = 12345;
+	uintptr_t collections = 0;
+	for (uintptr_t i = 0; i < 100000; i++) {
+		uintptr_t size = nextObjectSize(&seed);
+		uint8_t *linearObject = NULL;
+		uint8_t *indexedObject = NULL;
+		if (0 == (nextRandom(&seed) % 10)) {
+			linearObject = allocateTLH(&linearHeap, size);
+			indexedObject = allocateTLH(&indexedHeap, size);
+		} else {
+			linearObject = allocateObject(&linearHeap, size);
+			indexedObject = allocateObject(&indexedHeap, size);
+		}
+		intptr_t linearOffset = (NULL == linearObject) ? -1 : (linearObject - linearHeap.base);
+		intptr_t indexedOffset = (NULL == indexedObject) ? -1 : (indexedObject - indexedHeap.base);
+		ASSERT_EQ(linearOffset, indexedOffset) << "allocation " << i << " of " << size;
+		if ((NULL == linearObject) && (0 == (nextRandom(&seed) % 4))) {
+			/* keep failing every so often so failed searches are repeated before the list changes */
+			collect(&linearHeap, 50);
+			collect(&indexedHeap, 50);
+			collections += 1;
+		}
+	}
+
+	EXPECT_LT((uintptr_t)0, collections);
+	EXPECT_GT(linearHeap.walkCount, indexedHeap.walkCount);
+
+	tearDownHeap(gcTestEnv->getPortLibrary(), &linearHeap);
+	tearDownHeap(gcTestEnv->getPortLibrary(), &indexedHeap);
+}
+
+/**
+ * Time every allocation of a fragmenting workload on a large heap, collecting whenever an allocation fails,
+ * with and without the size index, and report the latency percentiles.
+ */
+TEST(perfTestFreeEntrySizeIndex, fragmentation)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	const char *searchNames[] = {"linear", "index"};
+	uint64_t *latencies = (uint64_t *)omrmem_allocate_memory(BENCHMARK_ALLOCATIONS * sizeof(uint64_t), OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != latencies);
+	uintptr_t expectedChecksum = 0;
+
+	for (uintptr_t s = 0; s < 2; s++) {
+		FragmentedHeap heap;
+		MM_FreeEntrySizeIndex index;
+		const uintptr_t bounds[] = {1024, 2048, 4096, 8192, 16384, 32768, 65536, 131072, 262144};
+		index.setBounds(bounds, sizeof(bounds) / sizeof(bounds[0]));
+		ASSERT_TRUE(initializeHeap(gcTestEnv->getPortLibrary(), &heap, BENCHMARK_HEAP_SIZE, (0 == s) ? NULL : &index));
+
+		uint32_t seed = 12345;
+		uintptr_t checksum = 0;
+		uintptr_t failures = 0;
+		uintptr_t collections = 0;
+		for (uintptr_t i = 0; i < BENCHMARK_ALLOCATIONS; i++) {
+			uintptr_t size = nextObjectSize(&seed);
+			uint64_t startTime = omrtime_hires_clock();
+			uint8_t *object = allocateObject(&heap, size);
+			latencies[i] = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+			if (NULL == object) {
+				failures += 1;
+				collect(&heap, 60);
+				collections += 1;
+			} else {
+				checksum += ((uintptr_t)(object - heap.base) / HEAP_GRANULE) * (i + 1);
+			}
+		}
+
+		if (0 == s) {
+			expectedChecksum = checksum;
+		} else {
+			EXPECT_EQ(expectedChecksum, checksum);
+		}
+
+		qsort(latencies, BENCHMARK_ALLOCATIONS, sizeof(uint64_t), compareLatency);
+		gcTestEnv->log("free list allocate: heap=%zuMB allocations=%zu failures=%zu collections=%zu search=%s walked=%zu p50=%llu ns p90=%llu ns p99=%llu ns p99.9=%llu ns max=%llu ns\n",
+				BENCHMARK_HEAP_SIZE >> 20, BENCHMARK_ALLOCATIONS, failures, collections, searchNames[s], heap.walkCount,
+				latencies[BENCHMARK_ALLOCATIONS / 2], latencies[(BENCHMARK_ALLOCATIONS * 90) / 100],
+				latencies[(BENCHMARK_ALLOCATIONS * 99) / 100], latencies[(BENCHMARK_ALLOCATIONS * 999) / 1000],
+				latencies[BENCHMARK_ALLOCATIONS - 1]);
+
+		tearDownHeap(gcTestEnv->getPortLibrary(), &heap);
+	}
+
+	omrmem_free_memory(latencies);
+}
+
+#endif /* OMR_GC_FULL_POINTERS */
@@ -0,0 +1,247 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "HeapCommitPolicy.hpp"
+#include "HeapResizeStats.hpp"
+#include "HeapVirtualMemory.hpp"
+#include "Math.hpp"
+#include "gcTestHelpers.hpp"
+#include "omrgc.h"
+
+#include <gtest/gtest.h>
+#include <string.h>
+
+#define ONE_MB ((uintptr_t)1024 * 1024)
+
+class HeapCommitPolicyTest
+{
+public:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	MM_GCExtensionsBase *extensions;
+	MM_HeapVirtualMemory *heap;
+	MM_HeapCommitPolicy *policy;
+	MM_HeapResizeStats *stats;
+
+	bool
+	setUp(const char *configFile)
+	{
+		exampleVM = &gcTestEnv->exampleVM;
+		if (OMR_ERROR_NONE != gcTestEnv->GCHeapSetUp(configFile)) {
+			return false;
+		}
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+		extensions = env->getExtensions();
+		heap = (MM_HeapVirtualMemory *)extensions->heap;
+		policy = heap->getCommitPolicy();
+		stats = heap->getResizeStats();
+		return NULL != policy;
+	}
+
+	void
+	tearDown()
+	{
+		gcTestEnv->GCHeapTearDown();
+	}
+
+	/**
+	 * @return the base of a range at the top of the reserved heap, which the heap itself leaves uncommitted
+	 */
+	uint8_t *
+	uncommittedRange(uintptr_t size)
+	{
+		uintptr_t top = MM_Math::roundToFloor(heap->getPageSize(), (uintptr_t)heap->getHeapTop());
+		uint8_t *base = (uint8_t *)(top - size);
+		EXPECT_TRUE(base >= (uint8_t *)heap->getHeapBase() + heap->getMemorySize());
+		return base;
+	}
+
+	uint64_t
+	residentSize()
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+		uint64_t size = 0;
+		omrvmem_get_process_memory_size(OMRPORT_VMEM_PROCESS_PHYSICAL, &size);
+		return size;
+	}
+};
+
+static bool
+allBytesAre(uint8_t *base, uintptr_t size, uint8_t value)
+{
+	for (uintptr_t i = 0; i < size; i++) {
+		if (value != base[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+TEST(TestHeapCommitPolicy, deferredDecommit)
+{
+	HeapCommitPolicyTest test;
+	ASSERT_TRUE(test.setUp("fvtest/gctest/configuration/heap_commit_policy_config.xml"));
+	uintptr_t size = 16 * ONE_MB;
+	uint8_t *base = test.uncommittedRange(size);
+
+	ASSERT_TRUE(test.heap->commitMemory(base, size));
+	memset(base, 0x5A, size);
+	uintptr_t backgroundBytes = test.stats->getBackgroundDecommitBytes();
+	uintptr_t deferredBytes = test.stats->getDeferredDecommitBytes();
+
+	EXPECT_TRUE(test.heap->decommitContractedMemory(test.env, base, size, base, NULL));
+	test.policy->flush(test.env);
+
+	EXPECT_EQ(deferredBytes + size, test.stats->getDeferredDecommitBytes());
+	EXPECT_EQ(backgroundBytes + size, test.stats->getBackgroundDecommitBytes());
+	EXPECT_LT((uint64_t)0, test.stats->getBackgroundDecommitTime());
+	/* without lazy free the released pages come back zeroed */
+	EXPECT_TRUE(allBytesAre(base, size, 0));
+
+	test.tearDown();
+}
+
+TEST(TestHeapCommitPolicy, commitCancelsDecommit)
+{
+	HeapCommitPolicyTest test;
+	ASSERT_TRUE(test.setUp("fvtest/gctest/configuration/heap_commit_policy_config.xml"));
+	uintptr_t size = 16 * ONE_MB;
+	uint8_t *base = test.uncommittedRange(size);
+
+	/* take back pieces at the ends and in the middle while the batches of the decommit are under way */
+	const uintptr_t offsets[] = {0, 5 * ONE_MB, 12 * ONE_MB};
+	const uintptr_t lengths[] = {ONE_MB, 3 * ONE_MB + 4096, 4 * ONE_MB};
+	ASSERT_TRUE(test.heap->commitMemory(base, size));
+	memset(base, 0x5A, size);
+	EXPECT_TRUE(test.heap->decommitContractedMemory(test.env, base, size, base, NULL));
+	for (uintptr_t i = 0; i < sizeof(offsets) / sizeof(offsets[0]); i++) {
+		ASSERT_TRUE(test.heap->commitMemory(base + offsets[i], lengths[i]));
+		memset(base + offsets[i], 0xA5, lengths[i]);
+	}
+	test.policy->flush(test.env);
+
+	for (uintptr_t i = 0; i < sizeof(offsets) / sizeof(offsets[0]); i++) {
+		EXPECT_TRUE(allBytesAre(base + offsets[i], lengths[i], 0xA5)) << "offset=" << offsets[i];
+	}
+
+	test.heap->decommitMemory(base, size, NULL, NULL);
+	test.tearDown();
+}
+
+TEST(TestHeapCommitPolicy, precommit)
+{
+	HeapCommitPolicyTest test;
+	ASSERT_TRUE(test.setUp("fvtest/gctest/configuration/heap_commit_policy_config.xml"));
+	uintptr_t size = 8 * ONE_MB;
+	uint8_t *base = test.uncommittedRange(2 * size);
+
+	/* an expansion taking all of the expected range */
+	uintptr_t precommitBytes = test.stats->getPrecommitBytes();
+	uintptr_t hitBytes = test.stats->getPrecommitHitBytes();
+	test.heap->expectExpansion(test.env, base, size);
+	test.policy->flush(test.env);
+	EXPECT_EQ(precommitBytes + size, test.stats->getPrecommitBytes());
+	ASSERT_TRUE(test.heap->commitMemory(base, size));
+	EXPECT_EQ(hitBytes + size, test.stats->getPrecommitHitBytes());
+	memset(base, 0x5A, size);
+
+	/* an expansion taking half of it, the rest being released */
+	uintptr_t backgroundBytes = test.stats->getBackgroundDecommitBytes();
+	test.heap->expectExpansion(test.env, base + size, size);
+	test.policy->flush(test.env);
+	ASSERT_TRUE(test.heap->commitMemory(base + size, size / 2));
+	EXPECT_EQ(hitBytes + size + (size / 2), test.stats->getPrecommitHitBytes());
+	memset(base + size, 0xA5, size / 2);
+	test.policy->flush(test.env);
+	EXPECT_EQ(backgroundBytes + (size / 2), test.stats->getBackgroundDecommitBytes());
+	EXPECT_TRUE(allBytesAre(base, size, 0x5A));
+	EXPECT_TRUE(allBytesAre(base + size, size / 2, 0xA5));
+
+	/* a contraction instead of the expected expansion */
+	test.heap->decommitContractedMemory(test.env, base + size, size / 2, base + size, NULL);
+	test.heap->expectExpansion(test.env, base + size, size);
+	test.policy->flush(test.env);
+	backgroundBytes = test.stats->getBackgroundDecommitBytes();
+	test.heap->decommitContractedMemory(test.env, base, size, base, NULL);
+	test.policy->flush(test.env);
+	EXPECT_EQ(backgroundBytes + (2 * size), test.stats->getBackgroundDecommitBytes());
+
+	test.tearDown();
+}
+
+/**
+ * Time the decommit of a large contraction in the pause against handing it to the background thread,
+ * and the commit and first touch of a large expansion with and without pre-committing it.
+ */
+TEST(perfTestHeapCommitPolicy, pauseTime)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	HeapCommitPolicyTest test;
+	ASSERT_TRUE(test.setUp("fvtest/gctest/configuration/heap_commit_policy_perf_config.xml"));
+	uintptr_t size = 256 * ONE_MB;
+	uintptr_t pageSize = test.heap->getPageSize();
+	uint8_t *base = test.uncommittedRange(size);
+
+	for (uintptr_t deferred = 0; deferred < 2; deferred++) {
+		ASSERT_TRUE(test.heap->commitMemory(base, size));
+		memset(base, 0x5A, size);
+		uint64_t residentBefore = test.residentSize();
+		uint64_t startTime = omrtime_hires_clock();
+		if (0 == deferred) {
+			test.heap->decommitMemory(base, size, base, NULL);
+		} else {
+			test.heap->decommitContractedMemory(test.env, base, size, base, NULL);
+		}
+		uint64_t pause = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		test.policy->flush(test.env);
+		uint64_t total = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		uint64_t residentAfter = test.residentSize();
+		gcTestEnv->log("heap decommit: size=%zu mode=%s pause=%llu us total=%llu us rss=%llu->%llu\n",
+				size, (0 == deferred) ? "synchronous" : "deferred", pause, total, residentBefore, residentAfter);
+	}
+
+	for (uintptr_t precommit = 0; precommit < 2; precommit++) {
+		if (0 != precommit) {
+			test.heap->expectExpansion(test.env, base, size);
+			test.policy->flush(test.env);
+		}
+		uint64_t startTime = omrtime_hires_clock();
+		ASSERT_TRUE(test.heap->commitMemory(base, size));
+		for (uint8_t *page = base; page < base + size; page += pageSize) {
+			*page = 0x5A;
+		}
+		uint64_t elapsed = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		gcTestEnv->log("heap expand: size=%zu precommit=%s commit+touch=%llu us rss=%llu\n",
+				size, (0 == precommit) ? "false" : "true", elapsed, test.residentSize());
+		test.heap->decommitMemory(base, size, base, NULL);
+	}
+
+	gcTestEnv->log("heap resize stats: commit=%llu decommit=%llu backgroundDecommit=%llu backgroundPrecommit=%llu ticks, "
+			"deferred=%zu backgroundDecommitted=%zu precommitted=%zu precommitHits=%zu rssReduction=%llu bytes\n",
+			test.stats->getCommitTime(), test.stats->getDecommitTime(), test.stats->getBackgroundDecommitTime(), test.stats->getBackgroundPrecommitTime(),
+			test.stats->getDeferredDecommitBytes(), test.stats->getBackgroundDecommitBytes(), test.stats->getPrecommitBytes(),
+			test.stats->getPrecommitHitBytes(), test.stats->getRSSReduction());
+
+	test.tearDown();
+}
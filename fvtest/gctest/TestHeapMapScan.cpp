@@ -0,0 +1,230 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "Bits.hpp"
+#include "HeapMap.hpp"
+#include "HeapMapWordIterator.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+#include <string.h>
+
+/* Mark map slots for a 2GB heap on 64 bit */
+#define BENCHMARK_SLOT_COUNT ((uintptr_t)4 * 1024 * 1024)
+
+static uintptr_t
+referenceLowestSetBit(uintptr_t value)
+{
+	uintptr_t index = 0;
+	while (0 == (value & 1)) {
+		value >>= 1;
+		index += 1;
+	}
+	return index;
+}
+
+static uintptr_t
+referenceHighestSetBit(uintptr_t value)
+{
+	uintptr_t index = J9BITS_BITS_IN_SLOT - 1;
+	while (0 == (value & ((uintptr_t)1 << index))) {
+		index -= 1;
+	}
+	return index;
+}
+
+static uintptr_t
+referencePopulationCount(uintptr_t value)
+{
+	uintptr_t count = 0;
+	while (0 != value) {
+		count += value & 1;
+		value >>= 1;
+	}
+	return count;
+}
+
+static uintptr_t *
+referenceNextNonEmptySlot(uintptr_t *slot, uintptr_t *endSlot)
+{
+	while ((slot < endSlot) && (0 == *slot)) {
+		slot += 1;
+	}
+	return slot;
+}
+
+/**
+ * Visit the set bits one shift at a time, as a mark map walk does without a bit scan instruction.
+ * @return the sum of the heap slot offsets of the set bits, so no walk can be optimized away
+ */
+static uintptr_t
+shiftWalk(uintptr_t *slots, uintptr_t slotCount, uintptr_t *count)
+{
+	uintptr_t sum = 0;
+	for (uintptr_t i = 0; i < slotCount; i++) {
+		uintptr_t value = slots[i];
+		uintptr_t offset = i * J9BITS_BITS_IN_SLOT;
+		while (0 != value) {
+			if (0 != (value & 1)) {
+				sum += offset;
+				*count += 1;
+			}
+			value >>= 1;
+			offset += 1;
+		}
+	}
+	return sum;
+}
+
+/**
+ * Visit the set bits with the bulk empty slot skip and the word iterator used by the collectors.
+ */
+static uintptr_t
+iteratorWalk(uintptr_t *slots, uintptr_t slotCount, uintptr_t *count)
+{
+	uintptr_t sum = 0;
+	uintptr_t *endSlot = slots + slotCount;
+	uintptr_t *slot = MM_HeapMap::findNextNonEmptySlot(slots, endSlot);
+	while (slot < endSlot) {
+		/* a fake heap base of 0 turns the returned objects into heap slot offsets */
+		uintptr_t *heapSlot = (uintptr_t *)(((uintptr_t)(slot - slots)) * J9BITS_BITS_IN_SLOT * sizeof(uintptr_t));
+		MM_HeapMapWordIterator wordIterator(*slot, heapSlot);
+		omrobjectptr_t object = NULL;
+		while (NULL != (object = wordIterator.nextObject())) {
+			sum += (uintptr_t)object / sizeof(uintptr_t);
+			*count += 1;
+		}
+		slot = MM_HeapMap::findNextNonEmptySlot(slot + 1, endSlot);
+	}
+	return sum;
+}
+
+TEST(TestHeapMapScan, bitScan)
+{
+	for (uintptr_t bit = 0; bit < J9BITS_BITS_IN_SLOT; bit++) {
+		uintptr_t value = (uintptr_t)1 << bit;
+		EXPECT_EQ(bit, MM_Bits::leadingZeroes(value));
+		EXPECT_EQ(J9BITS_BITS_IN_SLOT - 1 - bit, MM_Bits::trailingZeroes(value));
+		EXPECT_EQ((uintptr_t)1, MM_Bits::populationCount(value));
+		EXPECT_EQ(bit + 1, MM_Bits::populationCount((value - 1) | value));
+	}
+
+	uint32_t seed = 12345;
+	for (uintptr_t i = 0; i < 10000; i++) {
+		uintptr_t value = 0;
+		for (uintptr_t part = 0; part < sizeof(uintptr_t) / sizeof(uint16_t); part++) {
+			seed = (seed * 1103515245u) + 12345u;
+			value = (value << 16) | (seed >> 16);
+		}
+		/* vary the density so sparse and dense words are both covered */
+		value &= ((uintptr_t)0 - (i & 1)) | (value >> (i % 7));
+		EXPECT_EQ(referencePopulationCount(value), MM_Bits::populationCount(value)) << value;
+		if (0 != value) {
+			EXPECT_EQ(referenceLowestSetBit(value), MM_Bits::leadingZeroes(value)) << value;
+			EXPECT_EQ(J9BITS_BITS_IN_SLOT - 1 - referenceHighestSetBit(value), MM_Bits::trailingZeroes(value)) << value;
+		}
+	}
+}
+
+TEST(TestHeapMapScan, findNextNonEmptySlot)
+{
+	uintptr_t slots[128];
+
+	for (uintptr_t start = 0; start < 16; start++) {
+		for (uintptr_t end = start; end < 128; end += 5) {
+			/* all empty */
+			memset(slots, 0, sizeof(slots));
+			EXPECT_EQ(slots + end, MM_HeapMap::findNextNonEmptySlot(slots + start, slots + end));
+
+			/* one set bit anywhere in (or around) the range */
+			for (uintptr_t set = 0; set < 128; set += 3) {
+				memset(slots, 0, sizeof(slots));
+				slots[set] = (uintptr_t)1 << (set % J9BITS_BITS_IN_SLOT);
+				EXPECT_EQ(referenceNextNonEmptySlot(slots + start, slots + end), MM_HeapMap::findNextNonEmptySlot(slots + start, slots + end));
+			}
+		}
+	}
+}
+
+/**
+ * Time a walk over every set bit of a large mark map, at various densities of set bits,
+ * bit by bit and with the word iterator after a bulk skip of empty slots.
+ */
+TEST(perfTestHeapMapScan, density)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	const double densities[] = {0.01, 0.1, 0.5};
+	typedef uintptr_t (*WalkFunction)(uintptr_t *slots, uintptr_t slotCount, uintptr_t *count);
+	const WalkFunction walks[] = {shiftWalk, iteratorWalk};
+	const char *walkNames[] = {"shift", "iterator"};
+
+	uintptr_t *slots = (uintptr_t *)omrmem_allocate_memory(BENCHMARK_SLOT_COUNT * sizeof(uintptr_t), OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != slots);
+
+	for (uintptr_t d = 0; d < sizeof(densities) / sizeof(densities[0]); d++) {
+		/* set bits with a fixed seed so each run sees the same map */
+		uint32_t seed = 12345;
+		uint32_t threshold = (uint32_t)(densities[d] * (double)0xFFFFFFFFu);
+		uintptr_t expectedCount = 0;
+		for (uintptr_t i = 0; i < BENCHMARK_SLOT_COUNT; i++) {
+			uintptr_t value = 0;
+			for (uintptr_t bit = 0; bit < J9BITS_BITS_IN_SLOT; bit++) {
+				seed = (seed * 1103515245u) + 12345u;
+				if (seed <= threshold) {
+					value |= (uintptr_t)1 << bit;
+				}
+			}
+			slots[i] = value;
+			expectedCount += MM_Bits::populationCount(value);
+		}
+
+		uintptr_t expectedSum = 0;
+		for (uintptr_t w = 0; w < sizeof(walks) / sizeof(walks[0]); w++) {
+			uintptr_t count = 0;
+			uint64_t startTime = omrtime_hires_clock();
+			uintptr_t sum = walks[w](slots, BENCHMARK_SLOT_COUNT, &count);
+			uint64_t elapsed = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			EXPECT_EQ(expectedCount, count) << walkNames[w] << " walk at density " << densities[d];
+			if (0 == w) {
+				expectedSum = sum;
+			} else {
+				EXPECT_EQ(expectedSum, sum) << walkNames[w] << " walk at density " << densities[d];
+			}
+			gcTestEnv->log("mark map walk: slots=%zu density=%.2f bits=%zu walk=%s time=%llu us (%.1f Mbits/s)\n",
+					BENCHMARK_SLOT_COUNT, densities[d], count, walkNames[w], elapsed,
+					(0 == elapsed) ? 0.0 : ((double)count / (double)elapsed));
+		}
+
+		/* counting alone needs no bit scan at all */
+		uintptr_t count = 0;
+		uint64_t startTime = omrtime_hires_clock();
+		for (uintptr_t i = 0; i < BENCHMARK_SLOT_COUNT; i++) {
+			count += MM_Bits::populationCount(slots[i]);
+		}
+		uint64_t elapsed = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		EXPECT_EQ(expectedCount, count);
+		gcTestEnv->log("mark map count: slots=%zu density=%.2f bits=%zu time=%llu us\n",
+				BENCHMARK_SLOT_COUNT, densities[d], count, elapsed);
+	}
+
+	omrmem_free_memory(slots);
+}
@@ -0,0 +1,294 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "MarkMap.hpp"
+#include "MarkingScheme.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "ObjectModel.hpp"
+#include "ParallelDispatcher.hpp"
+#include "ParallelGlobalGC.hpp"
+#include "ParallelHeapWalker.hpp"
+#include "ParallelTask.hpp"
+#include "gcTestHelpers.hpp"
+#include "omrgc.h"
+
+#include <gtest/gtest.h>
+#include <string.h>
+
+/* Largest object allocated, spanning many of the smaller chunk sizes */
+#define LARGE_OBJECT_SIZE ((uintptr_t)24 * 1024)
+
+/**
+ * What a walk saw, summed over the objects so that walks visiting the same objects in any order agree.
+ * Each GC thread adds to its own, padded to keep the threads off each other's cache lines.
+ */
+struct WalkTotals {
+	uintptr_t objects;
+	uintptr_t addressSum;
+	uintptr_t hashSum;
+	uint8_t padding[256 - (3 * sizeof(uintptr_t))];
+};
+
+struct WalkState {
+	WalkTotals *totals;
+	uintptr_t totalsCount;
+};
+
+static void
+sumObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	WalkState *state = (WalkState *)userData;
+	uintptr_t workerID = MM_EnvironmentBase::getEnvironment(omrVMThread)->getWorkerID();
+	WalkTotals *totals = &state->totals[workerID % state->totalsCount];
+	uintptr_t address = (uintptr_t)object;
+	totals->objects += 1;
+	totals->addressSum += address;
+	totals->hashSum += (address * (uintptr_t)0x9E3779B97F4A7C15ULL) ^ (address >> 17);
+}
+
+/**
+ * A task from which each thread calls the in-task walk, as a collector walking the heap during a GC does.
+ */
+class WalkInTask : public MM_ParallelTask
+{
+public:
+	MM_ParallelHeapWalker *heapWalker;
+	WalkState *state;
+
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_PARALLEL_OBJECT_DO; }
+
+	virtual void run(MM_EnvironmentBase *env)
+	{
+		heapWalker->allObjectsDoParallel(env, sumObject, state, 0);
+	}
+
+	WalkInTask(MM_EnvironmentBase *env, MM_ParallelHeapWalker *heapWalker, WalkState *state)
+		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
+		, heapWalker(heapWalker)
+		, state(state)
+	{
+	}
+};
+
+class ParallelHeapWalkTest
+{
+public:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	MM_GCExtensionsBase *extensions;
+	MM_ParallelHeapWalker *heapWalker;
+	MM_MarkMap *markMap;
+	WalkState state;
+	WalkTotals expected;
+
+	bool
+	setUp(const char *configFile)
+	{
+		exampleVM = &gcTestEnv->exampleVM;
+		state.totals = NULL;
+		if (OMR_ERROR_NONE != gcTestEnv->GCHeapSetUp(configFile)) {
+			return false;
+		}
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+		extensions = env->getExtensions();
+		MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)extensions->getGlobalCollector();
+		heapWalker = (MM_ParallelHeapWalker *)globalCollector->getHeapWalker();
+		markMap = globalCollector->getMarkingScheme()->getMarkMap();
+
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+		state.totalsCount = extensions->dispatcher->threadCountMaximum();
+		state.totals = (WalkTotals *)omrmem_allocate_memory(state.totalsCount * sizeof(WalkTotals), OMRMEM_CATEGORY_MM);
+		return NULL != state.totals;
+	}
+
+	void
+	tearDown()
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+		omrmem_free_memory(state.totals);
+		markMap->setMarkMapValid(false);
+		gcTestEnv->GCHeapTearDown();
+	}
+
+	/**
+	 * Fill the heap with objects of pseudo-random sizes, mostly small with the odd one spanning several chunks,
+	 * and set the mark bits of some of them, leaving long runs without any mark bit.
+	 * @return the number of objects allocated
+	 */
+	uintptr_t
+	fillHeap(uintptr_t maximumObjects)
+	{
+		uint32_t seed = 12345;
+		uintptr_t objectCount = 0;
+		uintptr_t unmarkedRun = 0;
+		while (objectCount < maximumObjects) {
+			seed = (seed * 1103515245u) + 12345u;
+			uintptr_t size = sizeof(uintptr_t) * (2 + ((seed >> 16) % 14));
+			if (0 == ((seed >> 8) % 512)) {
+				size = LARGE_OBJECT_SIZE - ((seed >> 12) % 1024) * sizeof(uintptr_t);
+			}
+			uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+			MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
+					MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+			omrobjectptr_t object = OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc);
+			if (NULL == object) {
+				break;
+			}
+			objectCount += 1;
+
+			seed = (seed * 1103515245u) + 12345u;
+			if (0 < unmarkedRun) {
+				unmarkedRun -= 1;
+			} else if (0 == ((seed >> 16) % 1000)) {
+				unmarkedRun = 1000 + ((seed >> 8) % 20000);
+			} else if (0 == ((seed >> 16) % 3)) {
+				markMap->setBit(object);
+			}
+		}
+		return objectCount;
+	}
+
+	void
+	clearTotals()
+	{
+		memset(state.totals, 0, state.totalsCount * sizeof(WalkTotals));
+	}
+
+	WalkTotals
+	sumTotals()
+	{
+		WalkTotals sum;
+		memset(&sum, 0, sizeof(sum));
+		for (uintptr_t i = 0; i < state.totalsCount; i++) {
+			sum.objects += state.totals[i].objects;
+			sum.addressSum += state.totals[i].addressSum;
+			sum.hashSum += state.totals[i].hashSum;
+		}
+		return sum;
+	}
+
+	/**
+	 * Walk the heap serially, flushing the allocation caches first, for the totals a parallel walk must match.
+	 */
+	void
+	walkSerial()
+	{
+		clearTotals();
+		heapWalker->allObjectsDo(env, sumObject, &state, 0, false, true);
+		expected = sumTotals();
+	}
+
+	/**
+	 * Walk the heap in parallel and check that it saw exactly the objects of the serial walk.
+	 */
+	void
+	walkParallel(uintptr_t chunkSize, uintptr_t threadCount)
+	{
+		uintptr_t savedChunkSize = extensions->parallelHeapWalkChunkSize;
+		extensions->parallelHeapWalkChunkSize = chunkSize;
+		clearTotals();
+		heapWalker->allObjectsDoChunked(env, sumObject, &state, 0, threadCount);
+		extensions->parallelHeapWalkChunkSize = savedChunkSize;
+
+		WalkTotals actual = sumTotals();
+		EXPECT_EQ(expected.objects, actual.objects) << "chunkSize=" << chunkSize << " threads=" << threadCount;
+		EXPECT_EQ(expected.addressSum, actual.addressSum) << "chunkSize=" << chunkSize << " threads=" << threadCount;
+		EXPECT_EQ(expected.hashSum, actual.hashSum) << "chunkSize=" << chunkSize << " threads=" << threadCount;
+	}
+
+	/**
+	 * Walk the heap with the in-task walk from the threads of a task and check that it saw exactly the objects of the serial walk.
+	 */
+	void
+	walkInTask(uintptr_t threadCount)
+	{
+		clearTotals();
+		WalkInTask task(env, heapWalker, &state);
+		extensions->dispatcher->run(env, &task, threadCount);
+
+		WalkTotals actual = sumTotals();
+		EXPECT_EQ(expected.objects, actual.objects) << "in task threads=" << threadCount;
+		EXPECT_EQ(expected.addressSum, actual.addressSum) << "in task threads=" << threadCount;
+		EXPECT_EQ(expected.hashSum, actual.hashSum) << "in task threads=" << threadCount;
+	}
+};
+
+TEST(TestParallelHeapWalk, chunkBoundaries)
+{
+	ParallelHeapWalkTest test;
+	ASSERT_TRUE(test.setUp("fvtest/gctest/configuration/parallel_heap_walk_config.xml"));
+
+	uintptr_t objectCount = test.fillHeap(UDATA_MAX);
+	test.walkSerial();
+	EXPECT_EQ(objectCount, test.expected.objects);
+
+	/* without a valid mark map each region is walked whole by one thread */
+	test.walkParallel(1024, 4);
+
+	/* chunks smaller than, around and larger than the large objects */
+	test.markMap->setMarkMapValid(true);
+	const uintptr_t chunkSizes[] = {1, 512, 4096, LARGE_OBJECT_SIZE, 64 * 1024, 1024 * 1024, UDATA_MAX / 2};
+	for (uintptr_t c = 0; c < sizeof(chunkSizes) / sizeof(chunkSizes[0]); c++) {
+		for (uintptr_t threadCount = 1; threadCount <= 4; threadCount++) {
+			test.walkParallel(chunkSizes[c], threadCount);
+		}
+	}
+	for (uintptr_t threadCount = 1; threadCount <= 4; threadCount++) {
+		test.walkInTask(threadCount);
+	}
+
+	test.tearDown();
+}
+
+/**
+ * Time parallel walks of a large heap with increasing numbers of GC threads.
+ */
+TEST(perfTestParallelHeapWalk, threads)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	ParallelHeapWalkTest test;
+	ASSERT_TRUE(test.setUp("fvtest/gctest/configuration/parallel_heap_walk_perf_config.xml"));
+
+	uintptr_t objectCount = test.fillHeap(UDATA_MAX);
+	uint64_t startTime = omrtime_hires_clock();
+	test.walkSerial();
+	uint64_t elapsed = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	EXPECT_EQ(objectCount, test.expected.objects);
+	gcTestEnv->log("heap walk: heap=%zu objects=%zu walk=serial time=%llu us (%.1f Mobjects/s)\n",
+			test.extensions->heap->getMemorySize(), objectCount, elapsed,
+			(0 == elapsed) ? 0.0 : ((double)objectCount / (double)elapsed));
+
+	test.markMap->setMarkMapValid(true);
+	uintptr_t threadCountMaximum = test.extensions->dispatcher->threadCountMaximum();
+	for (uintptr_t threadCount = 1; threadCount <= threadCountMaximum; threadCount *= 2) {
+		startTime = omrtime_hires_clock();
+		test.walkParallel(test.extensions->parallelHeapWalkChunkSize, threadCount);
+		elapsed = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		gcTestEnv->log("heap walk: heap=%zu objects=%zu threads=%zu chunkSize=%zu time=%llu us (%.1f Mobjects/s)\n",
+				test.extensions->heap->getMemorySize(), objectCount, threadCount, test.extensions->parallelHeapWalkChunkSize, elapsed,
+				(0 == elapsed) ? 0.0 : ((double)objectCount / (double)elapsed));
+	}
+
+	test.tearDown();
+}
@@ -0,0 +1,154 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_REALTIME) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "MarkingScheme.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "ParallelGlobalGC.hpp"
+#include "RememberedSetSATB.hpp"
+#include "WorkPacketsSATB.hpp"
+#include "gcTestHelpers.hpp"
+#include "omrgc.h"
+
+#include <gtest/gtest.h>
+
+/* Number of distinct objects recorded by the barrier */
+#define OBJECT_COUNT ((uintptr_t)64)
+/* Stores made between resets of the work packets while timing, few enough that the packets never overflow */
+#define STORES_PER_BATCH ((uintptr_t)4096)
+/* Batches timed for each way of recording */
+#define BATCH_COUNT ((uintptr_t)256)
+
+/**
+ * Return every recorded value to the empty packet list, as an aborted cycle would.
+ */
+static void
+discardRecordedValues(MM_EnvironmentBase *env, MM_RememberedSetSATB *rememberedSet, MM_WorkPacketsSATB *workPackets)
+{
+	rememberedSet->flushBuffer(env);
+	if (workPackets->inUsePacketsAvailable(env)) {
+		workPackets->moveInUseToNonEmpty(env);
+		rememberedSet->flushFragments(env);
+	}
+	workPackets->resetAllPackets(env);
+}
+
+/**
+ * Drive the snapshot at the beginning barrier through OMR_GC_PreObjectStore, checking that it records nothing
+ * while disabled and that values land in the thread's buffer and then in barrier packets while enabled. The
+ * buffered barrier is then timed against storing each value straight into a remembered set fragment.
+ */
+TEST(TestSATBBarrierBuffer, recordAndFlush)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	OMR_VM_Example *exampleVM = &gcTestEnv->exampleVM;
+	ASSERT_EQ(OMR_ERROR_NONE, gcTestEnv->GCHeapSetUp("fvtest/gctest/configuration/satb_barrier_buffer_config.xml"));
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_RememberedSetSATB *rememberedSet = extensions->sATBBarrierRememberedSet;
+	ASSERT_TRUE(NULL != rememberedSet);
+	MM_WorkPacketsSATB *workPackets = (MM_WorkPacketsSATB *)((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getMarkingScheme()->getWorkPackets();
+	uintptr_t bufferSize = extensions->sATBBarrierBufferSize;
+	ASSERT_LT((uintptr_t)0, bufferSize);
+
+	omrobjectptr_t objects[OBJECT_COUNT];
+	for (uintptr_t i = 0; i < OBJECT_COUNT; i++) {
+		MM_ObjectAllocationModel noGc(env, 24, OMR_GC_ALLOCATE_OBJECT_NO_GC);
+		objects[i] = OMR_GC_AllocateObject(exampleVM->_omrVMThread, &noGc);
+		ASSERT_TRUE(NULL != objects[i]);
+	}
+
+	/* outside a concurrent cycle the barrier is disabled */
+	ASSERT_TRUE(rememberedSet->isGlobalFragmentIndexPreserved(env));
+	for (uintptr_t i = 0; i < OBJECT_COUNT; i++) {
+		OMR_GC_PreObjectStore(exampleVM->_omrVMThread, objects[i]);
+	}
+	EXPECT_EQ(env->_sATBBarrierBufferBase, env->_sATBBarrierBufferAlloc);
+	EXPECT_TRUE(workPackets->isAllPacketsEmpty());
+
+	/* enable it, as kickoff does */
+	rememberedSet->restoreGlobalFragmentIndex(env);
+	ASSERT_FALSE(rememberedSet->isGlobalFragmentIndexPreserved(env));
+	OMR_GC_PreObjectStore(exampleVM->_omrVMThread, NULL);
+	EXPECT_EQ(env->_sATBBarrierBufferBase, env->_sATBBarrierBufferAlloc);
+
+	/* a full buffer stays with the thread.. */
+	for (uintptr_t i = 0; i < bufferSize; i++) {
+		OMR_GC_PreObjectStore(exampleVM->_omrVMThread, objects[i % OBJECT_COUNT]);
+	}
+	ASSERT_TRUE(NULL != env->_sATBBarrierBufferBase);
+	EXPECT_EQ(bufferSize, (uintptr_t)(env->_sATBBarrierBufferAlloc - env->_sATBBarrierBufferBase));
+	EXPECT_EQ((uintptr_t)objects[0], env->_sATBBarrierBufferBase[0]);
+	EXPECT_TRUE(workPackets->isAllPacketsEmpty());
+
+	/* ..until the next store hands it to the collector */
+	OMR_GC_PreObjectStore(exampleVM->_omrVMThread, objects[0]);
+	EXPECT_EQ((uintptr_t)1, (uintptr_t)(env->_sATBBarrierBufferAlloc - env->_sATBBarrierBufferBase));
+	EXPECT_FALSE(workPackets->isAllPacketsEmpty());
+	rememberedSet->flushBuffer(env);
+	EXPECT_EQ(env->_sATBBarrierBufferBase, env->_sATBBarrierBufferAlloc);
+	EXPECT_FALSE(extensions->isRememberedSetInOverflowState());
+	discardRecordedValues(env, rememberedSet, workPackets);
+	EXPECT_TRUE(workPackets->isAllPacketsEmpty());
+
+	/* time the buffered barrier, including the flushes it makes.. */
+	uint64_t bufferedTime = 0;
+	for (uintptr_t batch = 0; batch < BATCH_COUNT; batch++) {
+		uint64_t startTime = omrtime_hires_clock();
+		for (uintptr_t i = 0; i < STORES_PER_BATCH; i++) {
+			rememberedSet->preObjectStore(env, objects[i % OBJECT_COUNT]);
+		}
+		rememberedSet->flushBuffer(env);
+		bufferedTime += omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+		discardRecordedValues(env, rememberedSet, workPackets);
+	}
+
+	/* ..against the same stores made straight into a fragment */
+	MM_GCRememberedSetFragment fragment;
+	rememberedSet->initializeFragment(env, &fragment);
+	uint64_t fragmentTime = 0;
+	for (uintptr_t batch = 0; batch < BATCH_COUNT; batch++) {
+		uint64_t startTime = omrtime_hires_clock();
+		for (uintptr_t i = 0; i < STORES_PER_BATCH; i++) {
+			rememberedSet->storeInFragment(env, &fragment, (uintptr_t *)objects[i % OBJECT_COUNT]);
+		}
+		fragmentTime += omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+		discardRecordedValues(env, rememberedSet, workPackets);
+	}
+	EXPECT_FALSE(extensions->isRememberedSetInOverflowState());
+
+	uintptr_t storeCount = BATCH_COUNT * STORES_PER_BATCH;
+	gcTestEnv->log("SATB barrier cost over %zu stores: %.2f ns per store buffered (buffer size %zu), %.2f ns per store into fragments\n",
+			storeCount, (double)bufferedTime / storeCount, bufferSize, (double)fragmentTime / storeCount);
+
+	/* disable it again, as the final collection does */
+	rememberedSet->preserveGlobalFragmentIndex(env);
+	EXPECT_TRUE(workPackets->isAllPacketsEmpty());
+	gcTestEnv->GCHeapTearDown();
+}
+
+#endif /* defined(OMR_GC_REALTIME) && defined(OMR_GC_MODRON_CONCURRENT_MARK) */
@@ -0,0 +1,172 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "SizeClassHistogram.hpp"
+#include "SizeClasses.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+#include <string.h>
+
+static const uintptr_t staticCellSizes[OMR_SIZECLASSES_NUM_SMALL + 1] = SMALL_SIZECLASSES;
+
+/**
+ * Fill a histogram with allocations drawn from a fixed seed.
+ * @param smallBias[in] how strongly sizes are skewed towards small objects, 0 for uniform sizes
+ */
+static void
+fillHistogram(uint64_t *counts, uintptr_t allocations, uintptr_t smallBias, uint32_t seed)
+{
+	memset(counts, 0, OMR_SIZECLASSES_HISTOGRAM_BUCKETS * sizeof(uint64_t));
+	for (uintptr_t i = 0; i < allocations; i++) {
+		seed = (seed * 1103515245u) + 12345u;
+		uintptr_t bucket = 1 + ((seed >> 8) % (OMR_SIZECLASSES_HISTOGRAM_BUCKETS - 1));
+		for (uintptr_t b = 0; b < smallBias; b++) {
+			seed = (seed * 1103515245u) + 12345u;
+			bucket = OMR_MIN(bucket, 1 + ((seed >> 8) % (OMR_SIZECLASSES_HISTOGRAM_BUCKETS - 1)));
+		}
+		counts[bucket] += 1;
+	}
+}
+
+TEST(TestSizeClassHistogram, validateCellSizes)
+{
+	uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+	memcpy(cellSizes, staticCellSizes, sizeof(cellSizes));
+	EXPECT_TRUE(MM_SizeClasses::validateCellSizes(cellSizes));
+
+	cellSizes[3] = cellSizes[2];
+	EXPECT_FALSE(MM_SizeClasses::validateCellSizes(cellSizes));
+
+	memcpy(cellSizes, staticCellSizes, sizeof(cellSizes));
+	cellSizes[3] += 4;
+	EXPECT_FALSE(MM_SizeClasses::validateCellSizes(cellSizes));
+
+	memcpy(cellSizes, staticCellSizes, sizeof(cellSizes));
+	cellSizes[OMR_SIZECLASSES_MIN_SMALL] = sizeof(uintptr_t);
+	EXPECT_FALSE(MM_SizeClasses::validateCellSizes(cellSizes));
+
+	memcpy(cellSizes, staticCellSizes, sizeof(cellSizes));
+	cellSizes[OMR_SIZECLASSES_MAX_SMALL] = OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES - 8;
+	EXPECT_FALSE(MM_SizeClasses::validateCellSizes(cellSizes));
+}
+
+TEST(TestSizeClassHistogram, emptyHistogram)
+{
+	uint64_t counts[OMR_SIZECLASSES_HISTOGRAM_BUCKETS];
+	uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+	memset(counts, 0, sizeof(counts));
+	EXPECT_FALSE(MM_SizeClassHistogram::deriveCellSizes(counts, cellSizes));
+}
+
+TEST(TestSizeClassHistogram, exactFit)
+{
+	/* as many distinct sizes as there are size classes can all be allocated without waste */
+	uint64_t counts[OMR_SIZECLASSES_HISTOGRAM_BUCKETS];
+	uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+	memset(counts, 0, sizeof(counts));
+	for (uintptr_t i = 0; i < OMR_SIZECLASSES_NUM_SMALL; i++) {
+		counts[OMR_SIZECLASSES_HISTOGRAM_BUCKETS - 1 - (i * 13)] = i + 1;
+	}
+	ASSERT_TRUE(MM_SizeClassHistogram::deriveCellSizes(counts, cellSizes));
+	EXPECT_TRUE(MM_SizeClasses::validateCellSizes(cellSizes));
+
+	uint64_t cellBytes = 0;
+	EXPECT_EQ((uint64_t)0, MM_SizeClassHistogram::wastedBytes(counts, cellSizes, &cellBytes));
+	EXPECT_LT((uint64_t)0, MM_SizeClassHistogram::wastedBytes(counts, staticCellSizes, &cellBytes));
+}
+
+TEST(TestSizeClassHistogram, derive)
+{
+	uint64_t counts[OMR_SIZECLASSES_HISTOGRAM_BUCKETS];
+	uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+
+	for (uintptr_t smallBias = 0; smallBias < 4; smallBias++) {
+		fillHistogram(counts, 10000, smallBias, (uint32_t)(12345 + smallBias));
+		ASSERT_TRUE(MM_SizeClassHistogram::deriveCellSizes(counts, cellSizes));
+		EXPECT_TRUE(MM_SizeClasses::validateCellSizes(cellSizes)) << "bias " << smallBias;
+
+		uint64_t derivedCellBytes = 0;
+		uint64_t staticCellBytes = 0;
+		uint64_t derivedWasted = MM_SizeClassHistogram::wastedBytes(counts, cellSizes, &derivedCellBytes);
+		uint64_t staticWasted = MM_SizeClassHistogram::wastedBytes(counts, staticCellSizes, &staticCellBytes);
+		EXPECT_LE(derivedWasted, staticWasted) << "bias " << smallBias;
+		EXPECT_EQ(derivedCellBytes - derivedWasted, staticCellBytes - staticWasted);
+
+		/* moving any one cell boundary can only waste more */
+		for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass < OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+			for (intptr_t delta = -8; delta <= 8; delta += 16) {
+				uintptr_t moved[OMR_SIZECLASSES_NUM_SMALL + 1];
+				memcpy(moved, cellSizes, sizeof(moved));
+				moved[sizeClass] += delta;
+				if (MM_SizeClasses::validateCellSizes(moved)) {
+					uint64_t movedCellBytes = 0;
+					EXPECT_LE(derivedWasted, MM_SizeClassHistogram::wastedBytes(counts, moved, &movedCellBytes)) << "bias " << smallBias << " class " << sizeClass;
+				}
+			}
+		}
+	}
+}
+
+/**
+ * Report the internal fragmentation of the built-in size classes and of the table derived for
+ * several synthetic allocation size distributions.
+ */
+TEST(perfTestSizeClassHistogram, fragmentation)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	const char *workloadNames[] = {"uniform", "small", "very small", "bimodal"};
+	uint64_t counts[OMR_SIZECLASSES_HISTOGRAM_BUCKETS];
+	uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+
+	for (uintptr_t w = 0; w < sizeof(workloadNames) / sizeof(workloadNames[0]); w++) {
+		if (3 == w) {
+			/* a few hot object shapes on top of a uniform background */
+			fillHistogram(counts, 100000, 0, 12345);
+			counts[3] += 400000;
+			counts[5] += 300000;
+			counts[13] += 200000;
+			counts[100] += 50000;
+		} else {
+			fillHistogram(counts, 1000000, w * 2, 12345);
+		}
+
+		uint64_t startTime = omrtime_hires_clock();
+		ASSERT_TRUE(MM_SizeClassHistogram::deriveCellSizes(counts, cellSizes));
+		uint64_t elapsed = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+		uint64_t staticCellBytes = 0;
+		uint64_t derivedCellBytes = 0;
+		uint64_t staticWasted = MM_SizeClassHistogram::wastedBytes(counts, staticCellSizes, &staticCellBytes);
+		uint64_t derivedWasted = MM_SizeClassHistogram::wastedBytes(counts, cellSizes, &derivedCellBytes);
+		EXPECT_LE(derivedWasted, staticWasted);
+		gcTestEnv->log("size classes: workload=%s static fragmentation=%.2f%% derived fragmentation=%.2f%% derive time=%llu us\n",
+				workloadNames[w], 100.0 * (double)staticWasted / (double)staticCellBytes, 100.0 * (double)derivedWasted / (double)derivedCellBytes, elapsed);
+
+		char table[OMR_SIZECLASSES_NUM_SMALL * 8];
+		uintptr_t length = 0;
+		for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+			length += omrstr_printf(table + length, sizeof(table) - length, (OMR_SIZECLASSES_MIN_SMALL == sizeClass) ? "%zu" : ",%zu", cellSizes[sizeClass]);
+		}
+		gcTestEnv->log("size classes: workload=%s -Xgc:sizeClasses=%s\n", workloadNames[w], table);
+	}
+}
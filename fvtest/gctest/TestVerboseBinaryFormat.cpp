@@ -0,0 +1,258 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "VerboseBinaryFormat.hpp"
+#include "VerboseManager.hpp"
+#include "VerboseWriterFileLoggingBinary.hpp"
+#include "VerboseWriterFileLoggingBuffered.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#define BENCHMARK_CYCLES 2000
+/* Time between the cycles of the benchmark, a very high GC frequency */
+#define BENCHMARK_CYCLE_INTERVAL_MILLIS 1
+
+/* The stanzas of one global GC cycle, as the verbose handler flushes them */
+static const char *cycleStanzas[] = {
+	"<exclusive-start id=\"1\" timestamp=\"2026-10-17T04:19:52.853\" intervalms=\"2.098\">\n"
+	"  <response-info timems=\"0.000\" idlems=\"0.000\" threads=\"0\" lastid=\"0000000000000000\" lastname=\"OMR_VMThread [0000000000000000]\" />\n"
+	"</exclusive-start>\n",
+	"<af-start id=\"2\" threadId=\"000055F71D0A90B0\" totalBytesRequested=\"5608\" timestamp=\"2026-10-17T04:19:52.853\" intervalms=\"2.281\" type=\"nursery\" />\n",
+	"<cycle-start id=\"3\" type=\"global\" contextid=\"0\" timestamp=\"2026-10-17T04:19:52.853\" intervalms=\"2.318\" />\n",
+	"<gc-start id=\"4\" type=\"global\" contextid=\"3\" timestamp=\"2026-10-17T04:19:52.853\">\n"
+	"  <mem-info id=\"5\" free=\"0\" total=\"1048576\" percent=\"0\">\n"
+	"    <mem type=\"tenure\" free=\"0\" total=\"1048576\" percent=\"0\" />\n"
+	"  </mem-info>\n"
+	"</gc-start>\n",
+	"<allocation-stats totalBytes=\"1007208\" >\n"
+	"  <allocated-bytes non-tlh=\"0\" tlh=\"1007208\" />\n"
+	"  <largest-consumer threadName=\"OMR_VMThread [000055F71D0A90B0]\" threadId=\"0000000000000000\" bytes=\"1007208\" />\n"
+	"</allocation-stats>\n",
+	"<gc-op id=\"6\" type=\"mark\" timems=\"0.808\" contextid=\"3\" timestamp=\"2026-10-17T04:19:52.854\">\n"
+	"  <trace-info objectcount=\"315\" scancount=\"315\" scanbytes=\"1002600\" />\n"
+	"</gc-op>\n",
+	"<gc-op id=\"7\" type=\"sweep\" timems=\"0.064\" contextid=\"3\" timestamp=\"2026-10-17T04:19:52.854\" />\n",
+	"<gc-end id=\"9\" type=\"global\" contextid=\"3\" durationms=\"1.086\" usertimems=\"0.516\" systemtimems=\"0.516\" stalltimems=\"0.002\" timestamp=\"2026-10-17T04:19:52.854\" activeThreads=\"1\">\n"
+	"  <mem-info id=\"10\" free=\"1090256\" total=\"2097152\" percent=\"51\">\n"
+	"    <mem type=\"tenure\" free=\"1090256\" total=\"2097152\" percent=\"51\" />\n"
+	"  </mem-info>\n"
+	"</gc-end>\n",
+	"<cycle-end id=\"11\" type=\"global\" contextid=\"3\" timestamp=\"2026-10-17T04:19:52.854\" />\n",
+	"<allocation-satisfied id=\"12\" threadId=\"0000000000000000\" bytesRequested=\"5608\" />\n",
+	"<af-end id=\"13\" timestamp=\"2026-10-17T04:19:52.854\" threadId=\"000055F71D0A90B0\" success=\"true\" from=\"tenure\"/>\n",
+	"<exclusive-end id=\"14\" timestamp=\"2026-10-17T04:19:52.854\" durationms=\"1.390\" />\n\n",
+};
+
+#define CYCLE_STANZA_COUNT (sizeof(cycleStanzas) / sizeof(cycleStanzas[0]))
+
+/* Text which exercises every opcode and the cases the encoder must leave alone */
+static const char *edgeCases[] = {
+	"",
+	"<verbosegc xmlns=\"http://www.ibm.com/j9/verbosegc\" version=\"8bcba9a\">\n\n",
+	/* numbers: leading zeroes, the largest that fits in 64 bits and ones that do not */
+	"0 00 007 10 9999999999999999999 18446744073709551615 123456789012345678901234567890",
+	/* names: prefixes of dictionary names, names running into digits, underscores and unknown names */
+	"gc gc-op gc-op-mark gc-op-scavenge- mem1 _id id_ xyzzy af-start-",
+	/* attributes: unknown names, missing quotes and text ending part way through */
+	"<a id=\"1\" unknown=\"2\" id='3' id= \"4\" id=\"",
+	"<a id",
+	" ",
+	"  ",
+	"      <mem ",
+	/* timestamps and addresses: the extremes, and near misses */
+	"2026-10-17T04:19:52.853 0000-00-00T00:00:00.000 9999-99-99T99:99:99.999 2026-10-17T04:19:52.85 2026-10-17 04:19:52.853",
+	"000055F71D0A90B0 FFFFFFFFFFFFFFFF 000055f71d0a90b0 000055F71D0A90B 1234567890123456789",
+	"\t\r\n\x01\x02\x03\x04\x05\x7f\x80\xff",
+};
+
+#define EDGE_CASE_COUNT (sizeof(edgeCases) / sizeof(edgeCases[0]))
+
+static std::vector<uint8_t>
+encodeLog(const char * const *texts, uintptr_t count)
+{
+	std::vector<uint8_t> log(OMR_VERBOSE_BINARY_HEADER_SIZE);
+	MM_VerboseBinaryFormat::writeFileHeader(&log[0]);
+	for (uintptr_t i = 0; i < count; i++) {
+		uintptr_t length = strlen(texts[i]);
+		uintptr_t start = log.size();
+		log.resize(start + MM_VerboseBinaryFormat::maxRecordSize(length));
+		log.resize(start + MM_VerboseBinaryFormat::encodeRecord(texts[i], length, &log[start]));
+	}
+	return log;
+}
+
+static std::string
+decodeLog(const std::vector<uint8_t> &log)
+{
+	intptr_t size = MM_VerboseBinaryFormat::decode(&log[0], log.size(), NULL, 0);
+	if (size <= 0) {
+		return std::string("<malformed>");
+	}
+	std::vector<char> text(size);
+	EXPECT_EQ(size, MM_VerboseBinaryFormat::decode(&log[0], log.size(), &text[0], size));
+	EXPECT_EQ('\0', text[size - 1]);
+	return std::string(&text[0], size - 1);
+}
+
+TEST(TestVerboseBinaryFormat, roundTrip)
+{
+	std::string expected;
+	for (uintptr_t i = 0; i < EDGE_CASE_COUNT; i++) {
+		std::vector<uint8_t> log = encodeLog(&edgeCases[i], 1);
+		EXPECT_EQ(std::string(edgeCases[i]), decodeLog(log)) << "edge case " << i;
+		expected += edgeCases[i];
+	}
+
+	/* a record may end anywhere, even part way through a token */
+	std::vector<uint8_t> log = encodeLog(edgeCases, EDGE_CASE_COUNT);
+	EXPECT_EQ(expected, decodeLog(log));
+
+	std::string cycle;
+	for (uintptr_t i = 0; i < CYCLE_STANZA_COUNT; i++) {
+		cycle += cycleStanzas[i];
+	}
+	log = encodeLog(cycleStanzas, CYCLE_STANZA_COUNT);
+	EXPECT_EQ(cycle, decodeLog(log));
+	/* the dictionary and varints should at least halve typical output */
+	EXPECT_LT(log.size() * 2, cycle.size()) << "encoded " << log.size() << " of " << cycle.size() << " bytes";
+
+	/* a buffer too small for the text is filled, terminated and the full size still returned */
+	char small[16];
+	EXPECT_EQ((intptr_t)cycle.size() + 1, MM_VerboseBinaryFormat::decode(&log[0], log.size(), small, sizeof(small)));
+	EXPECT_EQ(cycle.substr(0, sizeof(small) - 1), std::string(small));
+}
+
+TEST(TestVerboseBinaryFormat, malformed)
+{
+	std::vector<uint8_t> log = encodeLog(cycleStanzas, CYCLE_STANZA_COUNT);
+
+	/* not a binary log */
+	const char *xml = "<?xml version=\"1.0\" ?>";
+	EXPECT_FALSE(MM_VerboseBinaryFormat::isBinaryLog((const uint8_t *)xml, strlen(xml)));
+	EXPECT_EQ(-1, MM_VerboseBinaryFormat::decode((const uint8_t *)xml, strlen(xml), NULL, 0));
+
+	/* a newer version */
+	std::vector<uint8_t> newer(log);
+	newer[OMR_VERBOSE_BINARY_HEADER_SIZE - 1] += 1;
+	EXPECT_EQ(-1, MM_VerboseBinaryFormat::decode(&newer[0], newer.size(), NULL, 0));
+
+	/* truncated anywhere but at a record boundary */
+	uintptr_t boundaries = 0;
+	for (uintptr_t size = OMR_VERBOSE_BINARY_HEADER_SIZE; size < log.size(); size++) {
+		if (-1 != MM_VerboseBinaryFormat::decode(&log[0], size, NULL, 0)) {
+			boundaries += 1;
+		}
+	}
+	EXPECT_EQ(CYCLE_STANZA_COUNT, boundaries);
+
+	/* an opcode that is not printable text */
+	std::vector<uint8_t> bad(log.begin(), log.begin() + OMR_VERBOSE_BINARY_HEADER_SIZE);
+	bad.push_back(1);
+	bad.push_back(0x08);
+	EXPECT_EQ(-1, MM_VerboseBinaryFormat::decode(&bad[0], bad.size(), NULL, 0));
+}
+
+/**
+ * Time the reporting thread's cost of writing verbose output with the buffered and binary file writers,
+ * and the cost of getting it all to file when the stream is closed. Cycles are output at intervals, as
+ * GCs would, which gives the drain thread of the binary writer time to keep up.
+ */
+TEST(perfTestVerboseWriterBinary, overhead)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	OMR_VM_Example *exampleVM = &gcTestEnv->exampleVM;
+	const char *writerNames[] = {"buffered", "binary"};
+
+	ASSERT_EQ(OMR_ERROR_NONE, gcTestEnv->GCHeapSetUp("fvtest/gctest/configuration/global_GC_config.xml", false));
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+	MM_VerboseManager *manager = MM_VerboseManager::newInstance(env, exampleVM->_omrVM);
+	ASSERT_TRUE(NULL != manager);
+
+	uint64_t frequency = omrtime_hires_frequency();
+	std::vector<uint64_t> latencies(BENCHMARK_CYCLES * CYCLE_STANZA_COUNT);
+	for (uintptr_t w = 0; w < sizeof(writerNames) / sizeof(writerNames[0]); w++) {
+		char fileName[64];
+		omrstr_printf(fileName, sizeof(fileName), "VerboseGC-perfTestVerboseWriter_%s_%d.log", writerNames[w], omrsysinfo_get_pid());
+		MM_VerboseWriter *writer = NULL;
+		if (0 == w) {
+			writer = MM_VerboseWriterFileLoggingBuffered::newInstance(env, manager, fileName, 0, 0);
+		} else {
+			writer = MM_VerboseWriterFileLoggingBinary::newInstance(env, manager, fileName, 0, 0);
+		}
+		ASSERT_TRUE(NULL != writer) << writerNames[w];
+
+		uint64_t outputTime = 0;
+		uintptr_t index = 0;
+		for (uintptr_t cycle = 0; cycle < BENCHMARK_CYCLES; cycle++) {
+			uint64_t cycleStart = omrtime_hires_clock();
+			for (uintptr_t i = 0; i < CYCLE_STANZA_COUNT; i++) {
+				uint64_t stanzaStart = omrtime_hires_clock();
+				writer->outputString(env, cycleStanzas[i]);
+				latencies[index++] = omrtime_hires_clock() - stanzaStart;
+			}
+			writer->endOfCycle(env);
+			outputTime += omrtime_hires_delta(cycleStart, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			omrthread_sleep(BENCHMARK_CYCLE_INTERVAL_MILLIS);
+		}
+		uint64_t closeStart = omrtime_hires_clock();
+		writer->closeStream(env);
+		uint64_t closeTime = omrtime_hires_delta(closeStart, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		writer->kill(env);
+
+		std::sort(latencies.begin(), latencies.end());
+		int64_t fileSize = omrfile_length(fileName);
+		gcTestEnv->log("verbose writer: writer=%s stanzas=%zu output=%llu us (%.0f ns/stanza) p50=%llu ns p99=%llu ns max=%llu ns close=%llu us file=%lld bytes\n",
+				writerNames[w], latencies.size(), outputTime, (double)outputTime * 1000.0 / (double)latencies.size(),
+				latencies[latencies.size() / 2] * 1000000000 / frequency,
+				latencies[(latencies.size() * 99) / 100] * 1000000000 / frequency,
+				latencies.back() * 1000000000 / frequency,
+				closeTime, fileSize);
+
+		if (1 == w) {
+			/* the binary log must convert back to exactly what the buffered writer wrote */
+			uintptr_t length = 0;
+			char *text = MM_VerboseBinaryFormat::readAsXML(gcTestEnv->getPortLibrary(), fileName, &length);
+			ASSERT_TRUE(NULL != text);
+			char bufferedName[64];
+			omrstr_printf(bufferedName, sizeof(bufferedName), "VerboseGC-perfTestVerboseWriter_%s_%d.log", writerNames[0], omrsysinfo_get_pid());
+			EXPECT_EQ((uint64_t)omrfile_length(bufferedName), (uint64_t)length);
+			intptr_t fd = omrfile_open(bufferedName, EsOpenRead, 0);
+			ASSERT_NE(-1, fd);
+			std::vector<char> buffered(length + 1);
+			EXPECT_EQ((intptr_t)length, omrfile_read(fd, &buffered[0], (intptr_t)length));
+			omrfile_close(fd);
+			EXPECT_EQ(0, memcmp(text, &buffered[0], length));
+			omrmem_free_memory(text);
+			omrfile_unlink(bufferedName);
+			omrfile_unlink(fileName);
+		}
+	}
+
+	manager->kill(env);
+	gcTestEnv->GCHeapTearDown();
+}
@@ -0,0 +1,235 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "VerboseManager.hpp"
+#include "VerboseWriterFileLoggingBuffered.hpp"
+#include "VerboseWriterFileLoggingMapped.hpp"
+#include "gcTestHelpers.hpp"
+#include "pugixml.hpp"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string.h>
+#include <vector>
+
+#define BENCHMARK_CYCLES 2000
+/* Time between the cycles of the benchmark, a very high GC frequency */
+#define BENCHMARK_CYCLE_INTERVAL_MILLIS 1
+
+/* The stanzas of one global GC cycle, as the verbose handler flushes them */
+static const char *cycleStanzas[] = {
+	"<exclusive-start id=\"1\" timestamp=\"2026-10-17T04:19:52.853\" intervalms=\"2.098\">\n"
+	"  <response-info timems=\"0.000\" idlems=\"0.000\" threads=\"0\" lastid=\"0000000000000000\" lastname=\"OMR_VMThread [0000000000000000]\" />\n"
+	"</exclusive-start>\n",
+	"<cycle-start id=\"3\" type=\"global\" contextid=\"0\" timestamp=\"2026-10-17T04:19:52.853\" intervalms=\"2.318\" />\n",
+	"<gc-start id=\"4\" type=\"global\" contextid=\"3\" timestamp=\"2026-10-17T04:19:52.853\">\n"
+	"  <mem-info id=\"5\" free=\"0\" total=\"1048576\" percent=\"0\">\n"
+	"    <mem type=\"tenure\" free=\"0\" total=\"1048576\" percent=\"0\" />\n"
+	"  </mem-info>\n"
+	"</gc-start>\n",
+	"<gc-op id=\"6\" type=\"mark\" timems=\"0.808\" contextid=\"3\" timestamp=\"2026-10-17T04:19:52.854\">\n"
+	"  <trace-info objectcount=\"315\" scancount=\"315\" scanbytes=\"1002600\" />\n"
+	"</gc-op>\n",
+	"<gc-op id=\"7\" type=\"sweep\" timems=\"0.064\" contextid=\"3\" timestamp=\"2026-10-17T04:19:52.854\" />\n",
+	"<gc-end id=\"9\" type=\"global\" contextid=\"3\" durationms=\"1.086\" usertimems=\"0.516\" systemtimems=\"0.516\" stalltimems=\"0.002\" timestamp=\"2026-10-17T04:19:52.854\" activeThreads=\"1\">\n"
+	"  <mem-info id=\"10\" free=\"1090256\" total=\"2097152\" percent=\"51\">\n"
+	"    <mem type=\"tenure\" free=\"1090256\" total=\"2097152\" percent=\"51\" />\n"
+	"  </mem-info>\n"
+	"</gc-end>\n",
+	"<cycle-end id=\"11\" type=\"global\" contextid=\"3\" timestamp=\"2026-10-17T04:19:52.854\" />\n",
+	"<exclusive-end id=\"14\" timestamp=\"2026-10-17T04:19:52.854\" durationms=\"1.390\" />\n\n",
+};
+
+#define CYCLE_STANZA_COUNT (sizeof(cycleStanzas) / sizeof(cycleStanzas[0]))
+
+class MappedWriterTest
+{
+public:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	MM_VerboseManager *manager;
+
+	bool
+	setUp()
+	{
+		exampleVM = &gcTestEnv->exampleVM;
+		if (OMR_ERROR_NONE != gcTestEnv->GCHeapSetUp("fvtest/gctest/configuration/global_GC_config.xml", false)) {
+			return false;
+		}
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+		manager = MM_VerboseManager::newInstance(env, exampleVM->_omrVM);
+		if (NULL == manager) {
+			return false;
+		}
+		/* rotating writers output an initialized stanza at the top of each new file */
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+		manager->setInitializedTime(omrtime_hires_clock());
+		return true;
+	}
+
+	void
+	tearDown()
+	{
+		manager->kill(env);
+		gcTestEnv->GCHeapTearDown();
+	}
+};
+
+static std::vector<char>
+readFile(const char *fileName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	std::vector<char> contents;
+	int64_t length = omrfile_length(fileName);
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+	if ((length > 0) && (-1 != fd)) {
+		contents.resize((size_t)length);
+		EXPECT_EQ((intptr_t)length, omrfile_read(fd, &contents[0], (intptr_t)length));
+	}
+	if (-1 != fd) {
+		omrfile_close(fd);
+	}
+	return contents;
+}
+
+/**
+ * Write cycles through the smallest mapped files, so that each file is grown several times, rotating
+ * through a ring of two files until the first is reused. Every file must end up a well formed log.
+ */
+TEST(TestVerboseWriterMapped, growAndRotate)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	const uintptr_t files = 2;
+	const uintptr_t cyclesPerFile = 4;
+	const uintptr_t cycles = 10;
+
+	MappedWriterTest test;
+	ASSERT_TRUE(test.setUp());
+	MM_GCExtensionsBase *extensions = test.env->getExtensions();
+	uintptr_t fileSize = extensions->mappedLogFileSize;
+	extensions->mappedLogFileSize = OMR_VERBOSE_MAPPED_MINIMUM_FILE_SIZE;
+
+	char fileName[64];
+	omrstr_printf(fileName, sizeof(fileName), "VerboseGC-TestVerboseWriterMapped_%d.log", omrsysinfo_get_pid());
+	MM_VerboseWriterFileLoggingMapped *writer = MM_VerboseWriterFileLoggingMapped::newInstance(test.env, test.manager, fileName, files, cyclesPerFile);
+	ASSERT_TRUE(NULL != writer);
+	for (uintptr_t cycle = 0; cycle < cycles; cycle++) {
+		for (uintptr_t i = 0; i < CYCLE_STANZA_COUNT; i++) {
+			writer->outputString(test.env, cycleStanzas[i]);
+		}
+		writer->endOfCycle(test.env);
+	}
+	writer->closeStream(test.env);
+	EXPECT_LT((uintptr_t)0, writer->getRemapCount());
+	writer->kill(test.env);
+	extensions->mappedLogFileSize = fileSize;
+
+	/* the first file was reused for the last cycles, the second holds a full set */
+	const uintptr_t expectedCycles[] = {cycles % cyclesPerFile, cyclesPerFile};
+	const char *footer = "</verbosegc>\n\n";
+	for (uintptr_t file = 0; file < files; file++) {
+		char logName[80];
+		omrstr_printf(logName, sizeof(logName), "%s.%03zu", fileName, file + 1);
+		std::vector<char> contents = readFile(logName);
+		ASSERT_LT(strlen(footer), contents.size()) << logName;
+		/* truncated to what was written, with no trailing unused mapping */
+		EXPECT_EQ(0, memcmp(&contents[contents.size() - strlen(footer)], footer, strlen(footer))) << logName;
+
+		pugi::xml_document doc;
+		pugi::xml_parse_result result = doc.load_buffer(&contents[0], contents.size());
+		ASSERT_TRUE(result) << logName << ": " << result.description();
+		EXPECT_EQ(expectedCycles[file], doc.select_nodes("/verbosegc/cycle-start").size()) << logName;
+		EXPECT_EQ(expectedCycles[file] * 2, doc.select_nodes("/verbosegc/gc-op").size()) << logName;
+		/* both files were opened by a rotation */
+		EXPECT_EQ((size_t)1, doc.select_nodes("/verbosegc/initialized").size()) << logName;
+		omrfile_unlink(logName);
+	}
+
+	test.tearDown();
+}
+
+/**
+ * Time the reporting thread's cost of writing verbose output with the buffered and mapped file writers,
+ * and the cost of getting it all to file when the stream is closed.
+ */
+TEST(perfTestVerboseWriterMapped, overhead)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	const char *writerNames[] = {"buffered", "mapped"};
+
+	MappedWriterTest test;
+	ASSERT_TRUE(test.setUp());
+
+	uint64_t frequency = omrtime_hires_frequency();
+	std::vector<uint64_t> latencies(BENCHMARK_CYCLES * CYCLE_STANZA_COUNT);
+	std::vector<char> bufferedContents;
+	for (uintptr_t w = 0; w < sizeof(writerNames) / sizeof(writerNames[0]); w++) {
+		char fileName[64];
+		omrstr_printf(fileName, sizeof(fileName), "VerboseGC-perfTestVerboseWriterMapped_%s_%d.log", writerNames[w], omrsysinfo_get_pid());
+		MM_VerboseWriter *writer = NULL;
+		if (0 == w) {
+			writer = MM_VerboseWriterFileLoggingBuffered::newInstance(test.env, test.manager, fileName, 0, 0);
+		} else {
+			writer = MM_VerboseWriterFileLoggingMapped::newInstance(test.env, test.manager, fileName, 0, 0);
+		}
+		ASSERT_TRUE(NULL != writer) << writerNames[w];
+
+		uint64_t outputTime = 0;
+		uintptr_t index = 0;
+		for (uintptr_t cycle = 0; cycle < BENCHMARK_CYCLES; cycle++) {
+			uint64_t cycleStart = omrtime_hires_clock();
+			for (uintptr_t i = 0; i < CYCLE_STANZA_COUNT; i++) {
+				uint64_t stanzaStart = omrtime_hires_clock();
+				writer->outputString(test.env, cycleStanzas[i]);
+				latencies[index++] = omrtime_hires_clock() - stanzaStart;
+			}
+			writer->endOfCycle(test.env);
+			outputTime += omrtime_hires_delta(cycleStart, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			omrthread_sleep(BENCHMARK_CYCLE_INTERVAL_MILLIS);
+		}
+		uint64_t closeStart = omrtime_hires_clock();
+		writer->closeStream(test.env);
+		uint64_t closeTime = omrtime_hires_delta(closeStart, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		writer->kill(test.env);
+
+		std::sort(latencies.begin(), latencies.end());
+		std::vector<char> contents = readFile(fileName);
+		gcTestEnv->log("verbose writer: writer=%s stanzas=%zu output=%llu us (%.0f ns/stanza) p50=%llu ns p99=%llu ns max=%llu ns close=%llu us file=%zu bytes\n",
+				writerNames[w], latencies.size(), outputTime, (double)outputTime * 1000.0 / (double)latencies.size(),
+				latencies[latencies.size() / 2] * 1000000000 / frequency,
+				latencies[(latencies.size() * 99) / 100] * 1000000000 / frequency,
+				latencies.back() * 1000000000 / frequency,
+				closeTime, contents.size());
+
+		/* the mapped log must be exactly what the buffered writer wrote */
+		if (0 == w) {
+			bufferedContents = contents;
+		} else {
+			EXPECT_TRUE(bufferedContents == contents);
+		}
+		omrfile_unlink(fileName);
+	}
+
+	test.tearDown();
+}
@@ -0,0 +1,334 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "MarkingScheme.hpp"
+#include "Packet.hpp"
+#include "PacketList.hpp"
+#include "ParallelDispatcher.hpp"
+#include "ParallelGlobalGC.hpp"
+#include "ParallelTask.hpp"
+#include "WorkPackets.hpp"
+#include "WorkStack.hpp"
+#include "gcTestHelpers.hpp"
+#include "omrgc.h"
+#include "omrmodroncore.h"
+
+#include <gtest/gtest.h>
+#include <string.h>
+
+/* Every root pushed expands into a binary tree of elements this deep, popped and pushed like objects being marked */
+#define ELEMENT_TREE_DEPTH 6
+
+/**
+ * What the threads of a trace saw, each thread adding to its own, padded to keep the threads off each other's cache lines.
+ */
+struct TraceTotals {
+	uintptr_t elements;
+	uintptr_t elementSum;
+	uintptr_t packetListLockAcquires;
+	uintptr_t packetListExchangeFailures;
+	uintptr_t workPacketsCached;
+	uint8_t padding[256 - (5 * sizeof(uintptr_t))];
+};
+
+static MMINLINE uintptr_t
+encodeElement(uintptr_t root, uintptr_t depth)
+{
+	/* slot aligned and never NULL, like the object pointers on real work stacks */
+	return ((root * (ELEMENT_TREE_DEPTH + 1)) + depth + 1) * sizeof(uintptr_t);
+}
+
+/**
+ * Push roots and trace a tree of elements from each through the work stacks of the GC threads,
+ * as a marking task traces objects through work packets.
+ */
+class MM_WorkPacketTraceTask : public MM_ParallelTask
+{
+private:
+	MM_WorkPackets *_workPackets;
+	TraceTotals *_totals;
+	uintptr_t _rootsPerThread;
+	volatile uintptr_t _nextThreadIndex; /**< hands out the roots, as worker IDs need not be contiguous when fewer threads than the maximum run */
+
+	/**
+	 * Count an element and push its two children, unless it is a leaf.
+	 */
+	MMINLINE void
+	traceElement(MM_EnvironmentBase *env, MM_WorkStack *workStack, TraceTotals *totals, uintptr_t element)
+	{
+		totals->elements += 1;
+		totals->elementSum += element;
+		uintptr_t index = (element / sizeof(uintptr_t)) - 1;
+		uintptr_t depth = index % (ELEMENT_TREE_DEPTH + 1);
+		if (depth < ELEMENT_TREE_DEPTH) {
+			uintptr_t child = encodeElement(index / (ELEMENT_TREE_DEPTH + 1), depth + 1);
+			workStack->push(env, (void *)child, (void *)child);
+		}
+	}
+
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_MARK; };
+
+	virtual void
+	run(MM_EnvironmentBase *env)
+	{
+		TraceTotals *totals = &_totals[env->getWorkerID()];
+		MM_WorkStack *workStack = env->getWorkStack();
+		env->_workPacketStats.clear();
+		workStack->reset(env, _workPackets);
+
+		/* trace about a tree per root pushed, so the outstanding work stays well within the packets available */
+		uintptr_t threadCount = getThreadCount();
+		uintptr_t threadIndex = MM_AtomicOperations::add(&_nextThreadIndex, 1) - 1;
+		for (uintptr_t i = 0; i < _rootsPerThread; i++) {
+			workStack->push(env, (void *)encodeElement((i * threadCount) + threadIndex, 0));
+			for (uintptr_t j = 0; j < ((uintptr_t)2 << ELEMENT_TREE_DEPTH); j++) {
+				uintptr_t element = (uintptr_t)workStack->popNoWait(env);
+				if (0 == element) {
+					break;
+				}
+				traceElement(env, workStack, totals, element);
+			}
+		}
+
+		uintptr_t element = 0;
+		while (0 != (element = (uintptr_t)workStack->pop(env))) {
+			traceElement(env, workStack, totals, element);
+		}
+		workStack->flush(env);
+
+		totals->packetListLockAcquires = env->_workPacketStats.packetListLockAcquires;
+		totals->packetListExchangeFailures = env->_workPacketStats.packetListExchangeFailures;
+		totals->workPacketsCached = env->_workPacketStats.workPacketsCached;
+	}
+
+	MM_WorkPacketTraceTask(MM_EnvironmentBase *env, MM_WorkPackets *workPackets, TraceTotals *totals, uintptr_t rootsPerThread)
+		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
+		, _workPackets(workPackets)
+		, _totals(totals)
+		, _rootsPerThread(rootsPerThread)
+		, _nextThreadIndex(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+class WorkPacketListsTest
+{
+public:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	MM_GCExtensionsBase *extensions;
+	MM_WorkPackets *workPackets;
+	TraceTotals *totals;
+	uintptr_t totalsCount;
+
+	bool
+	setUp(const char *configFile)
+	{
+		exampleVM = &gcTestEnv->exampleVM;
+		totals = NULL;
+		if (OMR_ERROR_NONE != gcTestEnv->GCHeapSetUp(configFile)) {
+			return false;
+		}
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+		extensions = env->getExtensions();
+		workPackets = ((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getMarkingScheme()->getWorkPackets();
+
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+		totalsCount = extensions->dispatcher->threadCountMaximum();
+		totals = (TraceTotals *)omrmem_allocate_memory(totalsCount * sizeof(TraceTotals), OMRMEM_CATEGORY_MM);
+		return NULL != totals;
+	}
+
+	void
+	tearDown()
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+		omrmem_free_memory(totals);
+		gcTestEnv->GCHeapTearDown();
+	}
+
+	/**
+	 * Trace the element trees of the given number of roots per thread, and check that every element was popped exactly once.
+	 * @return the totals of all threads
+	 */
+	TraceTotals
+	trace(uintptr_t rootsPerThread, uintptr_t threadCount)
+	{
+		memset(totals, 0, totalsCount * sizeof(TraceTotals));
+		workPackets->reset(env);
+		MM_WorkPacketTraceTask traceTask(env, workPackets, totals, rootsPerThread);
+		extensions->dispatcher->run(env, &traceTask, threadCount);
+
+		TraceTotals sum;
+		memset(&sum, 0, sizeof(sum));
+		for (uintptr_t i = 0; i < totalsCount; i++) {
+			sum.elements += totals[i].elements;
+			sum.elementSum += totals[i].elementSum;
+			sum.packetListLockAcquires += totals[i].packetListLockAcquires;
+			sum.packetListExchangeFailures += totals[i].packetListExchangeFailures;
+			sum.workPacketsCached += totals[i].workPacketsCached;
+		}
+
+		uintptr_t roots = rootsPerThread * threadCount;
+		uintptr_t expectedElements = 0;
+		uintptr_t expectedSum = 0;
+		for (uintptr_t root = 0; root < roots; root++) {
+			for (uintptr_t depth = 0; depth <= ELEMENT_TREE_DEPTH; depth++) {
+				expectedElements += (uintptr_t)1 << depth;
+				expectedSum += ((uintptr_t)1 << depth) * encodeElement(root, depth);
+			}
+		}
+		EXPECT_EQ(expectedElements, sum.elements) << "roots=" << rootsPerThread << " threads=" << threadCount;
+		EXPECT_EQ(expectedSum, sum.elementSum) << "roots=" << rootsPerThread << " threads=" << threadCount;
+		EXPECT_TRUE(workPackets->isAllPacketsEmpty()) << "roots=" << rootsPerThread << " threads=" << threadCount;
+		return sum;
+	}
+};
+
+TEST(TestWorkPacketLists, packetList)
+{
+	WorkPacketListsTest test;
+	ASSERT_TRUE(test.setUp("fvtest/gctest/configuration/work_packet_lists_lock_free_config.xml"));
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+
+	const uintptr_t packetCount = 16;
+	const uintptr_t slotsInPacket = 4;
+	MM_Packet *packets = (MM_Packet *)omrmem_allocate_memory(packetCount * sizeof(MM_Packet), OMRMEM_CATEGORY_MM);
+	MM_Packet **packetTable = (MM_Packet **)omrmem_allocate_memory(packetCount * sizeof(MM_Packet *), OMRMEM_CATEGORY_MM);
+	uintptr_t *slots = (uintptr_t *)omrmem_allocate_memory(packetCount * slotsInPacket * sizeof(uintptr_t), OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE((NULL != packets) && (NULL != packetTable) && (NULL != slots));
+	for (uintptr_t i = 0; i < packetCount; i++) {
+		packetTable[i] = new(&packets[i]) MM_Packet();
+		packetTable[i]->initialize(test.env, NULL, NULL, slots + (i * slotsInPacket), slotsInPacket, i);
+	}
+
+	for (uintptr_t lockFree = 0; lockFree < 2; lockFree++) {
+		MM_PacketList list(test.env);
+		ASSERT_TRUE(list.initialize(test.env, (0 == lockFree) ? NULL : packetTable));
+		EXPECT_EQ(0 != lockFree, list.isLockFree());
+		EXPECT_TRUE(list.isEmpty());
+		EXPECT_TRUE(NULL == list.pop(test.env));
+
+		for (uintptr_t i = 0; i < packetCount; i++) {
+			list.push(test.env, packetTable[i]);
+		}
+		EXPECT_EQ(packetCount, list.getCount());
+
+		/* all packets come back exactly once from popList, then from getHead and pop */
+		MM_Packet *head = NULL;
+		MM_Packet *tail = NULL;
+		uintptr_t count = 0;
+		ASSERT_TRUE(list.popList(&head, &tail, &count));
+		EXPECT_EQ(packetCount, count);
+		EXPECT_TRUE(list.isEmpty());
+		uintptr_t seen = 0;
+		for (MM_Packet *packet = head; packet != tail->_next; packet = packet->_next) {
+			seen |= (uintptr_t)1 << (packet - packets);
+		}
+		EXPECT_EQ(((uintptr_t)1 << packetCount) - 1, seen);
+		EXPECT_FALSE(list.popList(&head, &tail, &count));
+
+		list.pushList(packetTable[0], packetTable[0], 1);
+		list.push(test.env, packetTable[1]);
+		EXPECT_TRUE(NULL != list.getHead());
+		EXPECT_EQ((uintptr_t)2, list.getCount());
+		seen = 0;
+		MM_Packet *packet = NULL;
+		while (NULL != (packet = list.pop(test.env))) {
+			seen |= (uintptr_t)1 << (packet - packets);
+		}
+		EXPECT_EQ((uintptr_t)3, seen);
+		EXPECT_TRUE(list.isEmpty());
+
+		list.tearDown(test.env);
+	}
+
+	omrmem_free_memory(slots);
+	omrmem_free_memory(packetTable);
+	omrmem_free_memory(packets);
+	test.tearDown();
+}
+
+TEST(TestWorkPacketLists, trace)
+{
+	const char *configFiles[] = {
+		"fvtest/gctest/configuration/work_packet_lists_locked_config.xml",
+		"fvtest/gctest/configuration/work_packet_lists_lock_free_config.xml"
+	};
+
+	for (uintptr_t c = 0; c < sizeof(configFiles) / sizeof(configFiles[0]); c++) {
+		WorkPacketListsTest test;
+		ASSERT_TRUE(test.setUp(configFiles[c]));
+		bool lockFree = test.extensions->workPacketLockFreeLists;
+		EXPECT_EQ(0 != c, lockFree);
+
+		for (uintptr_t threadCount = 1; threadCount <= test.totalsCount; threadCount++) {
+			/* from no work at all to enough to cycle every packet many times over */
+			const uintptr_t rootCounts[] = {0, 1, 1000, 20000};
+			for (uintptr_t r = 0; r < sizeof(rootCounts) / sizeof(rootCounts[0]); r++) {
+				TraceTotals sum = test.trace(rootCounts[r], threadCount);
+				if (lockFree) {
+					EXPECT_EQ((uintptr_t)0, sum.packetListLockAcquires);
+				} else {
+					EXPECT_EQ((uintptr_t)0, sum.packetListExchangeFailures);
+					EXPECT_EQ((uintptr_t)0, sum.workPacketsCached);
+				}
+			}
+		}
+
+		test.tearDown();
+	}
+}
+
+/**
+ * Time traces through locked and lock-free packet lists with increasing numbers of GC threads.
+ */
+TEST(perfTestWorkPacketLists, threads)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	const char *configFiles[] = {
+		"fvtest/gctest/configuration/work_packet_lists_locked_perf_config.xml",
+		"fvtest/gctest/configuration/work_packet_lists_lock_free_perf_config.xml"
+	};
+	const uintptr_t rootCount = 200000;
+
+	for (uintptr_t c = 0; c < sizeof(configFiles) / sizeof(configFiles[0]); c++) {
+		WorkPacketListsTest test;
+		ASSERT_TRUE(test.setUp(configFiles[c]));
+
+		for (uintptr_t threadCount = 1; threadCount <= test.totalsCount; threadCount *= 2) {
+			uint64_t startTime = omrtime_hires_clock();
+			TraceTotals sum = test.trace(rootCount / threadCount, threadCount);
+			uint64_t elapsed = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			gcTestEnv->log("work packet trace: lists=%s threads=%zu elements=%zu time=%llu us lock_acquires=%zu exchange_failures=%zu cached=%zu\n",
+					test.extensions->workPacketLockFreeLists ? "lock-free" : "locked", threadCount, sum.elements, elapsed,
+					sum.packetListLockAcquires, sum.packetListExchangeFailures, sum.workPacketsCached);
+		}
+
+		test.tearDown();
+	}
+}
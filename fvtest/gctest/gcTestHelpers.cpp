@@ -20,6 +20,8 @@
  *******************************************************************************/
 
 #include "gcTestHelpers.hpp"
+#include "StartupManagerTestExample.hpp"
+#include "omrgc.h"
 #if defined(OMR_OS_WINDOWS)
 /* windows.h defined uintptr_t.  Ignore its definition */
 #define UDATA UDATA_win_
@@ -93,6 +95,33 @@ GCTestEnvironment::GCTestTearDown()
 
 }
 
+omr_error_t
+GCTestEnvironment::GCHeapSetUp(const char *configFile, bool startDispatcherThreads)
+{
+	MM_StartupManagerTestExample startupManager(exampleVM._omrVM, configFile);
+	omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM._omrVM, &startupManager);
+	if (OMR_ERROR_NONE == rc) {
+		rc = OMR_Thread_Init(exampleVM._omrVM, NULL, &exampleVM._omrVMThread, "OMRTestThread");
+	}
+	if ((OMR_ERROR_NONE == rc) && startDispatcherThreads) {
+		rc = OMR_GC_InitializeDispatcherThreads(exampleVM._omrVMThread);
+		dispatcherThreadsStarted = (OMR_ERROR_NONE == rc);
+	}
+	return rc;
+}
+
+void
+GCTestEnvironment::GCHeapTearDown()
+{
+	if (dispatcherThreadsStarted) {
+		EXPECT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownDispatcherThreads(exampleVM._omrVMThread));
+		dispatcherThreadsStarted = false;
+	}
+	EXPECT_EQ(OMR_ERROR_NONE, OMR_Thread_Free(exampleVM._omrVMThread));
+	exampleVM._omrVMThread = NULL;
+	EXPECT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM._omrVM));
+}
+
 void
 printMemUsed(const char *where, OMRPortLibrary *portLib)
 {
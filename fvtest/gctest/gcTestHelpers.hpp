@@ -43,6 +43,7 @@ public:
 	OMR_VM_Example exampleVM;
 	std::vector<const char *> params;
 	bool keepLog;
+	bool dispatcherThreadsStarted;
 
 	/*
 	 * Function members
@@ -58,9 +59,16 @@ public:
 	void GCTestSetUp();
 	void GCTestTearDown();
 
+	/*
+	 * Bring up the heap and collector for a single test from the given configuration, attach the test thread
+	 * and, optionally, start the dispatcher threads. GCHeapTearDown() undoes all of it.
+	 */
+	omr_error_t GCHeapSetUp(const char *configFile, bool startDispatcherThreads = true);
+	void GCHeapTearDown();
+
 public:
 	GCTestEnvironment(int argc, char **argv)
-	: BaseEnvironment(argc, argv), keepLog(false)
+	: BaseEnvironment(argc, argv), keepLog(false), dispatcherThreadsStarted(false)
 	{
 	}
 };
@@ -57,6 +57,19 @@ public:
 		VM_AtomicSupport::nop();
 	}
 
+	/**
+	 * If the compiler supports it, hint the CPU to start loading the cache line holding the given address for reading.
+	 * The address does not have to be valid.
+	 * @param address[in] the address to prefetch
+	 */
+	MMINLINE_DEBUG static void
+	prefetchRead(const void *address)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch(address, 0, 3);
+#endif /* defined(__GNUC__) || defined(__clang__) */
+	}
+
 	/**
 	 * @Deprecated use the readWriteBarrier
 	 */
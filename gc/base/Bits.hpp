@@ -67,6 +67,10 @@ public:
 	 */
 	MMINLINE static uintptr_t populationCount(uintptr_t input)
 	{
+#if defined(__GNUC__) && (defined(__POPCNT__) || defined(__aarch64__))
+		/* a single instruction on targets which have one */
+		return (uintptr_t)__builtin_popcountll((unsigned long long)input);
+#else /* defined(__GNUC__) && (defined(__POPCNT__) || defined(__aarch64__)) */
 		uintptr_t work, temp;
 
 		work = input;
@@ -92,6 +96,7 @@ public:
 		work = work + (work << 32);
 		return work >> 56;
 #endif /* !defined(OMR_ENV_DATA64) */
+#endif /* defined(__GNUC__) && (defined(__POPCNT__) || defined(__aarch64__)) */
 	}
 
 #if defined(OMR_OS_WINDOWS) && !defined(OMR_ENV_DATA64)
@@ -133,7 +138,7 @@ public:
 #pragma warning(default:4035) /* re-enable warning */
 #endif /* defined(OMR_OS_WINDOWS) */
 
-#elif defined(LINUX) && defined(J9HAMMER)
+#elif defined(__GNUC__)
 	/**
 	 * Return the number of bits set to 0 before the first bit set to one starting at the lowest
 	 * significant bit.
@@ -142,9 +147,8 @@ public:
 	 */
 	MMINLINE static uintptr_t leadingZeroes(uintptr_t input)
 	{
-		uintptr_t result;
-		asm volatile(" bsfq %1, %0": "=r"(result): "rm"(input) );
-		return result;
+		/* bsf/tzcnt on x86, rbit and clz on aarch64 */
+		return (uintptr_t)__builtin_ctzll((unsigned long long)input);
 	}
 
 	/**
@@ -155,17 +159,10 @@ public:
 	 */
 	MMINLINE static uintptr_t trailingZeroes(uintptr_t input)
 	{
-		uintptr_t result;
-		asm volatile(
-				" bsrq %1, %0;"
-				" neg %0;"
-				" add %2, %0;"
-				: "=r"(result)
-				: "rm"(input), "g"(J9BITS_BITS_IN_SLOT - 1) );
-		return result;
+		return (uintptr_t)__builtin_clzll((unsigned long long)input) - (64 - J9BITS_BITS_IN_SLOT);
 	}
 
-#else /* defined(LINUX) && defined(J9HAMMER) */
+#else /* defined(__GNUC__) */
 
 
 	/**
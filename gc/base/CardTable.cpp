@@ -32,11 +32,49 @@
 #include "HeapRegionManager.hpp"
 #include "MemoryManager.hpp"
 #include "HeapRegionDescriptor.hpp"
+#include "Math.hpp"
 #include "ParallelDispatcher.hpp"
 #include "Task.hpp"
 
 #include "ModronAssertions.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CARD_SCAN_VECTOR_SIZE 32
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define CARD_SCAN_VECTOR_SIZE 16
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define CARD_SCAN_VECTOR_SIZE 16
+#else /* no vector unit */
+#define CARD_SCAN_VECTOR_SIZE sizeof(uintptr_t)
+#endif /* __AVX2__ */
+
+/* Non-clean cards are cleared in blocks of this many cards, so that scattered dirty cards in one cache line are cleared together */
+#define CARD_CLEAR_BLOCK_SIZE 64
+
+/**
+ * Check whether a vector of cards are all clean. CARD_CLEAN is 0, so this is a test for all bits being zero.
+ * @param[in] cards The first card of the vector, aligned to CARD_SCAN_VECTOR_SIZE
+ * @return true if all CARD_SCAN_VECTOR_SIZE cards are clean
+ */
+static MMINLINE bool
+areCardsClean(Card *cards)
+{
+#if defined(__AVX2__)
+	__m256i vector = _mm256_load_si256((__m256i *)cards);
+	return 0 != _mm256_testz_si256(vector, vector);
+#elif defined(__SSE2__) || defined(_M_X64)
+	__m128i vector = _mm_load_si128((__m128i *)cards);
+	return 0xFFFF == _mm_movemask_epi8(_mm_cmpeq_epi8(vector, _mm_setzero_si128()));
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+	return 0 == vmaxvq_u8(vld1q_u8((uint8_t *)cards));
+#else /* no vector unit */
+	return (uintptr_t)CARD_CLEAN == *(uintptr_t *)cards;
+#endif /* __AVX2__ */
+}
+
 bool
 MM_CardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 {
@@ -301,18 +339,16 @@ MM_CardTable::cardAddrToHeapAddr(MM_EnvironmentBase *env, Card *cardAddr)
 MMINLINE void
 MM_CardTable::cleanRange(MM_EnvironmentBase *env, MM_CardCleaner *cardCleaner, Card *low, Card *high)
 {
-	Card *thisCard = low;
 	Card *endCard = high;
 	uintptr_t cardsCleaned = 0;
+	Card *thisCard = findNextNonCleanCard(low, endCard);
 	while (thisCard < endCard) {
-		if (CARD_CLEAN != *thisCard) {
-			void *lowAddress = (void *)cardAddrToHeapAddr(env, thisCard);
-			void *highAddress = (void *)((uintptr_t)lowAddress + CARD_SIZE);
-			
-			cardCleaner->clean(env, lowAddress, highAddress, thisCard);
-			cardsCleaned += 1;
-		}
-		thisCard += 1;
+		void *lowAddress = (void *)cardAddrToHeapAddr(env, thisCard);
+		void *highAddress = (void *)((uintptr_t)lowAddress + CARD_SIZE);
+
+		cardCleaner->clean(env, lowAddress, highAddress, thisCard);
+		cardsCleaned += 1;
+		thisCard = findNextNonCleanCard(thisCard + 1, endCard);
 	}
 	env->_cardCleaningStats._cardsCleaned += cardsCleaned;
 }
@@ -369,6 +405,43 @@ MM_CardTable::cleanCardsInRegion(MM_EnvironmentBase *env, MM_CardCleaner *cardCl
 	env->popVMstate(oldVMState);
 }
 
+Card *
+MM_CardTable::findNextNonCleanCard(Card *card, Card *endCard)
+{
+	/* Check cards one at a time up to the first vector boundary */
+	while ((card < endCard) && (CARD_CLEAN == *card) && (0 != ((uintptr_t)card % CARD_SCAN_VECTOR_SIZE))) {
+		card += 1;
+	}
+
+	if ((card < endCard) && (CARD_CLEAN == *card)) {
+		/* Skip whole vectors of clean cards; the last vector may be incomplete so leave it for the card at a time scan */
+		Card *lastVector = (Card *)MM_Math::roundToFloor(CARD_SCAN_VECTOR_SIZE, (uintptr_t)endCard);
+		while ((card < lastVector) && areCardsClean(card)) {
+			card += CARD_SCAN_VECTOR_SIZE;
+		}
+
+		/* Either the range is done, or the non-clean card is within the next CARD_SCAN_VECTOR_SIZE cards */
+		while ((card < endCard) && (CARD_CLEAN == *card)) {
+			card += 1;
+		}
+	}
+
+	return card;
+}
+
+void
+MM_CardTable::clearCards(Card *card, Card *endCard)
+{
+	card = findNextNonCleanCard(card, endCard);
+	while (card < endCard) {
+		/* Clear to the end of the block holding the non-clean card, then look for the next one */
+		Card *clearTop = (Card *)MM_Math::roundToCeiling(CARD_CLEAR_BLOCK_SIZE, (uintptr_t)(card + 1));
+		clearTop = OMR_MIN(clearTop, endCard);
+		memset((void *)card, CARD_CLEAN, clearTop - card);
+		card = findNextNonCleanCard(clearTop, endCard);
+	}
+}
+
 uintptr_t
 MM_CardTable::clearCardsInRange(MM_EnvironmentBase *env, void* heapBase, void* heapTop)
 {
@@ -378,10 +451,7 @@ MM_CardTable::clearCardsInRange(MM_EnvironmentBase *env, void* heapBase, void* h
 	Card *lastCard = heapAddrToCardAddr(env,heapTop);
 	uintptr_t sizeToClear = (uint8_t *)lastCard - (uint8_t *)firstCard;
 
-	/* We can't use OMRZeroMemory() here as that requires the  area to
-	 * be cleared to be uintptr_t aligned
-	 */
-	memset((void *)firstCard, 0, sizeToClear);
+	clearCards(firstCard, lastCard);
 
 	return sizeToClear;
 }
@@ -152,6 +152,23 @@ public:
 	 */
 	uintptr_t clearCardsInRange(MM_EnvironmentBase *env, void *heapBase, void *heapTop);
 
+	/**
+	 * Find the first card in the given range which is not clean. The card table is expected to be mostly clean,
+	 * so runs of clean cards are skipped a vector register (or a uintptr_t, if there is no vector unit) at a time.
+	 * @param[in] card The first card to check
+	 * @param[in] endCard The card immediately after the last card to check
+	 * @return The first card which is not CARD_CLEAN, or endCard if all cards in the range are clean
+	 */
+	static Card *findNextNonCleanCard(Card *card, Card *endCard);
+
+	/**
+	 * Clears (sets to CARD_CLEAN) the given range of cards. Only the parts of the range which hold
+	 * non-clean cards are written, so clearing a mostly clean card table does not dirty its cache lines.
+	 * @param[in] card The first card to clear
+	 * @param[in] endCard The card immediately after the last card to clear
+	 */
+	static void clearCards(Card *card, Card *endCard);
+
 	/**
 	 * Called to request that that the CardTable for specified heap range be cleaned.
 	 * This multi-threaded version must be executed under Parallel Task only
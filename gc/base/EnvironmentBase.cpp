@@ -151,6 +151,15 @@ MM_EnvironmentBase::tearDown(MM_GCExtensionsBase *extensions)
 	}
 #endif /* OMR_GC_SEGREGATED_HEAP */
 
+#if defined(OMR_GC_REALTIME)
+	if (NULL != _sATBBarrierBufferBase) {
+		getForge()->free(_sATBBarrierBufferBase);
+		_sATBBarrierBufferBase = NULL;
+		_sATBBarrierBufferAlloc = NULL;
+		_sATBBarrierBufferTop = NULL;
+	}
+#endif /* OMR_GC_REALTIME */
+
 	if(NULL != _objectAllocationInterface) {
 		_objectAllocationInterface->kill(this);
 		_objectAllocationInterface = NULL;
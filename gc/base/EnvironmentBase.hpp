@@ -163,6 +163,11 @@ public:
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SegregatedAllocationTracker* _allocationTracker; /**< tracks bytes allocated per thread and periodically flushes allocation data to MM_MemoryPoolSegregated */
 #endif /* OMR_GC_SEGREGATED_HEAP */
+#if defined(OMR_GC_REALTIME)
+	uintptr_t *_sATBBarrierBufferBase; /**< thread local buffer of references recorded by the snapshot at the beginning barrier, allocated on first use */
+	uintptr_t *_sATBBarrierBufferAlloc; /**< next free entry in the snapshot at the beginning barrier buffer */
+	uintptr_t *_sATBBarrierBufferTop; /**< end of the snapshot at the beginning barrier buffer */
+#endif /* OMR_GC_REALTIME */
 
 	volatile uint32_t _allocationColor; /**< Flag field to indicate whether premarking is enabled on the thread */
 
@@ -739,6 +744,11 @@ public:
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		,_allocationTracker(NULL)
 #endif /* OMR_GC_SEGREGATED_HEAP */
+#if defined(OMR_GC_REALTIME)
+		,_sATBBarrierBufferBase(NULL)
+		,_sATBBarrierBufferAlloc(NULL)
+		,_sATBBarrierBufferTop(NULL)
+#endif /* OMR_GC_REALTIME */
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		,_hotFieldCopyDepthCount(0)
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
@@ -796,6 +806,11 @@ public:
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		,_allocationTracker(NULL)
 #endif /* OMR_GC_SEGREGATED_HEAP */
+#if defined(OMR_GC_REALTIME)
+		,_sATBBarrierBufferBase(NULL)
+		,_sATBBarrierBufferAlloc(NULL)
+		,_sATBBarrierBufferTop(NULL)
+#endif /* OMR_GC_REALTIME */
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		,_hotFieldCopyDepthCount(0)
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
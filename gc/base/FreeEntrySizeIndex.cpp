@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "spacesaving.h"
+
+#include "FreeEntrySizeIndex.hpp"
+#include "LargeObjectAllocateStats.hpp"
+
+void
+MM_FreeEntrySizeIndex::setBounds(const uintptr_t *sizes, uintptr_t count)
+{
+	_bounds[0] = 0;
+	_bucketCount = 1;
+	for (uintptr_t i = 0; i < count; i++) {
+		/* insertion sort, dropping duplicates and whatever no longer fits at the top */
+		uintptr_t size = sizes[i];
+		uintptr_t position = _bucketCount;
+		while (_bounds[position - 1] > size) {
+			position -= 1;
+		}
+		if ((_bounds[position - 1] != size) && (position < OMR_FREE_ENTRY_SIZE_INDEX_BUCKETS)) {
+			uintptr_t last = OMR_MIN(_bucketCount, OMR_FREE_ENTRY_SIZE_INDEX_BUCKETS - 1);
+			for (uintptr_t j = last; j > position; j--) {
+				_bounds[j] = _bounds[j - 1];
+			}
+			_bounds[position] = size;
+			_bucketCount = last + 1;
+		}
+	}
+	clear();
+}
+
+void
+MM_FreeEntrySizeIndex::setBounds(MM_LargeObjectAllocateStats *stats, uintptr_t minimumSize)
+{
+	uintptr_t sizes[OMR_FREE_ENTRY_SIZE_INDEX_BUCKETS - 1];
+	uintptr_t count = 0;
+
+	/* half of the buckets at most go to the sizes actually allocated most often */
+	OMRSpaceSaving *frequentSizes = stats->getSpaceSavingSizesAveragePercent();
+	if (NULL != frequentSizes) {
+		uintptr_t frequentCount = OMR_MIN(spaceSavingGetCurSize(frequentSizes), OMR_FREE_ENTRY_SIZE_INDEX_BUCKETS / 2);
+		for (uintptr_t k = 1; k <= frequentCount; k++) {
+			sizes[count] = (uintptr_t)spaceSavingGetKthMostFreq(frequentSizes, k);
+			count += 1;
+		}
+	}
+
+	/* spread the remaining buckets evenly over the size classes a free entry can fall in */
+	uintptr_t firstSizeClass = stats->getSizeClassIndex(minimumSize);
+	uintptr_t sizeClassCount = stats->getMaxSizeClasses() - firstSizeClass;
+	uintptr_t remaining = OMR_FREE_ENTRY_SIZE_INDEX_BUCKETS - 1 - count;
+	uintptr_t stride = OMR_MAX((sizeClassCount + remaining - 1) / remaining, 1);
+	for (uintptr_t sizeClass = firstSizeClass; (sizeClass < stats->getMaxSizeClasses()) && (count < (OMR_FREE_ENTRY_SIZE_INDEX_BUCKETS - 1)); sizeClass += stride) {
+		sizes[count] = stats->getSizeClassSizes(sizeClass);
+		count += 1;
+	}
+
+	setBounds(sizes, count);
+}
+
+void
+MM_FreeEntrySizeIndex::clear()
+{
+	for (uintptr_t bucket = 0; bucket < OMR_FREE_ENTRY_SIZE_INDEX_BUCKETS; bucket++) {
+		_entries[bucket] = NULL;
+		_sizes[bucket] = 0;
+	}
+}
+
+void
+MM_FreeEntrySizeIndex::exhausted(uintptr_t size, MM_HeapLinkedFreeHeader *tail, uintptr_t maximumSize, MM_HeapLinkedFreeHeader *freeListHead)
+{
+	/* nothing on the list fits this request, so nothing fits any larger one either */
+	for (uintptr_t bucket = getBucket(size); bucket < _bucketCount; bucket++) {
+		if (!isValid(bucket, freeListHead) || (_entries[bucket] < tail)) {
+			_entries[bucket] = tail;
+			_sizes[bucket] = maximumSize;
+		}
+	}
+}
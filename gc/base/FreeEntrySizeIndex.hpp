@@ -0,0 +1,203 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(FREEENTRYSIZEINDEX_HPP_)
+#define FREEENTRYSIZEINDEX_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "BaseNonVirtual.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+
+class MM_LargeObjectAllocateStats;
+
+/* The most size buckets an index keeps */
+#define OMR_FREE_ENTRY_SIZE_INDEX_BUCKETS 32
+
+/**
+ * Size bucketed starting points into an address ordered free list.
+ * For each bucket the index remembers a free entry such that no free entry at or below it is larger than a
+ * recorded size, so a first fit search for anything larger can start right after it instead of at the list head.
+ * A search that fails records the tail of the list for its bucket and all larger ones, making repeated failures cheap.
+ * The index never walks the list itself: the owning pool reports what its searches learned and which entries it
+ * splits or removes, and clears the index whenever the list changes in any other way.
+ * @ingroup GC_Base_Core
+ */
+class MM_FreeEntrySizeIndex : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	uintptr_t _bounds[OMR_FREE_ENTRY_SIZE_INDEX_BUCKETS]; /**< smallest request size of each bucket, ascending with _bounds[0] == 0 */
+	MM_HeapLinkedFreeHeader *_entries[OMR_FREE_ENTRY_SIZE_INDEX_BUCKETS]; /**< free entry to search from for each bucket, or NULL */
+	uintptr_t _sizes[OMR_FREE_ENTRY_SIZE_INDEX_BUCKETS]; /**< no free entry up to and including the bucket's entry is larger than this */
+	uintptr_t _bucketCount;
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	/**
+	 * @return true if the bucket holds an entry that is still on the list and has not grown since it was recorded
+	 */
+	MMINLINE bool
+	isValid(uintptr_t bucket, MM_HeapLinkedFreeHeader *freeListHead)
+	{
+		MM_HeapLinkedFreeHeader *entry = _entries[bucket];
+		/* entries below the head were taken off the front of the list by TLH allocation */
+		return (NULL != entry) && (NULL != freeListHead) && (entry >= freeListHead) && (entry->getSize() <= _sizes[bucket]);
+	}
+
+protected:
+public:
+	/**
+	 * Replace the bucket boundaries, clearing the index.
+	 * @param sizes[in] candidate boundaries, in any order and possibly repeated. 0 is always added.
+	 * @param count[in] number of candidates; the largest are dropped once there are more than the index can hold
+	 */
+	void setBounds(const uintptr_t *sizes, uintptr_t count);
+
+	/**
+	 * Derive the bucket boundaries from allocation statistics: the most frequent large allocation sizes each start
+	 * a bucket, so requests of those exact sizes find precise starting points, and the statistics' own size classes
+	 * above the minimum free entry size fill in the rest.
+	 * @param stats[in] the large object allocation statistics of the owning pool
+	 * @param minimumSize[in] the smallest free entry the pool keeps on its list
+	 */
+	void setBounds(MM_LargeObjectAllocateStats *stats, uintptr_t minimumSize);
+
+	/**
+	 * Forget every starting point. The boundaries are kept.
+	 */
+	void clear();
+
+	/**
+	 * @return the bucket holding requests of the given size
+	 */
+	MMINLINE uintptr_t
+	getBucket(uintptr_t size)
+	{
+		uintptr_t low = 0;
+		uintptr_t high = _bucketCount;
+		while ((high - low) > 1) {
+			uintptr_t middle = (low + high) / 2;
+			if (_bounds[middle] <= size) {
+				low = middle;
+			} else {
+				high = middle;
+			}
+		}
+		return low;
+	}
+
+	MMINLINE uintptr_t getBucketCount() { return _bucketCount; }
+	MMINLINE uintptr_t getBound(uintptr_t bucket) { return _bounds[bucket]; }
+
+	/**
+	 * Find where a first fit search for the given size may start.
+	 * @param size[in] the size in bytes being searched for
+	 * @param freeListHead[in] the current head of the free list
+	 * @param maximumSize[out] the largest any free entry up to and including the returned one can be, if one is returned
+	 * @return a free entry too small for the request to be used as the predecessor of the search, or NULL to start at the head
+	 */
+	MMINLINE MM_HeapLinkedFreeHeader *
+	find(uintptr_t size, MM_HeapLinkedFreeHeader *freeListHead, uintptr_t *maximumSize)
+	{
+		MM_HeapLinkedFreeHeader *start = NULL;
+		uintptr_t bucket = getBucket(size);
+		/* anything recorded for the bucket below is smaller than every request of this one, but check anyway */
+		uintptr_t lowestBucket = (0 == bucket) ? 0 : bucket - 1;
+		for (uintptr_t candidate = lowestBucket; candidate <= bucket; candidate++) {
+			if (isValid(candidate, freeListHead) && (_sizes[candidate] < size) && (_entries[candidate] > start)) {
+				start = _entries[candidate];
+				*maximumSize = _sizes[candidate];
+			}
+		}
+		return start;
+	}
+
+	/**
+	 * Record what a successful search learned.
+	 * @param size[in] the size in bytes that was searched for
+	 * @param entry[in] the free entry before the one that satisfied the search
+	 * @param maximumSize[in] the largest free entry up to and including entry, below size
+	 * @param freeListHead[in] the current head of the free list
+	 */
+	MMINLINE void
+	update(uintptr_t size, MM_HeapLinkedFreeHeader *entry, uintptr_t maximumSize, MM_HeapLinkedFreeHeader *freeListHead)
+	{
+		uintptr_t bucket = getBucket(size);
+		if (!isValid(bucket, freeListHead) || (_entries[bucket] < entry)) {
+			_entries[bucket] = entry;
+			_sizes[bucket] = maximumSize;
+		}
+	}
+
+	/**
+	 * Record that a search walked to the end of the list without finding a large enough entry.
+	 * @param size[in] the size in bytes that was searched for
+	 * @param tail[in] the last free entry on the list
+	 * @param maximumSize[in] the largest free entry on the list, below size
+	 * @param freeListHead[in] the current head of the free list
+	 */
+	void exhausted(uintptr_t size, MM_HeapLinkedFreeHeader *tail, uintptr_t maximumSize, MM_HeapLinkedFreeHeader *freeListHead);
+
+	/**
+	 * Follow a free entry that was split or taken off the list. Either way every free entry at or below the
+	 * replacement is no larger than the original was.
+	 * @param oldEntry[in] the free entry that is gone
+	 * @param newEntry[in] the remainder of the split entry, or the free entry preceding a removed one (NULL if it was the head)
+	 */
+	MMINLINE void
+	replace(MM_HeapLinkedFreeHeader *oldEntry, MM_HeapLinkedFreeHeader *newEntry)
+	{
+		for (uintptr_t bucket = 0; bucket < _bucketCount; bucket++) {
+			if (oldEntry == _entries[bucket]) {
+				_entries[bucket] = newEntry;
+			}
+		}
+	}
+
+	/**
+	 * Create a FreeEntrySizeIndex object with a single bucket.
+	 */
+	MM_FreeEntrySizeIndex()
+		: MM_BaseNonVirtual()
+		, _bucketCount(1)
+	{
+		_typeId = __FUNCTION__;
+		_bounds[0] = 0;
+		clear();
+	}
+};
+
+#endif /* FREEENTRYSIZEINDEX_HPP_ */
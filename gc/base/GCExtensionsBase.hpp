@@ -29,6 +29,9 @@
 #include "mmprivatehook_internal.h"
 #include "modronbase.h"
 #include "omr.h"
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#include "sizeclasses.h"
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 #include "AllocationStats.hpp"
 #include "ArrayObjectModel.hpp"
@@ -253,6 +256,7 @@ public:
 	/* Temporary move from the leaf implementation */
 	bool concurrentSweep;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
+	bool lazySweep; /**< Leave most of the tenure sweep to allocating threads rather than completing it in the global GC pause */
 
 	bool largePageWarnOnError;
 	bool largePageFailOnError;
@@ -275,6 +279,7 @@ public:
 #endif /* OMR_GC_MODRON_SCAVENGER */
 #if defined(OMR_GC_REALTIME)
 	MM_RememberedSetSATB* sATBBarrierRememberedSet; /**< The snapshot at the beginning barrier remembered set used for the write barrier */
+	uintptr_t sATBBarrierBufferSize; /**< Number of entries in each thread's local snapshot at the beginning barrier buffer */
 #endif /* defined(OMR_GC_REALTIME) */
 	ModronLnrlOptions lnrlOptions;
 
@@ -306,6 +311,7 @@ public:
 	uintptr_t largeObjectAllocationProfilingVeryLargeObjectSizeClass; /**< index of sizeClass for minimum veryLargeEntry*/
 	uint32_t largeObjectAllocationProfilingSizeClassRatio; /**< ratio of lower and upper boundary of a size class in large object allocation profiling */
 	uint32_t largeObjectAllocationProfilingTopK; /**< number of most allocation size we want to track/report in large object allocation profiling */
+	bool freeListSizeIndex; /**< Search address ordered free lists from a size bucketed index rather than from allocation hints */
 	MM_FreeEntrySizeClassStats freeEntrySizeClassStatsSimulated; /**< snapshot of free memory status used for simulated allocator for fragmentation estimation */
 	uintptr_t freeMemoryProfileMaxSizeClasses; /**< maximum number of sizeClass maintained for heap free memory profile (computed from SizeClassRatio) */
 
@@ -326,6 +332,8 @@ public:
 	uintptr_t tlhMaximumSize;
 	uintptr_t tlhInitialSize;
 	uintptr_t tlhIncrementSize;
+	bool tlhAdaptiveSizing; /**< Size each TLH refresh from the allocation rate of its thread rather than growing it by tlhIncrementSize */
+	uintptr_t tlhAdaptiveRefreshInterval; /**< Microseconds of allocation an adaptively sized TLH is meant to last */
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 
@@ -360,6 +368,7 @@ public:
 
 	bool disableExplicitGC;
 	uintptr_t heapAlignment;
+	uintptr_t parallelHeapWalkChunkSize; /**< Size of the chunks of the heap handed out to GC threads by parallel heap walks */
 	uintptr_t absoluteMinimumOldSubSpaceSize;
 	uintptr_t absoluteMinimumNewSubSpaceSize;
 
@@ -383,6 +392,9 @@ public:
 
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool workPacketLockFreeLists; /**< True to make the shared work packet lists lock-free stacks instead of locked lists */
+	bool workPacketCache; /**< True to keep an empty work packet per thread for its next output packet */
+	uintptr_t workPacketOverflowSpillSize; /**< bytes per GC thread to hold overflowed work packet items before resorting to a heap rescan, 0 to always rescan */
 
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
@@ -441,6 +453,7 @@ public:
 	bool gcThreadCountForced; /**< true if number of GC threads is specified in java options. Currently we have a few ways to do this:
 										-Xgcthreads		-Xthreads= (RT only)	-XthreadCount= */
 	uintptr_t dispatcherHybridNotifyThreadBound; /** Bound for determining hybrid notification type (Individual notifies for count < MIN(bound, maxThreads/2), otherwise notify_all) */
+	uintptr_t dispatcherWorkerSpinCount; /**< Iterations a worker thread spins for the next task after completing one before it parks (0 to park immediately) */
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	enum ScavengerScanOrdering {
@@ -470,6 +483,7 @@ public:
 	uintptr_t scvTenureRatioLow;
 	uintptr_t scvTenureFixedTenureAge; /**< The tenure age to use for the Fixed scavenger tenure strategy. */
 	uintptr_t scvTenureAdaptiveTenureAge; /**< The tenure age to use for the Adaptive scavenger tenure strategy. */
+	double scvTenureAdaptiveSurvivorOccupancy; /**< If not 0.0, the Adaptive scavenger tenure strategy picks the tenure age that keeps the projected survivor space occupancy under this fraction (0.0 to 1.0), rather than stepping it between scvTenureRatioLow and scvTenureRatioHigh. */
 	double scvTenureStrategySurvivalThreshold; /**< The survival threshold (from 0.0 to 1.0) used for deciding to tenure particular ages. */
 	bool scvTenureStrategyFixed; /**< Flag for enabling the Fixed scavenger tenure strategy. */
 	bool scvTenureStrategyAdaptive; /**< Flag for enabling the Adaptive scavenger tenure strategy. */
@@ -478,6 +492,13 @@ public:
 	bool scavengerEnabled;
 	bool scavengerRsoScanUnsafe;
 	uintptr_t cacheListSplit; /**< the number of ways to split scanCache lists, set by -XXgc:cacheListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool scavengerNumaAwareCopy; /**< if true, copy caches are taken from free lists and bound to memory on the NUMA node of the copying thread */
+	bool scavengerWorkStealing; /**< if true, GC threads keep scan caches in private deques that idle threads steal from, rather than on the shared scan lists */
+	uintptr_t scavengerScanDequeSize; /**< capacity of each GC thread's scan cache deque; caches beyond it go to the shared scan lists */
+	uintptr_t scavengerSlotBatchSize; /**< if greater than 1, object slots are gathered in batches of this many (at most OMR_SCAVENGER_SLOT_BATCH_MAX) and their referents prefetched before being forwarded */
+	bool scavengerAdaptiveCacheSize; /**< if true, the upper bound on copy/scan cache sizes is adjusted after each scavenge from the observed copy/scan ratio and scan stall time */
+	uintptr_t scavengerAdaptiveCacheSizeStallThreshold; /**< percentage of GC thread time stalled for scan work above which the adaptive cache size controller shrinks caches */
+	uintptr_t scavengerRememberedSetChunkSize; /**< if not zero, GC threads claim the remembered set in chunks of this many entries rather than a puddle at a time */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	bool softwareRangeCheckReadBarrier; /**< enable software read barrier instead of hardware guarded loads when running with CS */
 	bool concurrentScavenger; /**< CS enabled/disabled flag */
@@ -523,6 +544,7 @@ public:
 	float adaptiveThreadingSensitivityFactor; /**<  Used by Adaptive Model to determine sensitivity/tolerance to stalling, higher number translates to less stall being tolerated (set through adaptiveThreadingSensitivityFactor=) */
 	float adaptiveThreadingWeightActiveThreads; /**< Weight given to current active threads when averaging projected threads with current active threads (set through adaptiveThreadingWeightActiveThreads=) */
 	float adaptiveThreadBooster; /**< Used to boost calculated thread count, gives opportunity for low thread count to grow. */
+	uintptr_t scavengerPauseTarget; /**< Scavenge pause time target in milliseconds, from which the thread count of each Scavenge is chosen to fit its expected work (0 to disable) */
 	/* End of variables relating to Adaptive Threading */
 
 	enum HeapInitializationSplitHeapSection {
@@ -558,6 +580,7 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	bool compactUsingSummaryTable; /**< slide objects to addresses computed from a per page summary of live bytes instead of recording forwarding pointers while moving */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	bool payAllocationTax;
@@ -571,6 +594,8 @@ public:
 	uintptr_t concurrentLevel;
 	uintptr_t concurrentBackground;
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
+	bool concurrentKickoffForecast; /**< True to kick off concurrent mark from forecast allocation and concurrent trace rates instead of a fixed threshold buffer */
+	uintptr_t concurrentKickoffForecastMargin; /**< number of bytes a forecast kickoff aims to leave free when concurrent mark completes */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
 
@@ -651,6 +676,8 @@ public:
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SizeClasses* defaultSizeClasses;
+	uintptr_t sizeClassCellSizes[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< Cell sizes to use instead of the built-in size class table (index 0 unused), all 0 for the built-in table */
+	bool sizeClassHistogram; /**< Record a histogram of small allocation sizes and report a size class table derived from it at shutdown */
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 #if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
@@ -675,7 +702,9 @@ public:
 	uintptr_t allocationCacheMaximumSize;
 	uintptr_t allocationCacheInitialSize;
 	uintptr_t allocationCacheIncrementSize;
+	uintptr_t allocationCacheMagazineSize; /**< Number of allocation cache replenishes a thread pre-allocates at once (segregated heap), 0 to pre-allocate each replenish on demand */
 	bool nonDeterministicSweep;
+	bool backgroundSweep; /**< Leave small regions of the segregated heap to a background sweeper thread rather than sweeping them in the global GC pause */
 /* OMR_GC_REALTIME (in for all) */
 
 	MM_ConfigurationOptions configurationOptions; /**< holds the options struct, used during startup for selecting a Configuration */
@@ -687,6 +716,9 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool binaryLogging; /**< Enabled by -Xgc:binaryLogging.  Write verbose:gc logs in the compact binary format from a background thread */
+	bool mappedLogging; /**< Enabled by -Xgc:mappedLogging.  Write verbose:gc logs by copying into memory mapped files */
+	uintptr_t mappedLogFileSize; /**< Set by -Xgc:mappedLogFileSize=.  Size memory mapped log files are mapped at, and grown by when full */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -824,6 +856,10 @@ public:
 	uintptr_t darkMatterSampleRate;/**< the weight of darkMatterSample for standard gc, default:32, if the weight = 0, disable darkMatterSampling */
 
 	bool pretouchHeapOnExpand; /**< True to pretouch memory during initial heap inflation or heap expansion */
+	bool deferredHeapDecommit; /**< True to decommit memory removed by heap contraction on a background thread rather than in the GC pause */
+	bool heapDecommitLazyFree; /**< True to release decommitted heap memory lazily (MADV_FREE) where supported. Lazily freed pages are not guaranteed to read as zero when committed again */
+	uintptr_t heapDecommitBatchSize; /**< Bytes decommitted or pre-faulted at a time by the background heap commit thread */
+	bool heapPrecommit; /**< True to commit and pre-fault the next expected heap expansion on a background thread */
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 	uintptr_t idleMinimumFree;   /**< percentage of free heap to be retained as committed, default=0 for gencon, complete tenture free memory will be decommitted */
@@ -1396,6 +1432,7 @@ public:
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 		, concurrentSweep(false)
 #endif /* OMR_GC_CONCURRENT_SWEEP */
+		, lazySweep(false)
 		, largePageWarnOnError(false)
 		, largePageFailOnError(false)
 		, largePageFailedToSatisfy(false)
@@ -1416,6 +1453,7 @@ public:
 #endif /* OMR_GC_MODRON_SCAVENGER */
 #if defined(OMR_GC_REALTIME)
 		, sATBBarrierRememberedSet(NULL)
+		, sATBBarrierBufferSize(256)
 #endif /* defined(OMR_GC_REALTIME) */
 		, heapBaseForBarrierRange0(NULL)
 		, heapSizeForBarrierRange0(0)
@@ -1438,6 +1476,7 @@ public:
 		, largeObjectAllocationProfilingVeryLargeObjectSizeClass(0)
 		, largeObjectAllocationProfilingSizeClassRatio(120)
 		, largeObjectAllocationProfilingTopK(8)
+		, freeListSizeIndex(false)
 		, freeMemoryProfileMaxSizeClasses(0)
 		, gcExclusiveAccessThreadId(NULL)
 		, gcExclusiveAccessMutex(NULL)
@@ -1452,6 +1491,8 @@ public:
 		, tlhMaximumSize(131072)
 		, tlhInitialSize(2048)
 		, tlhIncrementSize(4096)
+		, tlhAdaptiveSizing(false)
+		, tlhAdaptiveRefreshInterval(1000)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
 		, allocationStats()
@@ -1476,6 +1517,7 @@ public:
 #endif /* OMR_GC_LARGE_OBJECT_AREA */
 		, disableExplicitGC(false)
 		, heapAlignment(HEAP_ALIGNMENT)
+		, parallelHeapWalkChunkSize(1024 * 1024)
 		, absoluteMinimumOldSubSpaceSize(MINIMUM_OLD_SPACE_SIZE)
 		, absoluteMinimumNewSubSpaceSize(MINIMUM_NEW_SPACE_SIZE)
 		, darkMatterCompactThreshold((float)0.15)
@@ -1495,6 +1537,9 @@ public:
 		, useGCStartupHints(true)
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
+		, workPacketLockFreeLists(false)
+		, workPacketCache(false)
+		, workPacketOverflowSpillSize(0)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, rootScannerStatsEnabled(false)
@@ -1542,6 +1587,7 @@ public:
 		, gcThreadCount(0)
 		, gcThreadCountForced(false)
 		, dispatcherHybridNotifyThreadBound(16)
+		, dispatcherWorkerSpinCount(0)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		, scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_NONE)
 		/* Start of options relating to dynamicBreadthFirstScanOrdering */
@@ -1565,6 +1611,7 @@ public:
 		, scvTenureRatioLow(OMR_SCV_TENURE_RATIO_LOW)
 		, scvTenureFixedTenureAge(OBJECT_HEADER_AGE_MAX)
 		, scvTenureAdaptiveTenureAge(0)
+		, scvTenureAdaptiveSurvivorOccupancy(0.0)
 		, scvTenureStrategySurvivalThreshold(0.99)
 		, scvTenureStrategyFixed(false)
 		, scvTenureStrategyAdaptive(true)
@@ -1573,6 +1620,13 @@ public:
 		, scavengerEnabled(false)
 		, scavengerRsoScanUnsafe(false)
 		, cacheListSplit(0)
+		, scavengerNumaAwareCopy(false)
+		, scavengerWorkStealing(false)
+		, scavengerScanDequeSize(1024)
+		, scavengerSlotBatchSize(0)
+		, scavengerAdaptiveCacheSize(false)
+		, scavengerAdaptiveCacheSizeStallThreshold(5)
+		, scavengerRememberedSetChunkSize(0)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, softwareRangeCheckReadBarrier(false)
 		, concurrentScavenger(false)
@@ -1616,6 +1670,7 @@ public:
 		, adaptiveThreadingSensitivityFactor(1.0f)
 		, adaptiveThreadingWeightActiveThreads(0.50f)
 		, adaptiveThreadBooster(0.85f)
+		, scavengerPauseTarget(0)
 		, splitHeapSection(HEAP_INITIALIZATION_SPLIT_HEAP_UNKNOWN)
 #endif /* OMR_GC_MODRON_SCAVENGER */
 		, globalMaximumContraction(0.05) /* by default, contract must be at most 5% of the committed heap */
@@ -1638,6 +1693,7 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, compactUsingSummaryTable(false)
 #endif /* OMR_GC_MODRON_COMPACTION */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1649,6 +1705,8 @@ public:
 		, concurrentLevel(8)
 		, concurrentBackground(1)
 		, concurrentSlack(0)
+		, concurrentKickoffForecast(false)
+		, concurrentKickoffForecastMargin(1024 * 1024)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
 		, fvtest_concurrentCardTablePreparationDelay(0)
@@ -1708,6 +1766,8 @@ public:
 #endif /* defined(OMR_GC_REALTIME) || defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		, defaultSizeClasses(NULL)
+		, sizeClassCellSizes()
+		, sizeClassHistogram(false)
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
 		, heapRegionStateTable(NULL)
@@ -1728,13 +1788,18 @@ public:
 		, allocationCacheMaximumSize(16384)
 		, allocationCacheInitialSize(256)
 		, allocationCacheIncrementSize(256)
+		, allocationCacheMagazineSize(0)
 		, nonDeterministicSweep(false)
+		, backgroundSweep(false)
 		, configuration(NULL)
 		, verboseGCManager(NULL)
 		, verbosegcCycleTime(1000)  /* by default metronome outputs verbosegc every 1sec */
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, binaryLogging(false)
+		, mappedLogging(false)
+		, mappedLogFileSize(4 * 1024 * 1024)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
@@ -1833,6 +1898,10 @@ public:
 		, trackMutatorThreadCategory(false)
 		, darkMatterSampleRate(32)
 		, pretouchHeapOnExpand(false)
+		, deferredHeapDecommit(false)
+		, heapDecommitLazyFree(false)
+		, heapDecommitBatchSize(4 * 1024 * 1024)
+		, heapPrecommit(false)
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 		, idleMinimumFree(0)
 		, gcOnIdle(false)
@@ -451,6 +451,13 @@ MM_Heap::objectIsInGap(void* object)
 	return false;
 }
 
+bool
+MM_Heap::setNumaAffinity(uintptr_t numaNode, void *address, uintptr_t byteAmount)
+{
+	/* Only heaps backed by a single virtual memory reservation know how to bind their pages */
+	return false;
+}
+
 /**
  * Initialize the CommonGCStartData structure in preparation for reporting a GC start
  * event. This structure contains data which will be of interest to anyone listening
@@ -128,6 +128,21 @@ public:
 	virtual bool commitMemory(void *address, uintptr_t size) = 0;
 	virtual bool decommitMemory(void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress) = 0;
 
+	/**
+	 * Decommit memory which a contraction has removed from the heap. Unlike decommitMemory, the heap may
+	 * defer the work for as long as the memory is not committed again.
+	 * @return true if successful, false otherwise.
+	 */
+	virtual bool decommitContractedMemory(MM_EnvironmentBase *env, void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress)
+	{
+		return decommitMemory(address, size, lowValidAddress, highValidAddress);
+	}
+
+	/**
+	 * Hint that the heap expects to commit the given range next, so it may be committed ahead of time.
+	 */
+	virtual void expectExpansion(MM_EnvironmentBase *env, void *address, uintptr_t size) {}
+
 	void mergeHeapStats(MM_HeapStats *heapStats, uintptr_t includeMemoryType);
 	void mergeHeapStats(MM_HeapStats *heapStats);
 	void resetHeapStatistics(bool globalCollect);
@@ -153,6 +168,16 @@ public:
 
 	virtual bool objectIsInGap(void *object);
 
+	/**
+	 * Set the preferred NUMA node for the pages backing the given heap range.
+	 * The range is trimmed to whole pages; heaps which cannot bind memory simply return false.
+	 * @param numaNode[in] the node to bind to, where 1 is the first node
+	 * @param address[in] the base of the range
+	 * @param byteAmount[in] the size of the range in bytes
+	 * @return true if any memory was bound, false otherwise
+	 */
+	virtual bool setNumaAffinity(uintptr_t numaNode, void *address, uintptr_t byteAmount);
+
 	/**
 	 * Called after the heap has been initialized so that it can properly initialize HeapRegionManager.
 	 *
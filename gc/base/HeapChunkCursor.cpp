@@ -0,0 +1,187 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "HeapChunkCursor.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapMapIterator.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapRegionIterator.hpp"
+#include "HeapRegionManager.hpp"
+#include "MarkMap.hpp"
+#include "Math.hpp"
+#include "ObjectHeapBufferedIterator.hpp"
+
+MM_HeapChunkCursor::MM_HeapChunkCursor(MM_EnvironmentBase *env, MM_MarkMap *markMap, uintptr_t chunkSize)
+	: MM_BaseNonVirtual()
+	, _markMap(markMap)
+	, _chunkSize(UDATA_MAX)
+	, _ranges(NULL)
+	, _rangeCount(0)
+	, _chunkCount(0)
+	, _nextChunk(0)
+{
+	_typeId = __FUNCTION__;
+	if (NULL != markMap) {
+		/* chunks must start on a mark map slot, and on an address objects may be allocated at */
+		uintptr_t alignment = OMR_MAX(env->getExtensions()->heapAlignment, (uintptr_t)J9MODRON_HMI_HEAPMAP_ALIGNMENT);
+		_chunkSize = MM_Math::roundToCeiling(alignment, OMR_MAX(chunkSize, (uintptr_t)1));
+	}
+}
+
+bool
+MM_HeapChunkCursor::initialize(MM_EnvironmentBase *env, uintptr_t walkFlags)
+{
+	MM_HeapRegionManager *regionManager = env->getExtensions()->heap->getHeapRegionManager();
+	/* the region list must not change until the walk is done */
+	regionManager->lock();
+
+	uintptr_t rangeCount = 0;
+	GC_HeapRegionIterator countIterator(regionManager);
+	MM_HeapRegionDescriptor *region = NULL;
+	while (NULL != (region = countIterator.nextRegion())) {
+		if ((walkFlags == (region->getTypeFlags() & walkFlags)) && (region->getLowAddress() < region->getHighAddress())) {
+			rangeCount += 1;
+		}
+	}
+	if (0 == rangeCount) {
+		return true;
+	}
+
+	_ranges = (Range *)env->getForge()->allocate(rangeCount * sizeof(Range), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _ranges) {
+		return false;
+	}
+
+	GC_HeapRegionIterator regionIterator(regionManager);
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if ((walkFlags == (region->getTypeFlags() & walkFlags)) && (region->getLowAddress() < region->getHighAddress())) {
+			uintptr_t regionSize = (uintptr_t)region->getHighAddress() - (uintptr_t)region->getLowAddress();
+			_ranges[_rangeCount].region = region;
+			_ranges[_rangeCount].firstChunk = _chunkCount;
+			_rangeCount += 1;
+			_chunkCount += (NULL == _markMap) ? 1 : (((regionSize - 1) / _chunkSize) + 1);
+		}
+	}
+
+	return true;
+}
+
+void
+MM_HeapChunkCursor::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _ranges) {
+		env->getForge()->free(_ranges);
+		_ranges = NULL;
+	}
+	env->getExtensions()->heap->getHeapRegionManager()->unlock();
+}
+
+bool
+MM_HeapChunkCursor::nextChunk(Chunk *chunk)
+{
+	/* once all chunks are handed out, stop advancing the cursor */
+	if (_nextChunk >= _chunkCount) {
+		return false;
+	}
+	uintptr_t index = MM_AtomicOperations::add(&_nextChunk, 1) - 1;
+	if (index >= _chunkCount) {
+		return false;
+	}
+
+	/* find the last range starting at or before the chunk */
+	uintptr_t low = 0;
+	uintptr_t high = _rangeCount - 1;
+	while (low < high) {
+		uintptr_t middle = (low + high + 1) / 2;
+		if (_ranges[middle].firstChunk <= index) {
+			low = middle;
+		} else {
+			high = middle - 1;
+		}
+	}
+
+	Range *range = &_ranges[low];
+	uintptr_t chunkInRange = index - range->firstChunk;
+	chunk->region = range->region;
+	chunk->regionTop = (uintptr_t *)range->region->getHighAddress();
+	chunk->firstInRegion = (0 == chunkInRange);
+	if (NULL == _markMap) {
+		chunk->base = (uintptr_t *)range->region->getLowAddress();
+		chunk->top = chunk->regionTop;
+	} else {
+		uintptr_t base = (uintptr_t)range->region->getLowAddress() + (chunkInRange * _chunkSize);
+		chunk->base = (uintptr_t *)base;
+		chunk->top = (uintptr_t *)OMR_MIN(base + _chunkSize, (uintptr_t)chunk->regionTop);
+	}
+
+	return true;
+}
+
+omrobjectptr_t
+MM_HeapChunkCursor::findFirstObject(MM_EnvironmentBase *env, Chunk *chunk)
+{
+	if (chunk->firstInRegion) {
+		/* objects, live or dead, at the start of the region are not preceded by another chunk */
+		return (omrobjectptr_t)chunk->base;
+	}
+	/* anything before the first marked object was reached by the walk of an earlier chunk */
+	MM_HeapMapIterator markedObjectIterator(env->getExtensions(), _markMap, chunk->base, chunk->top);
+	return markedObjectIterator.nextObject();
+}
+
+uintptr_t
+MM_HeapChunkCursor::objectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t *chunksWalked)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	OMR_VMThread *omrVMThread = env->getOmrVMThread();
+	uintptr_t objectsWalked = 0;
+	Chunk chunk;
+
+	*chunksWalked = 0;
+	while (nextChunk(&chunk)) {
+		*chunksWalked += 1;
+		omrobjectptr_t firstObject = findFirstObject(env, &chunk);
+		if (NULL != firstObject) {
+			/* walk on past the top of the chunk until the first object of a later chunk */
+			GC_ObjectHeapBufferedIterator objectHeapIterator(extensions, chunk.region, firstObject, chunk.regionTop);
+			omrobjectptr_t object = NULL;
+			while (NULL != (object = objectHeapIterator.nextObject())) {
+				if (((uintptr_t *)object >= chunk.top) && _markMap->isBitSet(object)) {
+					break;
+				}
+				function(omrVMThread, chunk.region, object, userData);
+				objectsWalked += 1;
+			}
+		}
+	}
+
+	return objectsWalked;
+}
@@ -0,0 +1,136 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(HEAPCHUNKCURSOR_HPP_)
+#define HEAPCHUNKCURSOR_HPP_
+
+#include "omr.h"
+#include "omrcfg.h"
+#include "modronbase.h"
+
+#include "BaseNonVirtual.hpp"
+#include "HeapWalker.hpp"
+
+class MM_EnvironmentBase;
+class MM_HeapRegionDescriptor;
+class MM_MarkMap;
+
+/**
+ * Hands out fixed size chunks of the walkable regions of the heap to the threads of a parallel task,
+ * through an atomic cursor, and walks the objects of each chunk.
+ *
+ * An object belongs to the chunk in which the walk of its region reaches it: a chunk's walk starts at
+ * the first marked object in the chunk (at the region base for the first chunk of a region) and carries
+ * on past the top of the chunk up to the first marked object of a later chunk. Objects which span chunk
+ * boundaries, and dead objects, are so walked exactly once. Without a valid mark map each region is a
+ * single chunk.
+ * @note The heap must have been prepared for walking.
+ * @ingroup GC_Base
+ */
+class MM_HeapChunkCursor : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+	/**
+	 * A chunk handed out by the cursor.
+	 */
+	struct Chunk {
+		MM_HeapRegionDescriptor *region; /**< the region the chunk is in */
+		uintptr_t *base; /**< start of the chunk */
+		uintptr_t *top; /**< end of the chunk, which the last object belonging to the chunk may extend past */
+		uintptr_t *regionTop; /**< end of the region */
+		bool firstInRegion; /**< the chunk starts at the region base */
+	};
+
+private:
+	/**
+	 * A region to walk, numbering its chunks after those of the preceding regions.
+	 */
+	struct Range {
+		MM_HeapRegionDescriptor *region;
+		uintptr_t firstChunk; /**< cursor value of the first chunk of the region */
+	};
+
+	MM_MarkMap *_markMap; /**< locates the first object of a chunk, NULL if each region is a single chunk */
+	uintptr_t _chunkSize; /**< size of every chunk but the last of a region */
+	Range *_ranges; /**< the regions to walk, in address order */
+	uintptr_t _rangeCount;
+	uintptr_t _chunkCount; /**< total chunks of all ranges */
+	volatile uintptr_t _nextChunk; /**< the next chunk to hand out */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	/**
+	 * Find the start of the walk of a chunk.
+	 * @return the first object belonging to the chunk, or NULL if there is none
+	 */
+	omrobjectptr_t findFirstObject(MM_EnvironmentBase *env, Chunk *chunk);
+
+protected:
+public:
+	/**
+	 * Find the regions to walk. Must be called before the task is dispatched.
+	 * @param walkFlags[in] region type flags which all must be set for a region to be walked
+	 * @return true on success, false otherwise
+	 */
+	bool initialize(MM_EnvironmentBase *env, uintptr_t walkFlags);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Claim the next chunk. May be called by any number of threads.
+	 * @param chunk[out] the chunk claimed
+	 * @return true if a chunk was claimed, false if all have been handed out
+	 */
+	bool nextChunk(Chunk *chunk);
+
+	/**
+	 * Claim chunks until none are left and apply the function to each of their objects.
+	 * Called by each thread of the task.
+	 * @param chunksWalked[out] the number of chunks claimed by the calling thread
+	 * @return the number of objects walked by the calling thread
+	 */
+	uintptr_t objectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t *chunksWalked);
+
+	MMINLINE uintptr_t getChunkSize() { return _chunkSize; }
+	MMINLINE uintptr_t getChunkCount() { return _chunkCount; }
+
+	/**
+	 * Create a HeapChunkCursor object.
+	 * @param markMap[in] a valid mark map, or NULL to walk each region as a single chunk
+	 * @param chunkSize[in] the chunk size, rounded up to the mark map and heap alignment
+	 */
+	MM_HeapChunkCursor(MM_EnvironmentBase *env, MM_MarkMap *markMap, uintptr_t chunkSize);
+};
+
+#endif /* HEAPCHUNKCURSOR_HPP_ */
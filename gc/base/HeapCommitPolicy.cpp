@@ -0,0 +1,395 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrport.h"
+#include "omrutil.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapCommitPolicy.hpp"
+#include "HeapResizeStats.hpp"
+#include "Math.hpp"
+#include "MemoryManager.hpp"
+#include "ModronAssertions.h"
+
+MM_HeapCommitPolicy::MM_HeapCommitPolicy(MM_EnvironmentBase *env, MM_Heap *heap, MM_MemoryHandle *vmemHandle)
+	: MM_BaseVirtual()
+	, _omrVM(env->getOmrVM())
+	, _heap(heap)
+	, _memoryManager(env->getExtensions()->memoryManager)
+	, _vmemHandle(vmemHandle)
+	, _stats(heap->getResizeStats())
+	, _pageSize(0)
+	, _batchSize(0)
+	, _deferDecommit(env->getExtensions()->deferredHeapDecommit)
+	, _precommit(env->getExtensions()->heapPrecommit)
+	, _monitor(NULL)
+	, _threadState(THREAD_NOT_STARTED)
+	, _pendingCount(0)
+	, _precommitBase(NULL)
+	, _precommitDone(NULL)
+	, _precommitTop(NULL)
+{
+	_typeId = __FUNCTION__;
+}
+
+MM_HeapCommitPolicy *
+MM_HeapCommitPolicy::newInstance(MM_EnvironmentBase *env, MM_Heap *heap, MM_MemoryHandle *vmemHandle)
+{
+	MM_HeapCommitPolicy *policy = (MM_HeapCommitPolicy *)env->getForge()->allocate(sizeof(MM_HeapCommitPolicy), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != policy) {
+		new (policy) MM_HeapCommitPolicy(env, heap, vmemHandle);
+		if (!policy->initialize(env)) {
+			policy->kill(env);
+			policy = NULL;
+		}
+	}
+	return policy;
+}
+
+void
+MM_HeapCommitPolicy::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_HeapCommitPolicy::initialize(MM_EnvironmentBase *env)
+{
+	_pageSize = _memoryManager->getPageSize(_vmemHandle);
+	_batchSize = MM_Math::roundToCeiling(_pageSize, OMR_MAX(env->getExtensions()->heapDecommitBatchSize, _pageSize));
+
+	if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_HeapCommitPolicy::_monitor")) {
+		_monitor = NULL;
+		return false;
+	}
+
+	bool success = false;
+	/* hold the monitor over start-up of the thread so that it cannot notify us of its state before we wait */
+	omrthread_monitor_enter(_monitor);
+	_threadState = THREAD_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		threadProc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (THREAD_STARTING == _threadState) {
+			omrthread_monitor_wait(_monitor);
+		}
+		success = (THREAD_RUNNING == _threadState);
+	} else {
+		_threadState = THREAD_ERROR;
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return success;
+}
+
+void
+MM_HeapCommitPolicy::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _monitor) {
+		if (THREAD_RUNNING == _threadState) {
+			/* the memory is about to be released, so there is no point finishing the queued work */
+			omrthread_monitor_enter(_monitor);
+			_pendingCount = 0;
+			_precommitTop = _precommitDone;
+			while (THREAD_TERMINATED != _threadState) {
+				_threadState = THREAD_TERMINATION_REQUESTED;
+				omrthread_monitor_notify_all(_monitor);
+				omrthread_monitor_wait(_monitor);
+			}
+			omrthread_monitor_exit(_monitor);
+		}
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+}
+
+bool
+MM_HeapCommitPolicy::decommit(MM_EnvironmentBase *env, void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress)
+{
+	bool result = true;
+
+	omrthread_monitor_enter(_monitor);
+	if (_precommitBase < _precommitDone) {
+		/* the heap is shrinking rather than growing, so give back what was committed for the expected expansion */
+		uint8_t *precommitBase = _precommitBase;
+		uint8_t *precommitDone = _precommitDone;
+		_precommitBase = NULL;
+		_precommitDone = NULL;
+		_precommitTop = NULL;
+		addPending(precommitBase, precommitDone, precommitBase, NULL);
+	} else {
+		_precommitBase = NULL;
+		_precommitDone = NULL;
+		_precommitTop = NULL;
+	}
+
+	if (_deferDecommit) {
+		result = addPending((uint8_t *)address, (uint8_t *)address + size, lowValidAddress, highValidAddress);
+		_stats->addDeferredDecommitBytes(size);
+	} else {
+		result = _memoryManager->decommitMemory(_vmemHandle, address, size, lowValidAddress, highValidAddress);
+	}
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_monitor_exit(_monitor);
+
+	return result;
+}
+
+void
+MM_HeapCommitPolicy::reclaim(void *address, uintptr_t size)
+{
+	uint8_t *base = (uint8_t *)address;
+	uint8_t *top = base + size;
+
+	omrthread_monitor_enter(_monitor);
+	removePending(base, top);
+
+	if (_precommitBase < _precommitDone) {
+		uint8_t *hitBase = OMR_MAX(base, _precommitBase);
+		uint8_t *hitTop = OMR_MIN(top, _precommitDone);
+		if (hitBase < hitTop) {
+			_stats->addPrecommitHitBytes((uintptr_t)(hitTop - hitBase));
+		}
+		/* whatever of the expected expansion the heap did not take is no longer expected */
+		uint8_t *precommitBase = _precommitBase;
+		uint8_t *precommitDone = _precommitDone;
+		_precommitBase = NULL;
+		_precommitDone = NULL;
+		_precommitTop = NULL;
+		if (precommitBase < base) {
+			addPending(precommitBase, OMR_MIN(base, precommitDone), precommitBase, base);
+		}
+		if (top < precommitDone) {
+			addPending(OMR_MAX(top, precommitBase), precommitDone, top, NULL);
+		}
+	} else {
+		_precommitBase = NULL;
+		_precommitDone = NULL;
+		_precommitTop = NULL;
+	}
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_monitor_exit(_monitor);
+}
+
+void
+MM_HeapCommitPolicy::expectExpansion(MM_EnvironmentBase *env, void *address, uintptr_t size)
+{
+	if (_precommit) {
+		uint8_t *base = (uint8_t *)MM_Math::roundToCeiling(_pageSize, (uintptr_t)address);
+		uint8_t *top = (uint8_t *)MM_Math::roundToFloor(_pageSize, (uintptr_t)address + size);
+		if (base < top) {
+			omrthread_monitor_enter(_monitor);
+			/* pending ranges in the way would otherwise be decommitted under the pre-faulted pages */
+			removePending(base, top);
+			if ((_precommitBase != base) || (_precommitTop != top)) {
+				if (_precommitBase < _precommitDone) {
+					addPending(_precommitBase, _precommitDone, _precommitBase, NULL);
+				}
+				_precommitBase = base;
+				_precommitDone = base;
+				_precommitTop = top;
+			}
+			omrthread_monitor_notify_all(_monitor);
+			omrthread_monitor_exit(_monitor);
+		}
+	}
+}
+
+void
+MM_HeapCommitPolicy::flush(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_monitor);
+	while ((THREAD_RUNNING == _threadState) && hasWork()) {
+		omrthread_monitor_notify_all(_monitor);
+		omrthread_monitor_wait(_monitor);
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+void
+MM_HeapCommitPolicy::removePending(uint8_t *base, uint8_t *top)
+{
+	uintptr_t index = 0;
+	while (index < _pendingCount) {
+		PendingRange *range = &_pending[index];
+		if ((range->top <= base) || (top <= range->base)) {
+			index += 1;
+		} else if ((base <= range->base) && (range->top <= top)) {
+			/* covered - drop it, keeping the queue in order */
+			_pendingCount -= 1;
+			for (uintptr_t i = index; i < _pendingCount; i++) {
+				_pending[i] = _pending[i + 1];
+			}
+		} else if ((range->base < base) && (top < range->top)) {
+			/* the range straddles [base, top) - keep both sides, both now bordering committed memory */
+			PendingRange high = { top, range->top, top, range->highValidAddress };
+			range->top = base;
+			range->highValidAddress = base;
+			if (_pendingCount < OMR_HEAP_COMMIT_POLICY_PENDING_RANGES) {
+				_pending[_pendingCount] = high;
+				_pendingCount += 1;
+			} else {
+				_memoryManager->decommitMemory(_vmemHandle, high.base, (uintptr_t)(high.top - high.base), high.lowValidAddress, high.highValidAddress);
+			}
+			index += 1;
+		} else if (range->base < base) {
+			range->top = base;
+			range->highValidAddress = base;
+			index += 1;
+		} else {
+			range->base = top;
+			range->lowValidAddress = top;
+			index += 1;
+		}
+	}
+}
+
+bool
+MM_HeapCommitPolicy::addPending(uint8_t *base, uint8_t *top, void *lowValidAddress, void *highValidAddress)
+{
+	bool result = true;
+	if (base < top) {
+		if (_pendingCount < OMR_HEAP_COMMIT_POLICY_PENDING_RANGES) {
+			PendingRange *range = &_pending[_pendingCount];
+			range->base = base;
+			range->top = top;
+			range->lowValidAddress = lowValidAddress;
+			range->highValidAddress = highValidAddress;
+			_pendingCount += 1;
+		} else {
+			result = _memoryManager->decommitMemory(_vmemHandle, base, (uintptr_t)(top - base), lowValidAddress, highValidAddress);
+		}
+	}
+	return result;
+}
+
+void
+MM_HeapCommitPolicy::decommitBatch(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+	PendingRange *range = &_pending[0];
+	uint8_t *batchTop = (uint8_t *)MM_Math::roundToFloor(_pageSize, (uintptr_t)range->base + _batchSize);
+	bool last = (batchTop <= range->base) || (range->top <= batchTop);
+
+	uint64_t residentBefore = getResidentSize(env);
+	uint64_t startTime = omrtime_hires_clock();
+	if (last) {
+		_memoryManager->decommitMemory(_vmemHandle, range->base, (uintptr_t)(range->top - range->base), range->lowValidAddress, range->highValidAddress);
+		_stats->addBackgroundDecommitBytes((uintptr_t)(range->top - range->base));
+		_pendingCount -= 1;
+		for (uintptr_t i = 0; i < _pendingCount; i++) {
+			_pending[i] = _pending[i + 1];
+		}
+	} else {
+		/* batchTop is page aligned, so the next batch can start there with nothing valid below it */
+		_memoryManager->decommitMemory(_vmemHandle, range->base, (uintptr_t)(batchTop - range->base), range->lowValidAddress, batchTop);
+		_stats->addBackgroundDecommitBytes((uintptr_t)(batchTop - range->base));
+		range->base = batchTop;
+		range->lowValidAddress = NULL;
+	}
+	_stats->addBackgroundDecommitTime(omrtime_hires_clock() - startTime);
+	uint64_t residentAfter = getResidentSize(env);
+	if (residentAfter < residentBefore) {
+		_stats->addRSSReduction(residentBefore - residentAfter);
+	}
+}
+
+void
+MM_HeapCommitPolicy::precommitBatch(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+	uint8_t *base = _precommitDone;
+	uint8_t *top = OMR_MIN(_precommitTop, base + _batchSize);
+
+	uint64_t startTime = omrtime_hires_clock();
+	if (_memoryManager->commitMemory(_vmemHandle, base, (uintptr_t)(top - base))) {
+		/* fault every page in now rather than on first allocation after the expansion */
+		for (uint8_t *page = base; page < top; page += _pageSize) {
+			*(volatile uint8_t *)page = 0;
+		}
+		_precommitDone = top;
+		_stats->addPrecommitBytes((uintptr_t)(top - base));
+	} else {
+		/* give up on the expansion - the heap commits it itself if it gets there */
+		_precommitTop = _precommitDone;
+	}
+	_stats->addBackgroundPrecommitTime(omrtime_hires_clock() - startTime);
+}
+
+uint64_t
+MM_HeapCommitPolicy::getResidentSize(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+	uint64_t size = 0;
+	if (0 != omrvmem_get_process_memory_size(OMRPORT_VMEM_PROCESS_PHYSICAL, &size)) {
+		size = 0;
+	}
+	return size;
+}
+
+int J9THREAD_PROC
+MM_HeapCommitPolicy::threadProc(void *info)
+{
+	MM_HeapCommitPolicy *policy = (MM_HeapCommitPolicy *)info;
+	policy->threadEntryPoint();
+	return 0;
+}
+
+void
+MM_HeapCommitPolicy::threadEntryPoint()
+{
+	/* the thread only commits and decommits memory outside the heap, so it does not attach to the VM */
+	MM_EnvironmentBase env(_omrVM);
+
+	omrthread_monitor_enter(_monitor);
+	_threadState = THREAD_RUNNING;
+	omrthread_monitor_notify_all(_monitor);
+	while (THREAD_TERMINATION_REQUESTED != _threadState) {
+		if (0 != _pendingCount) {
+			/* releasing memory comes first, as the process may be short of it */
+			decommitBatch(&env);
+		} else if (_precommitDone < _precommitTop) {
+			precommitBatch(&env);
+		} else {
+			/* let anyone flushing know that the work is done */
+			omrthread_monitor_notify_all(_monitor);
+			omrthread_monitor_wait(_monitor);
+			continue;
+		}
+		/* give a waiting commit the chance to reclaim its memory between batches */
+		omrthread_monitor_exit(_monitor);
+		omrthread_yield();
+		omrthread_monitor_enter(_monitor);
+	}
+	_threadState = THREAD_TERMINATED;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
@@ -0,0 +1,179 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(HEAPCOMMITPOLICY_HPP_)
+#define HEAPCOMMITPOLICY_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+#include "modronbase.h"
+
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_Heap;
+class MM_HeapResizeStats;
+class MM_MemoryHandle;
+class MM_MemoryManager;
+
+/* Contracted ranges waiting to be decommitted; further contractions are decommitted in the pause */
+#define OMR_HEAP_COMMIT_POLICY_PENDING_RANGES 32
+
+/**
+ * Takes the cost of committing and decommitting heap memory out of the GC pause.
+ *
+ * Memory removed from the heap by a contraction is queued for a background thread, which decommits
+ * it a batch at a time. Memory for the next expansion the heap expects is committed and pre-faulted
+ * by the same thread, so the expansion finds its pages already resident. Every commit of heap
+ * memory first reclaims the parts of its range still waiting to be decommitted; as the background
+ * thread holds the policy monitor over each batch, a commit waits for at most one batch.
+ * @ingroup GC_Base_Core
+ */
+class MM_HeapCommitPolicy : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	enum ThreadState {
+		THREAD_NOT_STARTED = 0,
+		THREAD_STARTING,
+		THREAD_RUNNING,
+		THREAD_TERMINATION_REQUESTED,
+		THREAD_TERMINATED,
+		THREAD_ERROR
+	};
+
+	/**
+	 * A contracted range waiting to be decommitted, with the committed memory around it as
+	 * MM_Heap::decommitMemory expects.
+	 */
+	struct PendingRange {
+		uint8_t *base;
+		uint8_t *top;
+		void *lowValidAddress;
+		void *highValidAddress;
+	};
+
+	OMR_VM *_omrVM; /**< the VM, for the background thread's environment */
+	MM_Heap *_heap; /**< the heap the memory belongs to */
+	MM_MemoryManager *_memoryManager;
+	MM_MemoryHandle *_vmemHandle; /**< the heap's virtual memory, committed and decommitted directly */
+	MM_HeapResizeStats *_stats; /**< where commit and decommit times and the resident size released are reported */
+	uintptr_t _pageSize; /**< the heap page size, the stride of pre-faulting and the alignment of batches */
+	uintptr_t _batchSize; /**< bytes decommitted or pre-faulted at a time */
+	bool _deferDecommit; /**< decommit contracted memory in the background */
+	bool _precommit; /**< commit and pre-fault expected expansions in the background */
+
+	omrthread_monitor_t _monitor; /**< guards the state below, and is held by the background thread over each batch */
+	volatile ThreadState _threadState;
+	PendingRange _pending[OMR_HEAP_COMMIT_POLICY_PENDING_RANGES]; /**< ranges to decommit, in the order they were queued */
+	uintptr_t _pendingCount;
+	uint8_t *_precommitBase; /**< start of the expected expansion */
+	uint8_t *_precommitDone; /**< end of the part of the expected expansion committed and pre-faulted so far */
+	uint8_t *_precommitTop; /**< end of the expected expansion */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	/**
+	 * Remove the part of the pending ranges which lies in [base, top), splitting a range where needed.
+	 * Must be called with the monitor held.
+	 */
+	void removePending(uint8_t *base, uint8_t *top);
+
+	/**
+	 * Queue a range to decommit, decommitting it right away if the queue is full. Must be called with the monitor held.
+	 * @return false if an immediate decommit failed, true otherwise
+	 */
+	bool addPending(uint8_t *base, uint8_t *top, void *lowValidAddress, void *highValidAddress);
+
+	/**
+	 * Decommit the next batch of the oldest pending range. Called by the background thread with the monitor held.
+	 */
+	void decommitBatch(MM_EnvironmentBase *env);
+
+	/**
+	 * Commit and pre-fault the next batch of the expected expansion. Called by the background thread with the monitor held.
+	 */
+	void precommitBatch(MM_EnvironmentBase *env);
+
+	/**
+	 * @return the resident set size of the process in bytes, or 0 if it is not known
+	 */
+	uint64_t getResidentSize(MM_EnvironmentBase *env);
+
+	MMINLINE bool hasWork() { return (0 != _pendingCount) || (_precommitDone < _precommitTop); }
+
+	static int J9THREAD_PROC threadProc(void *info);
+	void threadEntryPoint();
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	/**
+	 * @param vmemHandle[in] the heap's virtual memory
+	 */
+	static MM_HeapCommitPolicy *newInstance(MM_EnvironmentBase *env, MM_Heap *heap, MM_MemoryHandle *vmemHandle);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Decommit memory a contraction removed from the heap, in the background if deferred decommit is enabled.
+	 * Any expected expansion is dropped, and the memory already committed for it is decommitted too.
+	 * @return true if the memory was queued or decommitted, false otherwise
+	 */
+	bool decommit(MM_EnvironmentBase *env, void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress);
+
+	/**
+	 * Take back memory about to be committed into the heap: it is removed from the pending ranges, and counts as
+	 * a hit if it had been pre-faulted. Must be called before any heap memory is committed.
+	 */
+	void reclaim(void *address, uintptr_t size);
+
+	/**
+	 * Note where the heap expects to expand next, for the memory to be committed and pre-faulted in the background.
+	 * Replaces any earlier expectation. Ignored unless pre-committing is enabled.
+	 * @param address[in] base of the expected expansion, which must be free to commit
+	 * @param size[in] size of the expected expansion
+	 */
+	void expectExpansion(MM_EnvironmentBase *env, void *address, uintptr_t size);
+
+	/**
+	 * Wait until all pending ranges are decommitted and the expected expansion is pre-faulted.
+	 */
+	void flush(MM_EnvironmentBase *env);
+
+	MM_HeapCommitPolicy(MM_EnvironmentBase *env, MM_Heap *heap, MM_MemoryHandle *vmemHandle);
+};
+
+#endif /* HEAPCOMMITPOLICY_HPP_ */
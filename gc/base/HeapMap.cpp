@@ -33,6 +33,40 @@
 #include "MemoryManager.hpp"
 #include "ModronAssertions.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define HEAPMAP_SCAN_VECTOR_SIZE 32
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define HEAPMAP_SCAN_VECTOR_SIZE 16
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define HEAPMAP_SCAN_VECTOR_SIZE 16
+#else /* no vector unit */
+#define HEAPMAP_SCAN_VECTOR_SIZE sizeof(uintptr_t)
+#endif /* __AVX2__ */
+
+/**
+ * Check whether a vector of heap map slots are all empty.
+ * @param[in] slots The first slot of the vector, aligned to HEAPMAP_SCAN_VECTOR_SIZE
+ * @return true if no bit is set in the HEAPMAP_SCAN_VECTOR_SIZE bytes of slots
+ */
+static MMINLINE bool
+areSlotsEmpty(uintptr_t *slots)
+{
+#if defined(__AVX2__)
+	__m256i vector = _mm256_load_si256((__m256i *)slots);
+	return 0 != _mm256_testz_si256(vector, vector);
+#elif defined(__SSE2__) || defined(_M_X64)
+	__m128i vector = _mm_load_si128((__m128i *)slots);
+	return 0xFFFF == _mm_movemask_epi8(_mm_cmpeq_epi8(vector, _mm_setzero_si128()));
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+	return 0 == vmaxvq_u32(vld1q_u32((uint32_t *)slots));
+#else /* no vector unit */
+	return 0 == *slots;
+#endif /* __AVX2__ */
+}
+
 /**
  * Object creation and destruction 
  *
@@ -233,6 +267,30 @@ MM_HeapMap::numberBitsInRange(MM_EnvironmentBase *env, void *lowAddress, void *h
 		
 }
 
+uintptr_t *
+MM_HeapMap::findNextNonEmptySlot(uintptr_t *slot, uintptr_t *endSlot)
+{
+	/* Check slots one at a time up to the first vector boundary */
+	while ((slot < endSlot) && (0 == *slot) && (0 != ((uintptr_t)slot % HEAPMAP_SCAN_VECTOR_SIZE))) {
+		slot += 1;
+	}
+
+	if ((slot < endSlot) && (0 == *slot)) {
+		/* Skip whole vectors of empty slots; the last vector may be incomplete so leave it for the slot at a time scan */
+		uintptr_t *lastVector = (uintptr_t *)MM_Math::roundToFloor(HEAPMAP_SCAN_VECTOR_SIZE, (uintptr_t)endSlot);
+		while ((slot < lastVector) && areSlotsEmpty(slot)) {
+			slot += HEAPMAP_SCAN_VECTOR_SIZE / sizeof(uintptr_t);
+		}
+
+		/* Either the range is done, or the non-empty slot is within the next vector */
+		while ((slot < endSlot) && (0 == *slot)) {
+			slot += 1;
+		}
+	}
+
+	return slot;
+}
+
 /**
  * Set all heap map bits for a specified heap range either ON or OFF
  * 				  
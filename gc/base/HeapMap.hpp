@@ -282,6 +282,14 @@ public:
 
 	uintptr_t numberBitsInRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress);
 
+	/**
+	 * Find the first heap map slot with any bit set, skipping empty slots a vector at a time where the platform allows.
+	 * @param slot[in] the first slot to check
+	 * @param endSlot[in] the slot after the last one to check
+	 * @return the first non-empty slot, or endSlot if every slot in the range is empty
+	 */
+	static uintptr_t *findNextNonEmptySlot(uintptr_t *slot, uintptr_t *endSlot);
+
 	/**
 	 * Set all heap map bits for a specified heap range either ON or OFF
 	 *
@@ -131,6 +131,16 @@ MM_HeapMapIterator::nextObject()
 		_bitIndexHead = 0;
 		if(_heapSlotCurrent < _heapChunkTop) {
 			_heapMapSlotValue = *_heapMapSlotCurrent;
+			if (J9MODRON_HMI_SLOT_EMPTY == _heapMapSlotValue) {
+				/* Skip any further run of empty map slots in bulk, up to the slot covering the end of the chunk */
+				uintptr_t slotsToTop = ((uintptr_t)(_heapChunkTop - _heapSlotCurrent) + J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT - 1) / J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT;
+				uintptr_t *nextSlot = MM_HeapMap::findNextNonEmptySlot(_heapMapSlotCurrent + 1, _heapMapSlotCurrent + slotsToTop);
+				_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT * (nextSlot - _heapMapSlotCurrent);
+				_heapMapSlotCurrent = nextSlot;
+				if(_heapSlotCurrent < _heapChunkTop) {
+					_heapMapSlotValue = *_heapMapSlotCurrent;
+				}
+			}
 		}
 	}
 
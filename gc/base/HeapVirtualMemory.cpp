@@ -28,6 +28,7 @@
 #include "Forge.hpp"
 #include "GCExtensionsBase.hpp"
 #include "GlobalCollector.hpp"
+#include "HeapCommitPolicy.hpp"
 #include "HeapRegionManager.hpp"
 #include "Math.hpp"
 #include "MemoryManager.hpp"
@@ -127,6 +128,13 @@ MM_HeapVirtualMemory::initialize(MM_EnvironmentBase* env, uintptr_t size)
 	/* The memory returned might be less than we asked for -- get the actual size */
 	_maximumMemorySize = memoryManager->getMaximumSize(&_vmemHandle);
 
+	if (extensions->deferredHeapDecommit || extensions->heapPrecommit) {
+		_commitPolicy = MM_HeapCommitPolicy::newInstance(env, this, &_vmemHandle);
+		if (NULL == _commitPolicy) {
+			return false;
+		}
+	}
+
 	return true;
 }
 
@@ -136,6 +144,12 @@ MM_HeapVirtualMemory::tearDown(MM_EnvironmentBase* env)
 	MM_MemoryManager* memoryManager = env->getExtensions()->memoryManager;
 	MM_HeapRegionManager* manager = getHeapRegionManager();
 
+	/* the policy thread must be gone before the memory it works on */
+	if (NULL != _commitPolicy) {
+		_commitPolicy->kill(env);
+		_commitPolicy = NULL;
+	}
+
 	if (NULL != manager) {
 		manager->destroyRegionTable(env);
 	}
@@ -319,12 +333,21 @@ MM_HeapVirtualMemory::commitMemory(void* address, uintptr_t size)
 {
 	MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(_omrVM);
 	MM_MemoryManager* memoryManager = extensions->memoryManager;
+	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+	uint64_t startTime = omrtime_hires_clock();
+
+	if (NULL != _commitPolicy) {
+		/* the memory may still be waiting to be decommitted in the background */
+		_commitPolicy->reclaim(address, size);
+	}
 
 	bool resultCommitMemory = memoryManager->commitMemory(&_vmemHandle, address, size);
 
 	if (resultCommitMemory && extensions->pretouchHeapOnExpand) {
 		memset(address, 0, size);
 	}
+
+	_heapResizeStats.addCommitTime(omrtime_hires_clock() - startTime);
 	
 	return resultCommitMemory;
 }
@@ -342,6 +365,57 @@ MM_HeapVirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowVal
 	return memoryManager->decommitMemory(&_vmemHandle, address, size, lowValidAddress, highValidAddress);
 }
 
+/**
+ * Decommit memory removed from the heap by a contraction, handing it to the commit policy if there is one.
+ * @return true if successful, false otherwise.
+ */
+bool
+MM_HeapVirtualMemory::decommitContractedMemory(MM_EnvironmentBase* env, void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t startTime = omrtime_hires_clock();
+	bool result = false;
+
+	if (NULL != _commitPolicy) {
+		result = _commitPolicy->decommit(env, address, size, lowValidAddress, highValidAddress);
+	} else {
+		result = decommitMemory(address, size, lowValidAddress, highValidAddress);
+	}
+
+	_heapResizeStats.addDecommitTime(omrtime_hires_clock() - startTime);
+	return result;
+}
+
+void
+MM_HeapVirtualMemory::expectExpansion(MM_EnvironmentBase* env, void* address, uintptr_t size)
+{
+	if (NULL != _commitPolicy) {
+		_commitPolicy->expectExpansion(env, address, size);
+	}
+}
+
+/**
+ * Bind the whole pages within the address range to the given NUMA node.
+ * @return true if any pages were bound, false otherwise.
+ */
+bool
+MM_HeapVirtualMemory::setNumaAffinity(uintptr_t numaNode, void* address, uintptr_t byteAmount)
+{
+	bool result = false;
+#if defined(OMR_GC_VLHGC) || defined(OMR_GC_MODRON_SCAVENGER)
+	MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(_omrVM);
+	MM_MemoryManager* memoryManager = extensions->memoryManager;
+	uintptr_t pageSize = memoryManager->getPageSize(&_vmemHandle);
+	uintptr_t low = MM_Math::roundToCeiling(pageSize, (uintptr_t)address);
+	uintptr_t high = MM_Math::roundToFloor(pageSize, (uintptr_t)address + byteAmount);
+
+	if ((0 != numaNode) && (low < high)) {
+		result = memoryManager->setNumaAffinity(&_vmemHandle, numaNode, (void *)low, high - low);
+	}
+#endif /* defined(OMR_GC_VLHGC) || defined(OMR_GC_MODRON_SCAVENGER) */
+	return result;
+}
+
 /**
  * Calculate the offset of an address from the base of the heap.
  * @param The address which require the offset for.
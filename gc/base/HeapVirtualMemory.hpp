@@ -29,6 +29,7 @@
 #include "MemoryHandle.hpp"
 
 class MM_EnvironmentBase;
+class MM_HeapCommitPolicy;
 class MM_HeapRegionManager;
 class MM_MemorySubSpace;
 class MM_PhysicalArena;
@@ -39,6 +40,7 @@ protected:
 	uintptr_t _heapAlignment;
 
 	MM_PhysicalArena* _physicalArena;
+	MM_HeapCommitPolicy* _commitPolicy; /**< moves commit and decommit work out of the GC pause, NULL unless enabled */
 
 private:
 protected:
@@ -68,6 +70,10 @@ public:
 
 	virtual bool commitMemory(void* address, uintptr_t size);
 	virtual bool decommitMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
+	virtual bool decommitContractedMemory(MM_EnvironmentBase* env, void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
+	virtual void expectExpansion(MM_EnvironmentBase* env, void* address, uintptr_t size);
+	MM_HeapCommitPolicy* getCommitPolicy() { return _commitPolicy; }
+	virtual bool setNumaAffinity(uintptr_t numaNode, void* address, uintptr_t byteAmount);
 
 	virtual uintptr_t calculateOffsetFromHeapBase(void* address);
 
@@ -83,6 +89,7 @@ public:
 		, _vmemHandle()
 		, _heapAlignment(heapAlignment)
 		, _physicalArena(NULL)
+		, _commitPolicy(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -69,6 +69,10 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 	uintptr_t options = 0;
 	uint32_t memoryCategory = OMRMEM_CATEGORY_MM_RUNTIME_HEAP;
 
+	if (extensions->heapDecommitLazyFree) {
+		mode |= OMRPORT_VMEM_MEMORY_MODE_LAZY_DECOMMIT;
+	}
+
 	uintptr_t pageSize = extensions->requestedPageSize;
 	uintptr_t pageFlags = extensions->requestedPageFlags;
 	Assert_MM_true(0 != pageSize);
@@ -42,6 +42,7 @@
 #include "HeapLinkedFreeHeader.hpp"
 #include "Heap.hpp"
 #include "Math.hpp"
+#include "SweepPoolState.hpp"
 
 #if defined(OMR_VALGRIND_MEMCHECK)
 #include "MemcheckWrapper.hpp"
@@ -113,6 +114,11 @@ MM_MemoryPoolAddressOrderedList::initialize(MM_EnvironmentBase *env)
 		return false;
 	} 
 
+	_sizeIndexEnabled = ext->freeListSizeIndex;
+	if (_sizeIndexEnabled) {
+		_sizeIndex.setBounds(_largeObjectAllocateStats, _minimumFreeEntrySize);
+	}
+
 	/* At this moment we do not know who is creator of this pool, so we do not set _largeObjectCollectorAllocateStats yet.
 	 * Tenure SubSpace for Gencon will set _largeObjectCollectorAllocateStats to _largeObjectAllocateStats (we append collector stats to mutator stats)
 	 * SemiSpace will leave _largeObjectCollectorAllocateStats at NULL (no interest in Collector stats)
@@ -211,6 +217,8 @@ MM_MemoryPoolAddressOrderedList::clearHints()
 	_hintInactive = inactiveHint;
 	_hintActive = NULL;
 	_hintLru = 1;
+
+	clearSizeIndex();
 }
 
 MMINLINE void
@@ -411,6 +419,21 @@ MM_MemoryPoolAddressOrderedList::updateHintsBeyondEntry(MM_HeapLinkedFreeHeader
 		/* Move to the next hint */
 		hint = hint->next;
 	}
+
+	/* The new entries may be larger than anything the size index has seen */
+	clearSizeIndex();
+}
+
+/**
+ * Follow the last free entry connected by the sweep when allocation splits or consumes it, so that the entry stays the
+ * tail of the free list for a lazy sweep to resume connecting at.
+ */
+MMINLINE void
+MM_MemoryPoolAddressOrderedList::updateConnectPreviousFreeEntry(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry)
+{
+	if ((NULL != _sweepPoolState) && (oldFreeEntry == _sweepPoolState->_connectPreviousFreeEntry)) {
+		_sweepPoolState->_connectPreviousFreeEntry = newFreeEntry;
+	}
 }
 
 /****************************************
@@ -428,14 +451,13 @@ MM_MemoryPoolAddressOrderedList::internalAllocate(MM_EnvironmentBase *env, uintp
 	J9ModronAllocateHint *allocateHintUsed;
 	void *addrBase;
 	uintptr_t largestFreeEntry = 0;
+	bool useSizeIndex = false;
 	
 	if (lockingRequired) {
 		_heapLock.acquire();
 	}
 
-#if defined(OMR_GC_CONCURRENT_SWEEP)
 retry:
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 
 	currentFreeEntry = _heapFreeList;
 	previousFreeEntry = NULL;
@@ -443,11 +465,22 @@ retry:
 	allocateHintUsed = NULL;
 	candidateHintSize = 0;
 
-	/* Large object - use a hint if it is available */
-	allocateHintUsed = findHint(sizeInBytesRequired);
-	if(allocateHintUsed) {
-		currentFreeEntry = allocateHintUsed->heapFreeHeader;
-		candidateHintSize = allocateHintUsed->size;
+	/* Entries are realigned as the walk reaches them while a Balanced survivor region is being filled, which the size index does not follow */
+	useSizeIndex = _sizeIndexEnabled && (FREE_ENTRY_END == _firstUnalignedFreeEntry);
+	if (useSizeIndex) {
+		/* Start after the furthest entry known to be preceded only by smaller ones */
+		MM_HeapLinkedFreeHeader *indexEntry = _sizeIndex.find(sizeInBytesRequired, _heapFreeList, &candidateHintSize);
+		if (NULL != indexEntry) {
+			previousFreeEntry = indexEntry;
+			currentFreeEntry = indexEntry->getNext(compressed);
+		}
+	} else {
+		/* Large object - use a hint if it is available */
+		allocateHintUsed = findHint(sizeInBytesRequired);
+		if(allocateHintUsed) {
+			currentFreeEntry = allocateHintUsed->heapFreeHeader;
+			candidateHintSize = allocateHintUsed->size;
+		}
 	}
 
 
@@ -482,16 +515,24 @@ retry:
 
 	/* Check if an entry was found */
 	if(!currentFreeEntry) {
-#if defined(OMR_GC_CONCURRENT_SWEEP)
+		if (useSizeIndex && (NULL != previousFreeEntry)) {
+			/* Until the list changes, searches for this size or more can go straight to its tail */
+			_sizeIndex.exhausted(sizeInBytesRequired, previousFreeEntry, candidateHintSize, _heapFreeList);
+			/* Entries up to the index entry were skipped, none of them is larger than the candidate size */
+			largestFreeEntry = OMR_MAX(largestFreeEntry, candidateHintSize);
+		}
 		if(_memorySubSpace->replenishPoolForAllocate(env, this, sizeInBytesRequired)) {
 			goto retry;
 		}
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 		goto fail_allocate;
 	}
 
 	_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(currentFreeEntry->getSize());
-	if((walkCount >= J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK) || ((walkCount > 1) && allocateHintUsed)) {
+	if (useSizeIndex) {
+		if (NULL != previousFreeEntry) {
+			_sizeIndex.update(sizeInBytesRequired, previousFreeEntry, candidateHintSize, _heapFreeList);
+		}
+	} else if((walkCount >= J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK) || ((walkCount > 1) && allocateHintUsed)) {
 		addHint(previousFreeEntry, candidateHintSize);
 	}
 
@@ -514,6 +555,10 @@ retry:
 			_prevFirstUnalignedFreeEntry = recycleEntry;
 		}
 		updateHint(currentFreeEntry, recycleEntry);
+		if (_sizeIndexEnabled) {
+			_sizeIndex.replace(currentFreeEntry, recycleEntry);
+		}
+		updateConnectPreviousFreeEntry(currentFreeEntry, recycleEntry);
 		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
 	} else {
 		if (currentFreeEntry->getNext(compressed) == _firstUnalignedFreeEntry) {
@@ -528,6 +573,10 @@ retry:
 
 		/* Removed from the free list - Kill the hint if necessary */
 		removeHint(currentFreeEntry);
+		if (_sizeIndexEnabled) {
+			_sizeIndex.replace(currentFreeEntry, previousFreeEntry);
+		}
+		updateConnectPreviousFreeEntry(currentFreeEntry, previousFreeEntry);
 	}
 	
 	/* Collector object allocate stats for Survivor are not interesting (_largeObjectCollectorAllocateStats is null for Survivor) */	
@@ -602,7 +651,6 @@ MM_MemoryPoolAddressOrderedList::internalAllocateTLH(MM_EnvironmentBase *env, ui
 
 retry:
 	freeEntry = _heapFreeList;
-#if defined(OMR_GC_CONCURRENT_SWEEP)
 
 	/* Check if an entry was found */
 	if(!freeEntry) {
@@ -611,13 +659,6 @@ retry:
 		}
 		goto fail_allocate;
 	}
-#else /* OMR_GC_CONCURRENT_SWEEP */
-
-	/* Check if an entry was found */
-	if(!freeEntry) {
-		goto fail_allocate;
-	}
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 
 	if (doesNeedAlignment(env, freeEntry)) {
 		freeEntry = doFreeEntryAlignmentUpTo(env, freeEntry);
@@ -660,11 +701,14 @@ retry:
 			if (entryNext == _firstUnalignedFreeEntry) {
 				_prevFirstUnalignedFreeEntry = (MM_HeapLinkedFreeHeader *)addrTop;
 			}
+			updateConnectPreviousFreeEntry(freeEntry, (MM_HeapLinkedFreeHeader *)addrTop);
 			_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
 		} else {
 			if (entryNext == _firstUnalignedFreeEntry) {
 				_prevFirstUnalignedFreeEntry = FREE_ENTRY_END;
 			}
+			/* The head of the list has no previous entry */
+			updateConnectPreviousFreeEntry(freeEntry, NULL);
 		/* Adjust the free memory size and count */
 			_freeMemorySize -= recycleEntrySize;
 			_freeEntryCount -= 1;
@@ -677,6 +721,7 @@ retry:
 		}
 		/* If not recycling just update the free list pointer to the next free entry */
 		_heapFreeList = entryNext;
+		updateConnectPreviousFreeEntry(freeEntry, NULL);
 		/* also update the freeEntryCount as recycleHeapChunk would do this */
 		_freeEntryCount -= 1;
 	}
@@ -748,6 +793,10 @@ MM_MemoryPoolAddressOrderedList::reset(Cause cause)
 	MM_MemoryPool::reset(cause);
 
 	clearHints();
+	if (_sizeIndexEnabled) {
+		/* Pick up the latest allocation profile before the list is rebuilt */
+		_sizeIndex.setBounds(_largeObjectAllocateStats, _minimumFreeEntrySize);
+	}
 	_heapFreeList = (MM_HeapLinkedFreeHeader *)NULL;
 	_scannableBytes = 0;
 	_nonScannableBytes = 0;
@@ -849,6 +898,8 @@ MM_MemoryPoolAddressOrderedList::expandWithRange(MM_EnvironmentBase *env, uintpt
 		return ;
 	}
 
+	clearSizeIndex();
+
 	/* Find the free entries in the list the appear before/after the range being added */
 	previousFreeEntry = NULL;
 	nextFreeEntry = _heapFreeList;
@@ -955,6 +1006,8 @@ MM_MemoryPoolAddressOrderedList::contractWithRange(MM_EnvironmentBase *env, uint
 		return NULL;
 	}
 
+	clearSizeIndex();
+
 	/* Find the free entry that encompasses the range to contract */
 	/* TODO: Could we use hints to find a better starting address?  Are hints still valid? */
 	previousFreeEntry = NULL;
@@ -1043,6 +1096,8 @@ MM_MemoryPoolAddressOrderedList::addFreeEntries(MM_EnvironmentBase *env,
 
 	MM_HeapLinkedFreeHeader *currentFreeEntry = freeListHead;
 
+	clearSizeIndex();
+
 	while (currentFreeEntry != NULL) {
 		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(currentFreeEntry->getSize());
 		currentFreeEntry = currentFreeEntry->getNext(compressed);
@@ -1141,6 +1196,8 @@ MM_MemoryPoolAddressOrderedList::removeFreeEntriesWithinRange(MM_EnvironmentBase
 	retListMemoryCount = 0;
 	retListMemorySize = 0;
 
+	clearSizeIndex();
+
 	/* Find the first free entry, if any, within specified range */
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
@@ -1503,6 +1560,8 @@ MM_MemoryPoolAddressOrderedList::moveHeap(MM_EnvironmentBase *env, void *srcBase
 	bool const compressed = compressObjectReferences();
 	MM_HeapLinkedFreeHeader *currentFreeEntry, *previousFreeEntry;
 
+	clearSizeIndex();
+
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
 	while(currentFreeEntry) {
@@ -1553,6 +1612,8 @@ MM_MemoryPoolAddressOrderedList::recycleHeapChunk(void* chunkBase, void* chunkTo
 
 	_heapLock.acquire();
 
+	clearSizeIndex();
+
 	if ((NULL == _heapFreeList) || (chunkBase < (void*)_heapFreeList)) {
 		/* Add to front of freelist */
 		recycled = recycleHeapChunk(chunkBase, chunkTop, NULL, _heapFreeList);
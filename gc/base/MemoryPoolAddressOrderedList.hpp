@@ -33,6 +33,7 @@
 #include "HeapRegionDescriptor.hpp"
 #include "EnvironmentBase.hpp"
 #include "AtomicOperations.hpp"
+#include "FreeEntrySizeIndex.hpp"
 
 class MM_AllocateDescription;
 #if defined(OMR_GC_CONCURRENT_SWEEP)
@@ -60,6 +61,10 @@ private:
 	struct J9ModronAllocateHint* _hintInactive;
 	struct J9ModronAllocateHint _hintStorage[HINT_ELEMENT_COUNT];
 	uintptr_t _hintLru;
+
+	/* Size index support, used in place of hints when enabled */
+	MM_FreeEntrySizeIndex _sizeIndex;
+	bool _sizeIndexEnabled;
 	
 	MM_LargeObjectAllocateStats *_largeObjectCollectorAllocateStats;  /**< Same as _largeObjectAllocateStats except specifically for collector allocates */
 
@@ -78,8 +83,10 @@ private:
 	void updateHint(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry);
 	void clearHints();
 	void updateHintsBeyondEntry(MM_HeapLinkedFreeHeader *freeEntry);
+	void clearSizeIndex() { _sizeIndex.clear(); }
 	void *internalAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 	bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
+	void updateConnectPreviousFreeEntry(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry);
 
 	MMINLINE bool doesNeedAlignment(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *freeEntry)
 	{
@@ -206,12 +213,15 @@ public:
 	{
 		_firstUnalignedFreeEntry = (NULL == _heapFreeList) ? FREE_ENTRY_END : _heapFreeList;
 		_prevFirstUnalignedFreeEntry =  FREE_ENTRY_END;
+		/* alignment splits and removes entries behind the size index's back */
+		clearSizeIndex();
 	}
 
 	MMINLINE void resetFirstUnalignedFreeEntry()
 	{
 		_firstUnalignedFreeEntry =  FREE_ENTRY_END;
 		_prevFirstUnalignedFreeEntry =  FREE_ENTRY_END;
+		clearSizeIndex();
 	}
 
 	MMINLINE virtual uintptr_t getDarkMatterBytes()
@@ -230,6 +240,7 @@ public:
 	MM_MemoryPoolAddressOrderedList(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize) :
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize)
 		,_heapFreeList(NULL)
+		,_sizeIndexEnabled(false)
 		,_largeObjectCollectorAllocateStats(NULL)
 		,_firstUnalignedFreeEntry(FREE_ENTRY_END)
 		,_prevFirstUnalignedFreeEntry(FREE_ENTRY_END)
@@ -240,6 +251,7 @@ public:
 	MM_MemoryPoolAddressOrderedList(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize, const char *name) :
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize, name)
 		,_heapFreeList(NULL)
+		,_sizeIndexEnabled(false)
 		,_largeObjectCollectorAllocateStats(NULL)
 		,_firstUnalignedFreeEntry(FREE_ENTRY_END)
 		,_prevFirstUnalignedFreeEntry(FREE_ENTRY_END)
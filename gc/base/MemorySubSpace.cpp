@@ -1860,7 +1860,6 @@ MM_MemorySubSpace::runEnqueuedCounterBalancing(MM_EnvironmentBase* env)
 	}
 }
 
-#if defined(OMR_GC_CONCURRENT_SWEEP)
 /**
  * Replenish a pools free lists to satisfy a given allocate.
  * The given pool was unable to satisfy an allocation request of (at least) the given size.  See if there is work
@@ -1882,7 +1881,6 @@ MM_MemorySubSpace::replenishPoolForAllocate(MM_EnvironmentBase* env, MM_MemoryPo
 	/* We have a parent, forward the request to it */
 	return _parent->replenishPoolForAllocate(env, memoryPool, size);
 }
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 
 /**
  * Determine whether the given subspace is a descendant of the receiver.
@@ -49,6 +49,8 @@ GC_ObjectHeapBufferedIterator::init(MM_GCExtensionsBase* extensions, MM_HeapRegi
 	_state.extensions = extensions;
 	_state.includeDeadObjects = includeDeadObjects;
 	_populator->initializeObjectHeapBufferedIteratorState(region, &_state);
+	/* the state starts out covering the whole region */
+	_populator->reset(region, &_state, base, top);
 	_cacheCount = _populator->populateObjectHeapBufferedIteratorCache(_cache, _cacheSizeToUse, &_state);
 }
 
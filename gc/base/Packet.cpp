@@ -49,8 +49,9 @@ MM_Packet::peek(MM_EnvironmentBase *env)
  * @return TRUE is packet initialized OK; FALSE otheriwse
  */ 
 bool
-MM_Packet::initialize(MM_EnvironmentBase *env, MM_Packet *next, MM_Packet *previous, uintptr_t *baseAddress,  uintptr_t size)
+MM_Packet::initialize(MM_EnvironmentBase *env, MM_Packet *next, MM_Packet *previous, uintptr_t *baseAddress,  uintptr_t size, uintptr_t packetIndex)
 {
+	_packetIndex = packetIndex;
 
 	_next = next;
 	_previous = previous;
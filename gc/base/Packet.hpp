@@ -45,6 +45,7 @@ private:
 	uintptr_t *_topPtr;
 	uintptr_t *_currentPtr;
 	uintptr_t _sublistIndex;
+	uintptr_t _packetIndex; /**< position of the packet amongst all packets, identifying it on lock-free packet lists */
 	MM_EnvironmentBase *_owner;
 protected:
 public:
@@ -65,6 +66,11 @@ private:
 		_sublistIndex = sublistIndex;
 	}
 
+	MMINLINE uintptr_t getPacketIndex()
+	{
+		return _packetIndex;
+	}
+
 protected:
 public:
 	/**
@@ -200,7 +206,7 @@ public:
 		memset(_basePtr, 0, ((uint8_t*)_topPtr-(uint8_t*)_basePtr));
 	}
 
-	bool initialize(MM_EnvironmentBase *env, MM_Packet *next, MM_Packet *previous, uintptr_t *baseAddress,  uintptr_t size);
+	bool initialize(MM_EnvironmentBase *env, MM_Packet *next, MM_Packet *previous, uintptr_t *baseAddress,  uintptr_t size, uintptr_t packetIndex);
 
 	/**
 	 * Create a Packet object.
@@ -212,6 +218,7 @@ public:
 		_topPtr(NULL),
 		_currentPtr(NULL),
 		_sublistIndex(0),
+		_packetIndex(0),
 		_owner(NULL),
 		_next(NULL),
 		_previous(NULL)
@@ -28,10 +28,12 @@
 #include "PacketList.hpp"
 
 bool 
-MM_PacketList::initialize(MM_EnvironmentBase *env)
+MM_PacketList::initialize(MM_EnvironmentBase *env, MM_Packet **packetTable)
 {
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 	bool result = true;
+
+	_packetTable = packetTable;
 	
 	_sublistCount = extensions->packetListSplit;
 	Assert_MM_true(0 < _sublistCount);
@@ -73,6 +75,16 @@ MM_PacketList::pushList(MM_Packet *head, MM_Packet *tail, uintptr_t count)
 	PacketSublist *list = &_sublists[0];
 	MM_Packet *current = head;
 	uintptr_t i;
+
+	if (isLockFree()) {
+		for (i = 0; i < count; ++i) {
+			current->setSublistIndex(0);
+			current = current->_next;
+		}
+		MM_AtomicOperations::add(&_count, count);
+		pushLockFree(list, head, tail);
+		return;
+	}
 	
 	list->_lock.acquire();
 	
@@ -101,6 +113,38 @@ MM_PacketList::popList(MM_Packet **head, MM_Packet **tail, uintptr_t *count)
 	*head = NULL;
 	*tail = NULL;
 	*count = 0;
+
+	if (isLockFree()) {
+		/* detach each sublist in one exchange, then walk the detached chains to find their tails */
+		for (uintptr_t i = 0; i < _sublistCount; i++) {
+			PacketSublist *list = &_sublists[i];
+			uint64_t oldTop = list->_top;
+			while (NULL != decodeTop(oldTop)) {
+				uint64_t witness = MM_AtomicOperations::lockCompareExchangeU64(&list->_top, oldTop, encodeTop(oldTop, NULL));
+				if (witness == oldTop) {
+					break;
+				}
+				oldTop = witness;
+			}
+			MM_Packet *packet = decodeTop(oldTop);
+			if (NULL != packet) {
+				didPop = true;
+				if (NULL == *head) {
+					*head = packet;
+				} else {
+					(*tail)->_next = packet;
+				}
+				*count += 1;
+				while (NULL != packet->_next) {
+					packet = packet->_next;
+					*count += 1;
+				}
+				*tail = packet;
+			}
+		}
+		MM_AtomicOperations::subtract(&_count, *count);
+		return didPop;
+	}
 	
 	/* acquire all of our locks */
 	for (uintptr_t i = 0; i < _sublistCount; i++) {
@@ -146,6 +190,9 @@ MM_PacketList::remove(MM_Packet *packetToRemove)
 	PacketSublist *list = &_sublists[packetToRemove->getSublistIndex()];
 	MM_Packet *previous = NULL;
 	MM_Packet *next = NULL;
+
+	/* a lock-free stack cannot unlink from the middle */
+	Assert_MM_false(isLockFree());
 	
 	list->_lock.acquire();
 	
@@ -188,7 +235,7 @@ MM_PacketList::getHead()
 	
 	if (popList(&head, &tail, &count)) {
 		pushList(head, tail, count);
-		result = _sublists[0]._head;
+		result = isLockFree() ? decodeTop(_sublists[0]._top) : _sublists[0]._head;
 	}
 
 	return result;
@@ -30,6 +30,7 @@
 
 #include "omrcfg.h"
 #include "omr.h"
+#include "modronopt.h"
 #include "ModronAssertions.h"
 
 #include "AtomicOperations.hpp"
@@ -49,6 +50,7 @@ public:
 		MM_Packet * _head;  /**< Head of the list */
 		MM_Packet * _tail;  /**< Tail of the list */
 		MM_LightweightNonReentrantLock _lock;  /**< Lock for getting/putting packets */
+		volatile uint64_t _top; /**< Top of the lock-free stack used instead of _head, _tail and _lock: a tag changed by every update in the high 32 bits, the packet index + 1 (0 when empty) in the low 32 bits */
 
 		bool
 		initialize(MM_EnvironmentBase *env)
@@ -62,6 +64,7 @@ public:
 		PacketSublist()
 			: _head(NULL)
 			, _tail(NULL)
+			, _top(0)
 		{
 		}
 	};
@@ -73,9 +76,75 @@ private:
 	
 	uintptr_t _sublistCount; /**< the number of lists (split for parallelism). Must be at least 1 */
 	volatile uintptr_t _count;  /**< Number of items in the list */
+	MM_Packet **_packetTable; /**< all packets by packet index when the sublists are lock-free stacks, NULL when they are locked */
 	
 /* Functionality Section */
 private:
+	/**
+	 * @return the packet on top of a lock-free stack with the given top value, or NULL if it is empty
+	 */
+	MMINLINE MM_Packet *
+	decodeTop(uint64_t top)
+	{
+		uint32_t index = (uint32_t)top;
+		return (0 == index) ? NULL : _packetTable[index - 1];
+	}
+
+	/**
+	 * @return the top value which replaces oldTop to make packet the top of a lock-free stack
+	 */
+	MMINLINE uint64_t
+	encodeTop(uint64_t oldTop, MM_Packet *packet)
+	{
+		/* a new tag every time stops a packet popped and pushed back in the meantime (ABA) from fooling the exchange */
+		uint64_t tag = ((oldTop >> 32) + 1) << 32;
+		return tag | ((NULL == packet) ? 0 : (uint64_t)(packet->getPacketIndex() + 1));
+	}
+
+	/**
+	 * Push a chain of packets linked through _next onto a lock-free stack.
+	 * @return the number of times the exchange lost a race with another thread
+	 */
+	MMINLINE uintptr_t
+	pushLockFree(PacketSublist *list, MM_Packet *head, MM_Packet *tail)
+	{
+		uintptr_t failures = 0;
+		uint64_t oldTop = list->_top;
+		while (true) {
+			tail->_next = decodeTop(oldTop);
+			uint64_t witness = MM_AtomicOperations::lockCompareExchangeU64(&list->_top, oldTop, encodeTop(oldTop, head));
+			if (witness == oldTop) {
+				break;
+			}
+			oldTop = witness;
+			failures += 1;
+		}
+		return failures;
+	}
+
+	/**
+	 * Pop the top packet off a lock-free stack.
+	 * Packets are never freed while on or off the lists, so reading the _next of a packet another thread has
+	 * just popped is harmless: the tag makes the exchange fail.
+	 * @param failures[out] incremented every time the exchange loses a race with another thread
+	 * @return the packet, or NULL if the stack is empty
+	 */
+	MMINLINE MM_Packet *
+	popLockFree(PacketSublist *list, uintptr_t *failures)
+	{
+		uint64_t oldTop = list->_top;
+		MM_Packet *packet = NULL;
+		while (NULL != (packet = decodeTop(oldTop))) {
+			uint64_t witness = MM_AtomicOperations::lockCompareExchangeU64(&list->_top, oldTop, encodeTop(oldTop, packet->_next));
+			if (witness == oldTop) {
+				break;
+			}
+			oldTop = witness;
+			*failures += 1;
+		}
+		return packet;
+	}
+
 	/**
 	 * Increment the shared counter by the specified amount.
 	 * Must be called inside of a locked region
@@ -126,8 +195,14 @@ protected:
 	
 public:
 	
-	bool initialize(MM_EnvironmentBase *env);
+	/**
+	 * @param packetTable[in] all packets by packet index, to make the sublists lock-free stacks, or NULL for locked lists.
+	 * Lock-free lists do not support remove().
+	 */
+	bool initialize(MM_EnvironmentBase *env, MM_Packet **packetTable = NULL);
 	void tearDown(MM_EnvironmentBase *env) ;
+
+	MMINLINE bool isLockFree() { return NULL != _packetTable; }
 	
 	/**
 	 * Push a list of packets onto this packet list.
@@ -162,12 +237,25 @@ public:
 	{
 		uintptr_t index = getSublistIndex(env);
 		PacketSublist *list = &_sublists[index];
+
+		packet->setSublistIndex(index);
+		if (isLockFree()) {
+			/* count before pushing and after popping, so that the count never drops below the number of packets on the list */
+			MM_AtomicOperations::add(&_count, 1);
+			uintptr_t failures = pushLockFree(list, packet, packet);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_workPacketStats.packetListExchangeFailures += failures;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+			return;
+		}
 	
 		list->_lock.acquire();
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		env->_workPacketStats.packetListLockAcquires += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 		packet->_next = list->_head;
 		packet->_previous = NULL;
-		packet->setSublistIndex(index);
 		if (NULL == list->_head) {
 			list->_tail = packet;
 		} else {
@@ -189,11 +277,30 @@ public:
 		uintptr_t index = getSublistIndex(env);
 		MM_Packet *packet = NULL;
 
+		if (isLockFree()) {
+			uintptr_t failures = 0;
+			for (uintptr_t i = 0; i < _sublistCount; i++) {
+				packet = popLockFree(&_sublists[index], &failures);
+				if (NULL != packet) {
+					MM_AtomicOperations::subtract(&_count, 1);
+					break;
+				}
+				index = (index + 1) % _sublistCount;
+			}
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_workPacketStats.packetListExchangeFailures += failures;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+			return packet;
+		}
+
 		for (uintptr_t i = 0; i < _sublistCount; i++) {
 			PacketSublist *list = &_sublists[index];
 
 			if (NULL != list->_head) {
 				list->_lock.acquire();
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+				env->_workPacketStats.packetListLockAcquires += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 				if (NULL != list->_head) {
 					packet = list->_head;
 					list->_head = packet->_next;
@@ -254,6 +361,7 @@ public:
 		,_sublists(NULL)
 		,_sublistCount(0)
 		,_count(0)
+		,_packetTable(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -31,6 +31,7 @@
 #include "ModronAssertions.h"
 #include "ut_j9mm.h"
 
+#include "AtomicOperations.hpp"
 #include "Collector.hpp"
 #include "CollectorLanguageInterfaceImpl.hpp"
 #include "EnvironmentBase.hpp"
@@ -52,6 +53,10 @@ typedef struct workerThreadInfo {
 
 #define MINIMUM_HEAP_PER_THREAD (2*1024*1024)
 
+/* Iterations of a worker thread's spin for its next task between yields of its CPU to the OS, so spinning
+ * threads do not starve the main thread of CPU time when there are more GC threads than CPUs */
+#define WORKER_SPIN_YIELD_INTERVAL 256
+
 uintptr_t
 dispatcher_thread_proc2(OMRPortLibrary* portLib, void *info)
 {
@@ -151,6 +156,7 @@ void
 MM_ParallelDispatcher::workerEntryPoint(MM_EnvironmentBase *env) 
 {
 	uintptr_t workerID = env->getWorkerID();
+	bool spinForNextTask = false;
 	
 	setThreadInitializationComplete(env);
 	
@@ -163,6 +169,10 @@ MM_ParallelDispatcher::workerEntryPoint(MM_EnvironmentBase *env)
 				_threadsToReserve -= 1;
 				_statusTable[workerID] = worker_status_reserved;
 				_taskTable[workerID] = _task;
+			} else if (spinForNextTask) {
+				/* Just finished a task - another often follows immediately, so spin before parking */
+				spinForNextTask = false;
+				spinForTask(env);
 			} else {
 				omrthread_monitor_wait(_workerThreadMutex);
 			}
@@ -188,6 +198,7 @@ MM_ParallelDispatcher::workerEntryPoint(MM_EnvironmentBase *env)
 			omrthread_monitor_enter(_workerThreadMutex);
 			/* Returned from task - do clean up work from dispatch */
 			completeTask(env);
+			spinForNextTask = (0 != _extensions->dispatcherWorkerSpinCount);
 		}
 	}
 	omrthread_monitor_exit(_workerThreadMutex);	
@@ -419,6 +430,33 @@ MM_ParallelDispatcher::wakeUpThreads(uintptr_t count)
 	}
 }
 
+void
+MM_ParallelDispatcher::spinForTask(MM_EnvironmentBase *env)
+{
+	uintptr_t workerID = env->getWorkerID();
+	volatile uintptr_t *status = &_statusTable[workerID];
+	uintptr_t generation = _taskGeneration;
+
+	/* Counted as spinning until the mutex is reacquired, so a dispatch in the meantime need not notify this thread */
+	_spinningThreadCount += 1;
+	omrthread_monitor_exit(_workerThreadMutex);
+
+	for (uintptr_t spinCount = _extensions->dispatcherWorkerSpinCount; spinCount > 0; spinCount--) {
+		if ((generation != _taskGeneration) || (worker_status_waiting != *status)) {
+			/* A task was dispatched or the thread is being shut down */
+			break;
+		}
+		if (0 == (spinCount % WORKER_SPIN_YIELD_INTERVAL)) {
+			omrthread_yield();
+		} else {
+			MM_AtomicOperations::yieldCPU();
+		}
+	}
+
+	omrthread_monitor_enter(_workerThreadMutex);
+	_spinningThreadCount -= 1;
+}
+
 /**
  * Let tasks run with reduced thread count.
  * After the task is complete the thread count should be restored.
@@ -532,7 +570,12 @@ MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *t
 	/* Main thread doesn't need to be woken up */
 	Assert_MM_true(_threadsToReserve == 0);
 	_threadsToReserve = threadCount - 1;
-	wakeUpThreads(_threadsToReserve);
+	_taskGeneration += 1;
+
+	/* Spinning threads will see the new generation and check for a task before they wait, so only wake enough parked threads to cover the rest */
+	if (_threadsToReserve > _spinningThreadCount) {
+		wakeUpThreads(_threadsToReserve - _spinningThreadCount);
+	}
 
 	omrthread_monitor_exit(_workerThreadMutex);
 }
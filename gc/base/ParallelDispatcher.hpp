@@ -78,6 +78,8 @@ protected:
 	uintptr_t _threadCount; /**< number of threads currently forked */
 	uintptr_t _activeThreadCount; /**< number of threads actively running a task */
 	uintptr_t _threadsToReserve; /**< Indicates number of threads remaining to dispatch tasks upon notify. Must be exactly 0 after tasks are dispatched. */
+	volatile uintptr_t _taskGeneration; /**< Incremented each time a task is dispatched, watched by worker threads spinning for their next task */
+	uintptr_t _spinningThreadCount; /**< Number of worker threads spinning for the next task rather than waiting on _workerThreadMutex (protected by _workerThreadMutex) */
 
 	omrsig_handler_fn _handler;
 	void* _handler_arg;
@@ -109,6 +111,13 @@ protected:
 	virtual void acceptTask(MM_EnvironmentBase *env);
 	virtual void completeTask(MM_EnvironmentBase *env);
 	virtual void wakeUpThreads(uintptr_t count);
+
+	/**
+	 * Spin for up to -Xgc:dispatcherWorkerSpinCount= iterations waiting for the next task to be dispatched,
+	 * so that back to back tasks find the worker already awake. Called, and returns, with _workerThreadMutex held;
+	 * the mutex is released while spinning. The caller must still check for a task to reserve before waiting.
+	 */
+	virtual void spinForTask(MM_EnvironmentBase *env);
 	
 	virtual uintptr_t recomputeActiveThreadCountForTask(MM_EnvironmentBase *env, MM_Task *task, uintptr_t newThreadCount); 
 
@@ -155,6 +164,8 @@ public:
 		,_threadCount(1)
 		,_activeThreadCount(1)
 		,_threadsToReserve(0)		
+		,_taskGeneration(0)
+		,_spinningThreadCount(0)
 		,_handler(handler)
 		,_handler_arg(handler_arg)
 		,_defaultOSStackSize(defaultOSStackSize)
@@ -27,20 +27,17 @@
 #include "GCExtensionsBase.hpp"
 #include "ParallelTask.hpp"
 #include "ParallelDispatcher.hpp"
-#include "HeapMapIterator.hpp"
+#include "HeapChunkCursor.hpp"
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionDescriptor.hpp"
 #include "HeapRegionManager.hpp"
 #include "MarkMap.hpp"
-#include "MarkMapSegmentChunkIterator.hpp"
-#include "MemorySubSpace.hpp"
 #include "ParallelGlobalGC.hpp"
 #include "ParallelObjectHeapIterator.hpp"
-#include "ObjectModel.hpp"
 #include "OMRVMInterface.hpp"
 
 /**
- * @todo Provide class documentation
+ * Walks the chunks of a MM_HeapChunkCursor on each thread of the task.
  * @ingroup GC_Modron_Standard
  */
 class MM_ParallelObjectDoTask : public MM_ParallelTask
@@ -51,9 +48,8 @@ class MM_ParallelObjectDoTask : public MM_ParallelTask
 private:
 	MM_HeapWalkerObjectFunc _function;
 	void *_userData;
-	uintptr_t _walkFlags;
 
-	MM_ParallelHeapWalker *_heapWalker;
+	MM_HeapChunkCursor *_cursor;
 
 protected:
 public:
@@ -67,14 +63,13 @@ public:
 	virtual void run(MM_EnvironmentBase *env);
 
 	/*
-	 * Create a ParallelObjectAndVMSlotsDoTask object.
+	 * Create a ParallelObjectDoTask object.
 	 */
-	MM_ParallelObjectDoTask(MM_EnvironmentBase *env, MM_ParallelHeapWalker *heapWalker, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool parallel)
+	MM_ParallelObjectDoTask(MM_EnvironmentBase *env, MM_HeapChunkCursor *cursor, MM_HeapWalkerObjectFunc function, void *userData)
 		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
 		, _function(function)
 		, _userData(userData)
-		, _walkFlags(walkFlags)
-		, _heapWalker(heapWalker)
+		, _cursor(cursor)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -137,6 +132,27 @@ MM_ParallelHeapWalker::allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalk
 	Trc_MM_ParallelHeapWalker_allObjectsDoParallel_Exit(env->getLanguageVMThread(), heapChunkFactor, parallelChunkSize, objectsWalked);
 }
 
+/**
+ * Dispatch a task which walks through all live objects of the heap in chunks claimed by the GC threads,
+ * applying the provided function.
+ */
+void
+MM_ParallelHeapWalker::allObjectsDoChunked(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, uintptr_t threadCount)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	/* without a valid mark map there is no way to find where an object starts within a region */
+	MM_HeapChunkCursor cursor(env, _markMap->isMarkMapValid() ? _markMap : NULL, extensions->parallelHeapWalkChunkSize);
+	if (cursor.initialize(env, walkFlags)) {
+		MM_ParallelObjectDoTask objectDoTask(env, &cursor, function, userData);
+		extensions->dispatcher->run(env, &objectDoTask, threadCount);
+		cursor.tearDown(env);
+	} else {
+		cursor.tearDown(env);
+		MM_HeapWalker::allObjectsDo(env, function, userData, walkFlags, false, false);
+	}
+}
+
 /**
  * Walk through all live objects of the heap and apply the provided function.
  * If parallel is set to true, task is dispatched to GC threads and walks the heap segments in parallel,
@@ -151,18 +167,20 @@ MM_ParallelHeapWalker::allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObject
 			_globalCollector->prepareHeapForWalk(env);
 		}
 
-		MM_ParallelObjectDoTask objectDoTask(env, this, function, userData, walkFlags, parallel);
-		env->getExtensions()->dispatcher->run(env, &objectDoTask);
+		allObjectsDoChunked(env, function, userData, walkFlags);
 	} else {
 		MM_HeapWalker::allObjectsDo(env, function, userData, walkFlags, parallel, prepareHeapForWalk);
 	}
 }
 
 /**
- * gets the heap walker and calls the actual objectSlotsDo function
+ * Walks chunks of the heap until all have been claimed
  */
 void
 MM_ParallelObjectDoTask::run(MM_EnvironmentBase *env)
 {
-	_heapWalker->allObjectsDoParallel(env, _function, _userData, _walkFlags);
+	Trc_MM_ParallelHeapWalker_allObjectsDoChunked_Entry(env->getLanguageVMThread());
+	uintptr_t chunksWalked = 0;
+	uintptr_t objectsWalked = _cursor->objectsDo(env, _function, _userData, &chunksWalked);
+	Trc_MM_ParallelHeapWalker_allObjectsDoChunked_Exit(env->getLanguageVMThread(), _cursor->getChunkSize(), chunksWalked, objectsWalked);
 }
@@ -51,9 +51,18 @@ protected:
 public:	
 	/**
 	 * Walk through all live objects of the heap in parallel and apply the provided function.
+	 * Must be called by every thread of the currently running task.
 	 */
 	void allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags);
 
+	/**
+	 * Dispatch a task to walk through all live objects of the heap in parallel and apply the provided function.
+	 * The walkable regions are split into chunks of parallelHeapWalkChunkSize bytes, which the GC threads
+	 * claim one at a time. The heap must have been prepared for walking. Must not be called from within a task.
+	 * @param threadCount[in] the maximum number of GC threads to walk with
+	 */
+	void allObjectsDoChunked(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, uintptr_t threadCount = UDATA_MAX);
+
 	/**
 	 * Walk through all live objects of the heap and apply the provided function.
 	 * If parallel is set to true, task is dispatched to GC threads and walks the heap segments in parallel,
@@ -80,11 +89,6 @@ public:
 	{
 		_typeId = __FUNCTION__;
 	}
-
-	/*
-	 * Friends
-	 */
-	friend class MM_ParallelObjectDoTask;
 };
 
 #endif /* PARALLEL_HEAP_WALKER_HPP_ */
@@ -90,6 +90,15 @@ MM_ParallelMarkTask::cleanup(MM_EnvironmentBase *env)
 		env->_workPacketStats.workPacketsReleased,
 		env->_workPacketStats.workPacketsExchanged,
 		0/* TODO CRG figure out to get the array split size*/);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	Trc_MM_ParallelMarkTask_packetListStats(
+		env->getLanguageVMThread(),
+		(uint32_t)env->getWorkerID(),
+		env->getExtensions()->workPacketLockFreeLists ? "lock-free" : "locked",
+		env->_workPacketStats.packetListLockAcquires,
+		env->_workPacketStats.packetListExchangeFailures,
+		env->_workPacketStats.workPacketsCached);
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 }
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
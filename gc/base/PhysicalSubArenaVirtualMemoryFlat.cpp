@@ -225,6 +225,11 @@ MM_PhysicalSubArenaVirtualMemoryFlat::expandNoCheck(MM_EnvironmentBase *env, uin
 		} else {
 			genericSubSpace->heapReconfigured(env, HEAP_RECONFIG_EXPAND);
 		}
+
+		/* a heap which has just grown is likely to grow again by as much */
+		if (((MM_PhysicalArenaVirtualMemory *)_parent)->canExpand(env, this, _highAddress, expandSize)) {
+			_heap->expectExpansion(env, _highAddress, expandSize);
+		}
 	}
 
 	Assert_MM_true(_lowAddress == _region->getLowAddress());
@@ -308,7 +313,7 @@ MM_PhysicalSubArenaVirtualMemoryFlat::contract(MM_EnvironmentBase *env, uintptr_
 	genericSubSpace->removeExistingMemory(env, this, contractSize, (void *)contractBase, (void *)contractTop);
 
 	/* Everything is ok - decommit the memory */
-	_heap->decommitMemory((void *)contractBase, contractSize, lowValidAddress, highValidAddress);
+	_heap->decommitContractedMemory(env, (void *)contractBase, contractSize, lowValidAddress, highValidAddress);
 
 	/* Success - the area has been contracted.  Update internal values */
 	_highAddress = (void *)contractBase;
@@ -48,8 +48,46 @@
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCBINARY_LOGGING "-Xgc:binaryLogging"
+#define OMR_XGCBINARY_LOGGING_LENGTH 18
+#define OMR_XGCMAPPED_LOGGING "-Xgc:mappedLogging"
+#define OMR_XGCMAPPED_LOGGING_LENGTH 18
+#define OMR_XGCMAPPED_LOG_FILE_SIZE "-Xgc:mappedLogFileSize="
+#define OMR_XGCMAPPED_LOG_FILE_SIZE_LENGTH 23
+#define OMR_XGCDEFERREDHEAPDECOMMIT "-Xgc:deferredHeapDecommit"
+#define OMR_XGCDEFERREDHEAPDECOMMIT_LENGTH 25
+#define OMR_XGCHEAPDECOMMITLAZYFREE "-Xgc:heapDecommitLazyFree"
+#define OMR_XGCHEAPDECOMMITLAZYFREE_LENGTH 25
+#define OMR_XGCHEAPDECOMMITBATCHSIZE "-Xgc:heapDecommitBatchSize="
+#define OMR_XGCHEAPDECOMMITBATCHSIZE_LENGTH 27
+#define OMR_XGCHEAPPRECOMMIT "-Xgc:heapPrecommit"
+#define OMR_XGCHEAPPRECOMMIT_LENGTH 18
+#define OMR_XGCWORKPACKETLOCKFREELISTS "-Xgc:workPacketLockFreeLists"
+#define OMR_XGCWORKPACKETLOCKFREELISTS_LENGTH 28
+#define OMR_XGCWORKPACKETCACHE "-Xgc:workPacketCache"
+#define OMR_XGCWORKPACKETCACHE_LENGTH 20
+#define OMR_XGCWORKPACKETOVERFLOWSPILLSIZE "-Xgc:workPacketOverflowSpillSize="
+#define OMR_XGCWORKPACKETOVERFLOWSPILLSIZE_LENGTH 33
+#define OMR_XGCDISPATCHERWORKERSPINCOUNT "-Xgc:dispatcherWorkerSpinCount="
+#define OMR_XGCDISPATCHERWORKERSPINCOUNT_LENGTH 31
+#if defined(OMR_GC_MODRON_SCAVENGER)
+#define OMR_XGCSCAVENGERPAUSETARGET "-Xgc:scavengerPauseTarget="
+#define OMR_XGCSCAVENGERPAUSETARGET_LENGTH 26
+#endif /* OMR_GC_MODRON_SCAVENGER */
+#define OMR_XGCCONCURRENTKICKOFFFORECASTMARGIN "-Xgc:concurrentKickoffForecastMargin="
+#define OMR_XGCCONCURRENTKICKOFFFORECASTMARGIN_LENGTH 37
+#define OMR_XGCCONCURRENTKICKOFFFORECAST "-Xgc:concurrentKickoffForecast"
+#define OMR_XGCCONCURRENTKICKOFFFORECAST_LENGTH 30
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
+#define OMR_XGCFREELISTSIZEINDEX "-Xgc:freeListSizeIndex"
+#define OMR_XGCFREELISTSIZEINDEX_LENGTH 22
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+#define OMR_XGCTLHADAPTIVESIZING "-Xgc:tlhAdaptiveSizing"
+#define OMR_XGCTLHADAPTIVESIZING_LENGTH 22
+#define OMR_XGCTLHADAPTIVEREFRESHINTERVAL "-Xgc:tlhAdaptiveRefreshInterval="
+#define OMR_XGCTLHADAPTIVEREFRESHINTERVAL_LENGTH 32
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
 
 uintptr_t
 MM_StartupManager::getUDATAValue(char *option, uintptr_t *outputValue)
@@ -276,6 +314,71 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	else if (0 == strncmp(option, OMR_XGCBINARY_LOGGING, OMR_XGCBINARY_LOGGING_LENGTH)) {
+		extensions->binaryLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCMAPPED_LOGGING, OMR_XGCMAPPED_LOGGING_LENGTH)) {
+		extensions->mappedLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCMAPPED_LOG_FILE_SIZE, OMR_XGCMAPPED_LOG_FILE_SIZE_LENGTH)) {
+		uintptr_t value = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCMAPPED_LOG_FILE_SIZE_LENGTH, &value)) {
+			result = false;
+		} else {
+			extensions->mappedLogFileSize = value;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCDEFERREDHEAPDECOMMIT, OMR_XGCDEFERREDHEAPDECOMMIT_LENGTH)) {
+		extensions->deferredHeapDecommit = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCHEAPDECOMMITLAZYFREE, OMR_XGCHEAPDECOMMITLAZYFREE_LENGTH)) {
+		extensions->heapDecommitLazyFree = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCHEAPDECOMMITBATCHSIZE, OMR_XGCHEAPDECOMMITBATCHSIZE_LENGTH)) {
+		uintptr_t value = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCHEAPDECOMMITBATCHSIZE_LENGTH, &value) || (0 == value)) {
+			result = false;
+		} else {
+			extensions->heapDecommitBatchSize = value;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCHEAPPRECOMMIT, OMR_XGCHEAPPRECOMMIT_LENGTH)) {
+		extensions->heapPrecommit = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCWORKPACKETLOCKFREELISTS, OMR_XGCWORKPACKETLOCKFREELISTS_LENGTH)) {
+		extensions->workPacketLockFreeLists = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCWORKPACKETCACHE, OMR_XGCWORKPACKETCACHE_LENGTH)) {
+		extensions->workPacketCache = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCWORKPACKETOVERFLOWSPILLSIZE, OMR_XGCWORKPACKETOVERFLOWSPILLSIZE_LENGTH)) {
+		if (!getUDATAMemoryValue(option + OMR_XGCWORKPACKETOVERFLOWSPILLSIZE_LENGTH, &extensions->workPacketOverflowSpillSize)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCDISPATCHERWORKERSPINCOUNT, OMR_XGCDISPATCHERWORKERSPINCOUNT_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCDISPATCHERWORKERSPINCOUNT_LENGTH, &extensions->dispatcherWorkerSpinCount)) {
+			result = false;
+		}
+	}
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	else if (0 == strncmp(option, OMR_XGCSCAVENGERPAUSETARGET, OMR_XGCSCAVENGERPAUSETARGET_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCSCAVENGERPAUSETARGET_LENGTH, &extensions->scavengerPauseTarget)) {
+			result = false;
+		}
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	/* the margin option must be matched first, as the forecast option is a prefix of it */
+	else if (0 == strncmp(option, OMR_XGCCONCURRENTKICKOFFFORECASTMARGIN, OMR_XGCCONCURRENTKICKOFFFORECASTMARGIN_LENGTH)) {
+		if (!getUDATAMemoryValue(option + OMR_XGCCONCURRENTKICKOFFFORECASTMARGIN_LENGTH, &extensions->concurrentKickoffForecastMargin)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCCONCURRENTKICKOFFFORECAST, OMR_XGCCONCURRENTKICKOFFFORECAST_LENGTH)) {
+		extensions->concurrentKickoffForecast = true;
+	}
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
@@ -295,7 +398,23 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 			extensions->gcThreadCount = forcedThreadCount;
 			extensions->gcThreadCountForced = true;
 		}
-	} else {
+	}
+	else if (0 == strncmp(option, OMR_XGCFREELISTSIZEINDEX, OMR_XGCFREELISTSIZEINDEX_LENGTH)) {
+		extensions->freeListSizeIndex = true;
+	}
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	else if (0 == strncmp(option, OMR_XGCTLHADAPTIVESIZING, OMR_XGCTLHADAPTIVESIZING_LENGTH)) {
+		extensions->tlhAdaptiveSizing = true;
+	} else if (0 == strncmp(option, OMR_XGCTLHADAPTIVEREFRESHINTERVAL, OMR_XGCTLHADAPTIVEREFRESHINTERVAL_LENGTH)) {
+		uintptr_t interval = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCTLHADAPTIVEREFRESHINTERVAL_LENGTH, &interval)) {
+			result = false;
+		} else {
+			extensions->tlhAdaptiveRefreshInterval = interval;
+		}
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+	else {
 		/* unknown option */
 		result = false;
 	}
@@ -120,6 +120,8 @@ MM_TLHAllocationSupport::clear(MM_EnvironmentBase *env)
 	}
 
 	_tlh->refreshSize = extensions->tlhInitialSize;
+	_lastRefreshTime = 0;
+	_allocationRate = 0;
 }
 
 /**
@@ -142,7 +144,35 @@ MM_TLHAllocationSupport::restart(MM_EnvironmentBase *env)
 	/* Clear current information accumulated */
 	setAllZeroes();
 
-	_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	if (extensions->tlhAdaptiveSizing) {
+		/* the allocation rate already reflects the thread, the GC pause must not count against it */
+		_tlh->refreshSize = refreshSize;
+		_lastRefreshTime = 0;
+	} else {
+		_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	}
+}
+
+void
+MM_TLHAllocationSupport::adaptRefreshSize(MM_EnvironmentBase *env, uintptr_t usedSize)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uint64_t now = omrtime_hires_clock();
+
+	if (0 != _lastRefreshTime) {
+		/* a TLH used up within the clock resolution counts as used in a microsecond */
+		uint64_t elapsed = OMR_MAX(omrtime_hires_delta(_lastRefreshTime, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS), 1);
+		uintptr_t rate = (uintptr_t)(((uint64_t)usedSize * 1000) / elapsed);
+		/* weigh the latest TLH a quarter so one burst or pause does not swing the size */
+		_allocationRate = (0 == _allocationRate) ? rate : (((_allocationRate * 3) + rate) / 4);
+
+		uint64_t refreshSize = ((uint64_t)_allocationRate * extensions->tlhAdaptiveRefreshInterval) / 1000;
+		refreshSize = OMR_MIN(refreshSize, (uint64_t)extensions->tlhMaximumSize);
+		refreshSize = OMR_MAX(refreshSize, (uint64_t)extensions->tlhMinimumSize);
+		setRefreshSize(MM_Math::roundToCeiling(sizeof(uintptr_t), (uintptr_t)refreshSize));
+	}
+	_lastRefreshTime = now;
 }
 
 /**
@@ -164,7 +194,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	uintptr_t abandonSize = (tlhMinimumSize > halfRefreshSize ? tlhMinimumSize : halfRefreshSize);
 	if (sizeInBytesRequired > abandonSize) {
 		/* increase thread hungriness if we did not refresh */
-		if (getRefreshSize() < tlhMaximumSize && sizeInBytesRequired < tlhMaximumSize) {
+		if (!extensions->tlhAdaptiveSizing && (getRefreshSize() < tlhMaximumSize) && (sizeInBytesRequired < tlhMaximumSize)) {
 			setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 		}
 		return false;
@@ -176,6 +206,10 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	uintptr_t usedSize = getUsedSize();
 	stats->_tlhAllocatedUsed += usedSize;
 
+	if (extensions->tlhAdaptiveSizing) {
+		adaptRefreshSize(env, usedSize);
+	}
+
 	/* Try to cache the current TLH */
 	if ((NULL != getRealTop()) && (getRemainingSize() >= tlhMinimumSize)) {
 		/* Cache the current TLH because it is bigger than the minimum size */
@@ -285,7 +319,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 			 * may not give you the size requested */
 			/* Increase thread hungriness */
 			/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
-			if (getRefreshSize() < tlhMaximumSize) {
+			if (!extensions->tlhAdaptiveSizing && (getRefreshSize() < tlhMaximumSize)) {
 				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 			}
 		}
@@ -354,6 +388,17 @@ MM_TLHAllocationSupport::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescrip
 void
 MM_TLHAllocationSupport::flushCache(MM_EnvironmentBase *env)
 {
+	bool const compressed = env->compressObjectReferences();
+	MM_AllocationStats *stats = _objectAllocationInterface->getAllocationStats();
+
+	/* Whatever is left of the current and abandoned TLHs goes back to the heap unused */
+	uintptr_t flushedBytes = getRemainingSize();
+	for (MM_HeapLinkedFreeHeaderTLH *cache = _abandonedList; NULL != cache; cache = (MM_HeapLinkedFreeHeaderTLH *)cache->getNext(compressed)) {
+		flushedBytes += cache->getSize();
+	}
+	stats->_tlhFlushedBytes += flushedBytes;
+	_lastRefreshTime = 0;
+
 	/* Since AllocationStats have been reset, reset the base as well*/
 	_abandonedList = NULL;
 	_abandonedListSize = 0;
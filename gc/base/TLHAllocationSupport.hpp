@@ -81,6 +81,9 @@ private:
 	MM_HeapLinkedFreeHeaderTLH *_abandonedList; /**< List of abandoned TLHs. Shaped like a free list. */
 	uintptr_t _abandonedListSize; /**< Number of entries in the abandoned list. */
 
+	uint64_t _lastRefreshTime; /**< Hires clock at the last refresh, 0 if the current TLH did not start with a refresh */
+	uintptr_t _allocationRate; /**< Moving average of the bytes per millisecond the thread allocates from its TLHs (tlhAdaptiveSizing) */
+
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
 public:
@@ -144,6 +147,13 @@ private:
 	void restart(MM_EnvironmentBase *env);
 	bool refresh(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
 
+	/**
+	 * Update the allocation rate of the thread with the TLH being retired and size the next refresh
+	 * so that it lasts about tlhAdaptiveRefreshInterval.
+	 * @param usedSize[in] bytes allocated from the TLH being retired
+	 */
+	void adaptRefreshSize(MM_EnvironmentBase *env, uintptr_t usedSize);
+
 	void *allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
 
 	void setupTLH(MM_EnvironmentBase *env, void *addrBase, void *addrTop, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool);
@@ -191,6 +201,8 @@ private:
 		_objectAllocationInterface(NULL),
 		_abandonedList(NULL),
 		_abandonedListSize(0),
+		_lastRefreshTime(0),
+		_allocationRate(0),
 		_zeroTLH(zeroTLH)
 	{};
 
@@ -87,26 +87,6 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 
 	heapSize = _extensions->heap->getMaximumMemorySize();
 
-	if (!_emptyPacketList.initialize(env)) {
-		return false;
-	}
-	if (!_fullPacketList.initialize(env)) {
-		return false;
-	}
-	if (!_nonEmptyPacketList.initialize(env)) {
-		return false;
-	}
-	if (!_relativelyFullPacketList.initialize(env)) {
-		return false;
-	}
-	if (!_deferredPacketList.initialize(env)) {
-		return false;
-	}
-	
-	if (!_deferredFullPacketList.initialize(env)) {
-		return false;
-	}
-
 	if(omrthread_monitor_init_with_name(&_inputListMonitor, 0, "MM_WorkPackets::inputList")) {
 		return false;
 	}
@@ -144,6 +124,34 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 	/* If -Xgcworkpackets was specified  we don't allow later allocation of more packets */
 	_maxPackets = (0 != _extensions->workpacketCount) ? initialPacketCount : initialPacketCount * _increaseFactor;
 	
+	if (_extensions->workPacketLockFreeLists) {
+		/* lock-free lists identify packets by index, which must be resolvable before any packet is pushed */
+		_packetTable = (MM_Packet **)env->getForge()->allocate(sizeof(MM_Packet *) * _maxPackets, OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+		if (NULL == _packetTable) {
+			return false;
+		}
+	}
+
+	if (!_emptyPacketList.initialize(env, _packetTable)) {
+		return false;
+	}
+	if (!_fullPacketList.initialize(env, _packetTable)) {
+		return false;
+	}
+	if (!_nonEmptyPacketList.initialize(env, _packetTable)) {
+		return false;
+	}
+	if (!_relativelyFullPacketList.initialize(env, _packetTable)) {
+		return false;
+	}
+	if (!_deferredPacketList.initialize(env, _packetTable)) {
+		return false;
+	}
+	
+	if (!_deferredFullPacketList.initialize(env, _packetTable)) {
+		return false;
+	}
+
 	/* NULL out the packetsBlocks array to begin with */
 	for(uintptr_t i = 0; i < _maxPacketsBlocks; i++) {    
 		_packetsStart[i] = NULL;
@@ -193,7 +201,10 @@ MM_WorkPackets::initWorkPacketsBlock(MM_EnvironmentBase *env)
 
 	for(uintptr_t i = 0; i < _packetsPerBlock; i++) {
 		baseAddress = (uintptr_t *) (dataStart + (i * dataSize));
-		currentPtr->initialize(env, nextPtr, previousPtr, baseAddress, _slotsInPacket);
+		currentPtr->initialize(env, nextPtr, previousPtr, baseAddress, _slotsInPacket, _activePackets + i);
+		if (NULL != _packetTable) {
+			_packetTable[_activePackets + i] = currentPtr;
+		}
 
 		previousPtr = currentPtr;
 		currentPtr += 1;
@@ -247,6 +258,10 @@ MM_WorkPackets::tearDown(MM_EnvironmentBase *env)
 	_relativelyFullPacketList.tearDown(env);
 	_deferredPacketList.tearDown(env);
 	_deferredFullPacketList.tearDown(env);
+	if (NULL != _packetTable) {
+		env->getForge()->free(_packetTable);
+		_packetTable = NULL;
+	}
 }
 
 void
@@ -26,6 +26,7 @@
 #include "WorkStack.hpp"
 
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
 #include "WorkPackets.hpp"
 #include "Packet.hpp"
 #include "Task.hpp"
@@ -42,10 +43,12 @@ void
 MM_WorkStack::reset(MM_EnvironmentBase *env, MM_WorkPackets *workPackets)
 {
 	_workPackets = workPackets;
+	_packetCacheEnabled = env->getExtensions()->workPacketCache;
 	/* if any of these are non-NULL, we would be leaking memory */
 	Assert_MM_true(NULL == _inputPacket);
 	Assert_MM_true(NULL == _outputPacket);
 	Assert_MM_true(NULL == _deferredPacket);
+	Assert_MM_true(NULL == _cachedPacket);
 }
 
 void
@@ -53,10 +56,12 @@ MM_WorkStack::prepareForWork(MM_EnvironmentBase *env, MM_WorkPackets *workPacket
 {
 	if (NULL == _workPackets) {
 		_workPackets = workPackets;
+		_packetCacheEnabled = env->getExtensions()->workPacketCache;
 		/* this is our first time using this work stack instance so the packets should be NULL */
 		Assert_MM_true(NULL == _inputPacket);
 		Assert_MM_true(NULL == _outputPacket);
 		Assert_MM_true(NULL == _deferredPacket);
+		Assert_MM_true(NULL == _cachedPacket);
 	} else {
 		Assert_MM_true(_workPackets == workPackets);
 	}
@@ -83,6 +88,10 @@ MM_WorkStack::flush(MM_EnvironmentBase *env)
 		_workPackets->putDeferredPacket(env, _deferredPacket);
 		_deferredPacket = NULL;
 	}	
+	if(NULL != _cachedPacket) {
+		_workPackets->putPacket(env, _cachedPacket);
+		_cachedPacket = NULL;
+	}
 	_workPackets = NULL;
 }
 
@@ -135,8 +144,7 @@ MM_WorkStack::popNoWaitFailed(MM_EnvironmentBase *env)
 {
 	if(NULL != _inputPacket) {
 		/* The current input packet has been used up - return it to the output list for resuse */
-		_workPackets->putPacket(env, _inputPacket);
-		_inputPacket = NULL;
+		releaseInputPacket(env);
 	}
 
 	bool tryRetrieveInputPacket = true;
@@ -192,8 +200,7 @@ MM_WorkStack::popFailed(MM_EnvironmentBase *env)
 {
 	if(NULL != _inputPacket) {
 		/* The current input packet has been used up - return it to the output list for reuse */
-		_workPackets->putPacket(env, _inputPacket);
-		_inputPacket = NULL;
+		releaseInputPacket(env);
 	}
 
 	bool tryRetrieveInputPacket = true;
@@ -222,6 +229,30 @@ MM_WorkStack::popFailed(MM_EnvironmentBase *env)
 	return NULL;
 }
 
+void
+MM_WorkStack::releaseInputPacket(MM_EnvironmentBase *env)
+{
+	if (_packetCacheEnabled && (NULL == _cachedPacket)) {
+		_cachedPacket = _inputPacket;
+	} else {
+		_workPackets->putPacket(env, _inputPacket);
+	}
+	_inputPacket = NULL;
+}
+
+MM_Packet *
+MM_WorkStack::getOutputPacket(MM_EnvironmentBase *env)
+{
+	MM_Packet *packet = _cachedPacket;
+	if (NULL != packet) {
+		_cachedPacket = NULL;
+		env->_workPacketStats.workPacketsCached += 1;
+	} else {
+		packet = _workPackets->getOutputPacket(env);
+	}
+	return packet;
+}
+
 void MM_WorkStack::pushFailed(MM_EnvironmentBase *env, void *element)
 {
 	if(_outputPacket) {
@@ -230,7 +261,7 @@ void MM_WorkStack::pushFailed(MM_EnvironmentBase *env, void *element)
 	}
 
 	/* Get a new output packet */
-	_outputPacket = _workPackets->getOutputPacket(env);
+	_outputPacket = getOutputPacket(env);
 	if (NULL == _outputPacket) {
 		_workPackets->overflowItem(env, element, OVERFLOW_TYPE_WORKSTACK);
 	} else {
@@ -248,7 +279,7 @@ void MM_WorkStack::pushFailed(MM_EnvironmentBase *env, void *element1, void *ele
 	}
 
 	/* Get a new output packet */
-	_outputPacket = _workPackets->getOutputPacket(env);
+	_outputPacket = getOutputPacket(env);
 	if (NULL == _outputPacket) {
 		_workPackets->overflowItem(env, element1, OVERFLOW_TYPE_WORKSTACK);
 		_workPackets->overflowItem(env, element2, OVERFLOW_TYPE_WORKSTACK);
@@ -282,8 +313,7 @@ MM_WorkStack::popNoWaitFromCurrentInputPacket(MM_EnvironmentBase *env)
 		result = _inputPacket->pop(env);
 		if (NULL == result) {
 			/* The current input packet has been used up - return it to the output list for reuse */
-			_workPackets->putPacket(env, _inputPacket);
-			_inputPacket = NULL;
+			releaseInputPacket(env);
 		}
 	}
 	return result;
@@ -49,6 +49,8 @@ private:
 	MM_Packet *_inputPacket;
 	MM_Packet *_outputPacket;
 	MM_Packet *_deferredPacket;
+	MM_Packet *_cachedPacket; /**< an empty packet kept for the next output packet instead of going through the shared empty list */
+	bool _packetCacheEnabled; /**< cached copy of MM_GCExtensionsBase::workPacketCache */
 	
 	uintptr_t 		_pushCount;
 
@@ -85,6 +87,20 @@ private:
 	 */
 	void *popNoWaitFailed(MM_EnvironmentBase *env);
 
+	/**
+	 * Give up the used up input packet, keeping it in the packet cache if that is enabled and free.
+	 * Only empty packets are cached, so no work is ever hidden from other threads.
+	 * @param env[in] The thread which owns the work stack
+	 */
+	void releaseInputPacket(MM_EnvironmentBase *env);
+
+	/**
+	 * Get a new output packet, from the packet cache if it holds one.
+	 * @param env[in] The thread which owns the work stack
+	 * @return the packet, or NULL if none is available
+	 */
+	MM_Packet *getOutputPacket(MM_EnvironmentBase *env);
+
 public:
 	void reset(MM_EnvironmentBase *env, MM_WorkPackets *workPackets);
 	/**
@@ -231,7 +247,9 @@ public:
 		_workPackets(NULL),
 		_inputPacket(NULL),
 		_outputPacket(NULL),
-		_deferredPacket(NULL)
+		_deferredPacket(NULL),
+		_cachedPacket(NULL),
+		_packetCacheEnabled(false)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -75,6 +75,10 @@ MM_AllocationContextSegregated::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	if (!_depotLock.initialize(env, &env->getExtensions()->lnrlOptions, "MM_AllocationContextSegregated:_depotLock")) {
+		return false;
+	}
+
 	for (int32_t i = 0; i < OMR_SIZECLASSES_NUM_SMALL + 1; i++) {
 		_smallRegions[i] = NULL;
 		/* the small allocation lock needs to be acquired before small full region queue can be accessed, no concurrent access should be possible */
@@ -106,6 +110,8 @@ MM_AllocationContextSegregated::tearDown(MM_EnvironmentBase *env)
 		omrthread_monitor_destroy(_mutexArrayletAllocations);
 	}
 
+	_depotLock.tearDown();
+
 	for (int32_t i = 0; i < OMR_SIZECLASSES_NUM_SMALL + 1; i++) {
 		if (NULL != _perContextSmallFullRegions[i]) {
 			_perContextSmallFullRegions[i]->kill(env);
@@ -266,6 +272,9 @@ MM_AllocationContextSegregated::preAllocateSmall(MM_EnvironmentBase *env, uintpt
 
 	/* BEN TODO 1429: The object allocation interface base class should define all API used by this method such that casting would be unnecessary. */
 	MM_SegregatedAllocationInterface* segregatedAllocationInterface = (MM_SegregatedAllocationInterface*)env->_objectAllocationInterface;
+	if (segregatedAllocationInterface->magazinesEnabled(env)) {
+		return preAllocateSmallFromMagazine(env, segregatedAllocationInterface, sizeClass, sizeInBytesRequired);
+	}
 	uintptr_t replenishSize = segregatedAllocationInterface->getReplenishSize(env, sizeInBytesRequired);
 	uintptr_t preAllocatedBytes = 0;
 
@@ -318,6 +327,114 @@ MM_AllocationContextSegregated::preAllocateSmall(MM_EnvironmentBase *env, uintpt
 
 }
 
+uintptr_t *
+MM_AllocationContextSegregated::preAllocateSmallFromMagazine(MM_EnvironmentBase *env, MM_SegregatedAllocationInterface *allocationInterface, uintptr_t sizeClass, uintptr_t sizeInBytesRequired)
+{
+	MM_CellMagazine *magazine = allocationInterface->getMagazine(sizeClass);
+	uintptr_t *result = NULL;
+
+	if (magazine->isEmpty()) {
+		/* an unlocked peek is enough to skip the depot lock when there is nothing to take */
+		if (!_magazineDepots[sizeClass].isEmpty()) {
+			_depotLock.acquire();
+			_magazineDepots[sizeClass].get(magazine);
+			_depotLock.release();
+		}
+
+		if (magazine->isEmpty()) {
+			refillMagazine(env, sizeClass, allocationInterface->getReplenishSize(env, sizeInBytesRequired), magazine);
+		}
+	}
+
+	uintptr_t cacheSize = 0;
+	uintptr_t *cellList = magazine->pop(&cacheSize);
+	if (NULL != cellList) {
+		allocationInterface->replenishCache(env, sizeInBytesRequired, cellList, cacheSize);
+		result = (uintptr_t *) allocationInterface->allocateFromCache(env, sizeInBytesRequired);
+	}
+	return result;
+}
+
+void
+MM_AllocationContextSegregated::refillMagazine(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t replenishSize, MM_CellMagazine *magazine)
+{
+	uintptr_t magazineSize = OMR_MIN(env->getExtensions()->allocationCacheMagazineSize, OMR_SEGREGATED_MAGAZINE_CAPACITY);
+	uintptr_t sweepCount = 0;
+	uint64_t sweepStartTime = 0;
+	bool done = false;
+
+	smallAllocationLock();
+
+	while (!done) {
+		MM_HeapRegionDescriptorSegregated *region = _smallRegions[sizeClass];
+		if ((NULL != region) && region->getMemoryPoolACL()->hasCell()) {
+			carveMagazine(env, sizeClass, replenishSize, magazineSize, magazine);
+			/* another thread may have taken the last cells of the region without the lock if it has magazines disabled */
+			done = !magazine->isEmpty();
+		} else {
+			/* This may cause the start of a GC */
+			signalSmallRegionDepleted(env, sizeClass);
+
+			flushSmall(env, sizeClass);
+
+			/* Attempt to get a region of this size class which may already have some allocated cells */
+			if (!tryAllocateRegionFromSmallSizeClass(env, sizeClass)) {
+				/* Attempt to get a region by sweeping */
+				if (!trySweepAndAllocateRegionFromSmallSizeClass(env, sizeClass, &sweepCount, &sweepStartTime)) {
+					/* Attempt to get an unused region */
+					if (!tryAllocateFromRegionPool(env, sizeClass)) {
+						/* Really out of regions */
+						done = true;
+					}
+				}
+			}
+		}
+	}
+
+	if ((_count > 1) && !magazine->isEmpty() && _magazineDepots[sizeClass].isEmpty()) {
+		/* the context is shared, so stock the depot from the same region while the lock is held */
+		MM_CellMagazine spare;
+		carveMagazine(env, sizeClass, replenishSize, magazineSize, &spare);
+		if (!spare.isEmpty()) {
+			_depotLock.acquire();
+			if (!_magazineDepots[sizeClass].put(&spare)) {
+				spare.flush(env->compressObjectReferences());
+			}
+			_depotLock.release();
+		}
+	}
+
+	smallAllocationUnlock();
+}
+
+void
+MM_AllocationContextSegregated::carveMagazine(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t replenishSize, uintptr_t magazineSize, MM_CellMagazine *magazine)
+{
+	MM_HeapRegionDescriptorSegregated *region = _smallRegions[sizeClass];
+	if (NULL != region) {
+		uintptr_t firstRange = magazine->getCount();
+		uintptr_t cellSize = env->getExtensions()->defaultSizeClasses->getCellSize(sizeClass);
+		region->getMemoryPoolACL()->preAllocateCellRanges(env, cellSize, replenishSize, magazine, magazineSize);
+		if (shouldPreMarkSmallCells(env)) {
+			for (uintptr_t i = firstRange; i < magazine->getCount(); i++) {
+				_markingScheme->preMarkSmallCells(env, region, magazine->getCells(i), magazine->getSize(i));
+			}
+		}
+	}
+}
+
+void
+MM_AllocationContextSegregated::flushMagazineDepots(MM_EnvironmentBase *env)
+{
+	bool const compressed = env->compressObjectReferences();
+
+	_depotLock.acquire();
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		_magazineDepots[sizeClass].flush(compressed);
+	}
+	_depotLock.release();
+}
+
 uintptr_t *
 MM_AllocationContextSegregated::allocateArraylet(MM_EnvironmentBase *env, omrarrayptr_t parent)
 {
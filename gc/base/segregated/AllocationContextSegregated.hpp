@@ -30,8 +30,10 @@
 #include "sizeclasses.h"
 
 #include "AllocationContext.hpp"
+#include "CellMagazine.hpp"
 #include "EnvironmentBase.hpp"
 #include "HeapRegionDescriptorSegregated.hpp"
+#include "LightweightNonReentrantLock.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
@@ -39,6 +41,7 @@ class MM_GlobalAllocationManagerSegregated;
 class MM_HeapRegionDescriptorSegregated;
 class MM_HeapRegionQueue;
 class MM_HeapRegionDescriptorSegregated;
+class MM_SegregatedAllocationInterface;
 class MM_SegregatedMarkingScheme;
 class MM_RegionPoolSegregated;
 
@@ -62,6 +65,9 @@ private:
 	MM_HeapRegionQueue *_perContextArrayletFullRegions; /**< Per-context Arraylet regions that have been allocated into during this GC cycle. */
 	MM_HeapRegionQueue *_perContextLargeFullRegions; /**< Per-context Large object regions that have been allocated into during this GC cycle. */
 
+	MM_LightweightNonReentrantLock _depotLock; /**< Protects _magazineDepots */
+	MM_CellMagazineDepot _magazineDepots[OMR_SIZECLASSES_NUM_SMALL+1]; /**< Full magazines of pre-allocated cells shared by the threads of this context (per size class) */
+
 /* Methods */
 public:
 	static MM_AllocationContextSegregated *newInstance(MM_EnvironmentBase *env, MM_GlobalAllocationManagerSegregated *gam, MM_RegionPoolSegregated *regionPool);
@@ -105,6 +111,12 @@ public:
 
 	virtual uintptr_t *allocateLarge(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired);
 
+	/**
+	 * Drop the pre-allocated cells held in the magazine depot, making them walkable.
+	 * Must be called whenever the threads' allocation caches are flushed for a GC.
+	 */
+	void flushMagazineDepots(MM_EnvironmentBase *env);
+
 	void setMarkingScheme(MM_SegregatedMarkingScheme *markingScheme) { _markingScheme = markingScheme; }
 
 	uintptr_t *allocateArraylet(MM_EnvironmentBase *env, omrarrayptr_t parent);
@@ -207,6 +219,25 @@ protected:
 	bool tryAllocateFromRegionPool(MM_EnvironmentBase *env, uintptr_t sizeClass);
 
 private:
+	/**
+	 * Replenish the thread's allocation cache from its magazine for the size class, refilling the magazine
+	 * from the depot, or carving a magazine's worth of cell ranges from the context's region, when it is empty.
+	 * @return the carved off first cell, or NULL if the heap is out of regions for the size class
+	 */
+	uintptr_t *preAllocateSmallFromMagazine(MM_EnvironmentBase *env, MM_SegregatedAllocationInterface *allocationInterface, uintptr_t sizeClass, uintptr_t sizeInBytesRequired);
+
+	/**
+	 * Carve cell ranges for the size class into the empty magazine under a single acquisition of the small
+	 * allocation lock, moving to another region when the current one is depleted. When other threads share
+	 * the context a spare magazine is carved for the depot as well.
+	 */
+	void refillMagazine(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t replenishSize, MM_CellMagazine *magazine);
+
+	/**
+	 * Carve up to magazineSize cell ranges from the current region of the size class into the magazine, pre-marking them as required.
+	 * The small allocation lock must be held.
+	 */
+	void carveMagazine(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t replenishSize, uintptr_t magazineSize, MM_CellMagazine *magazine);
 
 };
 
@@ -0,0 +1,250 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(CELLMAGAZINE_HPP_)
+#define CELLMAGAZINE_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "BaseNonVirtual.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/* The most cell ranges a magazine can hold */
+#define OMR_SEGREGATED_MAGAZINE_CAPACITY 8
+/* The most full magazines a depot keeps for one size class */
+#define OMR_SEGREGATED_DEPOT_CAPACITY 4
+
+/**
+ * A fixed capacity batch of pre-allocated cell ranges of a single size class.
+ * A thread hands the ranges to its allocation cache one at a time without taking any lock, and only goes back
+ * to its allocation context once the whole magazine has been used.
+ */
+class MM_CellMagazine : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	uintptr_t *_cells[OMR_SEGREGATED_MAGAZINE_CAPACITY]; /**< first cell of each range */
+	uintptr_t _sizes[OMR_SEGREGATED_MAGAZINE_CAPACITY]; /**< size in bytes of each range */
+	uintptr_t _next; /**< index of the next range to hand out */
+	uintptr_t _count; /**< number of ranges added since the magazine was last empty */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	/**
+	 * @return the number of ranges left in the magazine
+	 */
+	MMINLINE uintptr_t getCount() { return _count - _next; }
+
+	MMINLINE bool isEmpty() { return _next == _count; }
+
+	/**
+	 * @param index[in] the position of a range from the next one to be handed out, below getCount()
+	 * @return the first cell of the range
+	 */
+	MMINLINE uintptr_t *getCells(uintptr_t index) { return _cells[_next + index]; }
+
+	/**
+	 * @param index[in] the position of a range from the next one to be handed out, below getCount()
+	 * @return the size of the range in bytes
+	 */
+	MMINLINE uintptr_t getSize(uintptr_t index) { return _sizes[_next + index]; }
+
+	/**
+	 * Add a range of cells to the magazine.
+	 * @param cells[in] the first cell of the range
+	 * @param size[in] the size of the range in bytes
+	 * @return true if the range was added, false if the magazine is full
+	 */
+	MMINLINE bool
+	push(uintptr_t *cells, uintptr_t size)
+	{
+		if (OMR_SEGREGATED_MAGAZINE_CAPACITY == _count) {
+			return false;
+		}
+		_cells[_count] = cells;
+		_sizes[_count] = size;
+		_count += 1;
+		return true;
+	}
+
+	/**
+	 * Take the oldest range out of the magazine, so that ranges carved from a region are used in address order.
+	 * @param size[out] the size of the range in bytes
+	 * @return the first cell of the range, or NULL if the magazine is empty
+	 */
+	MMINLINE uintptr_t *
+	pop(uintptr_t *size)
+	{
+		uintptr_t *cells = NULL;
+		if (_next < _count) {
+			cells = _cells[_next];
+			*size = _sizes[_next];
+			_next += 1;
+			if (_next == _count) {
+				_next = 0;
+				_count = 0;
+			}
+		}
+		return cells;
+	}
+
+	/**
+	 * Move all the ranges of another magazine into this one, which must be empty. The other magazine is left empty.
+	 * @param other[in] the magazine to take the ranges from
+	 */
+	MMINLINE void
+	takeAll(MM_CellMagazine *other)
+	{
+		uintptr_t count = other->getCount();
+		for (uintptr_t i = 0; i < count; i++) {
+			_cells[i] = other->_cells[other->_next + i];
+			_sizes[i] = other->_sizes[other->_next + i];
+		}
+		_next = 0;
+		_count = count;
+		other->_next = 0;
+		other->_count = 0;
+	}
+
+	/**
+	 * Make the remaining ranges walkable and drop them. They stay allocated until the region is next swept.
+	 * @param compressed[in] true if object references are compressed
+	 */
+	MMINLINE void
+	flush(bool compressed)
+	{
+		for (uintptr_t i = _next; i < _count; i++) {
+			MM_HeapLinkedFreeHeader::fillWithHoles(_cells[i], _sizes[i], compressed);
+		}
+		_next = 0;
+		_count = 0;
+	}
+
+	/**
+	 * Create a CellMagazine object.
+	 */
+	MM_CellMagazine()
+		: MM_BaseNonVirtual()
+		, _next(0)
+		, _count(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+/**
+ * Full magazines of a single size class shared by the threads of an allocation context, so that a thread whose
+ * magazine runs dry can pick up a whole magazine of ranges carved by another thread.
+ * The depot does no locking of its own; the owning allocation context serializes access.
+ */
+class MM_CellMagazineDepot : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_CellMagazine _magazines[OMR_SEGREGATED_DEPOT_CAPACITY]; /**< full magazines, the first _fullCount are in use */
+	uintptr_t _fullCount; /**< number of full magazines held */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	MMINLINE bool isEmpty() { return 0 == _fullCount; }
+	MMINLINE bool isFull() { return OMR_SEGREGATED_DEPOT_CAPACITY == _fullCount; }
+
+	/**
+	 * Move the ranges of one of the depot's magazines into the given empty magazine.
+	 * @param magazine[in] the magazine to fill
+	 * @return true if the magazine was filled, false if the depot is empty
+	 */
+	MMINLINE bool
+	get(MM_CellMagazine *magazine)
+	{
+		if (0 == _fullCount) {
+			return false;
+		}
+		_fullCount -= 1;
+		magazine->takeAll(&_magazines[_fullCount]);
+		return true;
+	}
+
+	/**
+	 * Move the ranges of the given magazine into the depot, leaving the given magazine empty.
+	 * @param magazine[in] the magazine to empty
+	 * @return true if the depot took the ranges, false if the depot is full
+	 */
+	MMINLINE bool
+	put(MM_CellMagazine *magazine)
+	{
+		if (OMR_SEGREGATED_DEPOT_CAPACITY == _fullCount) {
+			return false;
+		}
+		_magazines[_fullCount].takeAll(magazine);
+		_fullCount += 1;
+		return true;
+	}
+
+	/**
+	 * Make the ranges of every magazine walkable and drop them.
+	 * @param compressed[in] true if object references are compressed
+	 */
+	MMINLINE void
+	flush(bool compressed)
+	{
+		for (uintptr_t i = 0; i < _fullCount; i++) {
+			_magazines[i].flush(compressed);
+		}
+		_fullCount = 0;
+	}
+
+	/**
+	 * Create a CellMagazineDepot object.
+	 */
+	MM_CellMagazineDepot()
+		: MM_BaseNonVirtual()
+		, _fullCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* CELLMAGAZINE_HPP_ */
@@ -79,12 +79,13 @@ MM_ConfigurationSegregated::initialize(MM_EnvironmentBase *env)
 {
 
 	bool success = false;
-
-	/* OMRTODO investigate why these must be equal or it segfaults. */
 	MM_GCExtensionsBase *extensions = env->getExtensions();
-	extensions->splitAvailableListSplitAmount = extensions->gcThreadCount;
 
 	if (MM_Configuration::initialize(env)) {
+		/* OMRTODO investigate why these must be equal or it segfaults.
+		 * gcThreadCount is only settled by MM_Configuration::initialize, so this must follow it.
+		 */
+		extensions->splitAvailableListSplitAmount = extensions->gcThreadCount;
 		env->getOmrVM()->_sizeClasses = _delegate.getSegregatedSizeClasses(env);
 		if (NULL != env->getOmrVM()->_sizeClasses) {
 			extensions->setSegregatedHeap(true);
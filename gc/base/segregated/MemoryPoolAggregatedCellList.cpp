@@ -25,6 +25,7 @@
 #include "GCExtensionsBase.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
+#include "CellMagazine.hpp"
 #include "HeapRegionDescriptorSegregated.hpp"
 #include "SizeClasses.hpp"
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
@@ -93,6 +94,62 @@ MM_MemoryPoolAggregatedCellList::preAllocateCells(MM_EnvironmentBase* env, uintp
 	return allocatedCellList;
 }
 
+/**
+ * Pre allocates several lists of cells within the region under a single acquisition of the region lock.
+ * Stops early if the region runs out of free cells.
+ * @param desiredBytes the desired amount of bytes to be pre-allocated for each list
+ * @param magazine the magazine the lists are added to
+ * @param maxRanges the number of lists the magazine should hold when done
+ * @return the number of lists added to the magazine
+ */
+uintptr_t
+MM_MemoryPoolAggregatedCellList::preAllocateCellRanges(MM_EnvironmentBase* env, uintptr_t cellSize, uintptr_t desiredBytes, MM_CellMagazine *magazine, uintptr_t maxRanges)
+{
+	uintptr_t desiredCellCount = OMR_MAX(1, desiredBytes / cellSize);
+	uintptr_t adjustedDesiredBytes = desiredCellCount * cellSize;
+	uintptr_t rangeCount = 0;
+	uintptr_t preAllocatedBytes = 0;
+	bool const compressed = compressObjectReferences();
+
+	_lock.acquire();
+
+	while (magazine->getCount() < maxRanges) {
+		if (_heapCurrent == _heapTop) {
+			/* The current chunk is empty, get the next one */
+			refreshCurrentEntry();
+			if (NULL == _heapCurrent) {
+				break;
+			}
+		}
+
+		uintptr_t *allocatedCellList = _heapCurrent;
+		uintptr_t allocatedBytes = 0;
+		if ((uintptr_t)_heapTop - (uintptr_t)_heapCurrent > adjustedDesiredBytes) {
+			/* Carve off the desired part */
+			allocatedBytes = adjustedDesiredBytes;
+			_heapCurrent = (uintptr_t *)((uintptr_t)_heapCurrent + adjustedDesiredBytes);
+		} else {
+			/* Take the whole free chunk */
+			allocatedBytes = (uintptr_t)_heapTop - (uintptr_t)_heapCurrent;
+			refreshCurrentEntry();
+		}
+		magazine->push(allocatedCellList, allocatedBytes);
+		preAllocatedBytes += allocatedBytes;
+		rangeCount += 1;
+	}
+
+	if (_heapCurrent < _heapTop) {
+		/* Make the remainder walkable */
+		MM_HeapLinkedFreeHeader::fillWithHoles(_heapCurrent, (uintptr_t)_heapTop - (uintptr_t)_heapCurrent, compressed);
+	}
+	if (0 != preAllocatedBytes) {
+		addBytesAllocated(env, preAllocatedBytes);
+	}
+	_lock.release();
+
+	return rangeCount;
+}
+
 /**
  * @todo Provide function documentation
  */
@@ -37,6 +37,7 @@
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
 class MM_HeapRegionDescriptorSegregated;
+class MM_CellMagazine;
 class MM_MarkMap;
 
 class MM_MemoryPoolAggregatedCellList : public MM_MemoryPool
@@ -122,6 +123,7 @@ public:
 	void returnCell(MM_EnvironmentBase *env, uintptr_t *cell);
 	MMINLINE bool hasCell() { return (_freeListHead != NULL) || (_heapCurrent < _heapTop); }
 	uintptr_t* preAllocateCells(MM_EnvironmentBase* env, uintptr_t cellSize, uintptr_t desiredBytes, uintptr_t* preAllocatedBytesOutput);
+	uintptr_t preAllocateCellRanges(MM_EnvironmentBase* env, uintptr_t cellSize, uintptr_t desiredBytes, MM_CellMagazine *magazine, uintptr_t maxRanges);
 	void addBytesAllocated(MM_EnvironmentBase* env, uintptr_t bytesAllocated);
 	uintptr_t debugCountFreeBytes();
 	
@@ -325,7 +325,20 @@ MM_RegionPoolSegregated::allocateFromRegionPool(MM_EnvironmentBase *env, uintptr
 void
 MM_RegionPoolSegregated::joinBucketListsForSplitIndex(MM_EnvironmentBase *env)
 {
-	uintptr_t splitIndex = env->getWorkerID() % _splitAvailableListSplitCount;
+	joinBucketLists(env->getWorkerID() % _splitAvailableListSplitCount);
+}
+
+void
+MM_RegionPoolSegregated::joinBucketListsForAllSplitIndexes(MM_EnvironmentBase *env)
+{
+	for (uintptr_t splitIndex = 0; splitIndex < _splitAvailableListSplitCount; splitIndex++) {
+		joinBucketLists(splitIndex);
+	}
+}
+
+void
+MM_RegionPoolSegregated::joinBucketLists(uintptr_t splitIndex)
+{
 	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
 		MM_LockingHeapRegionQueue *primaryQueue = &(_smallAvailableRegions[sizeClass][PRIMARY_BUCKET])[splitIndex];
 		for (int32_t i=1; i<NUM_DEFRAG_BUCKETS; i++) {
@@ -408,6 +421,9 @@ MM_RegionPoolSegregated::sweepAndAllocateRegionFromSmallSizeClass(MM_Environment
 
 	if (region != NULL) {
 		_sweepScheme->sweepRegion(env, region);
+		if (_sweepScheme->isBackgroundSweepActive()) {
+			_sweepScheme->incrementMutatorSweptRegions();
+		}
 		/* Keep maintaining the occupancy info even while doing nondeterministic sweeps */
 		_smallOccupancy[sizeClass] = (_smallOccupancy[sizeClass] * 0.9f) + (region->getMemoryPoolACL()->getMarkCount() / region->getNumCells() * 0.1f );
 		decrementCurrentCountOfSweepRegions(sizeClass, 1);
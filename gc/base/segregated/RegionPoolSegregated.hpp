@@ -147,6 +147,8 @@ public:
 	 * Function members
 	 */
 private:
+	void joinBucketLists(uintptr_t splitIndex);
+
 	MMINLINE void 
 	incrementRegionsInUse(uintptr_t value)
 	{
@@ -257,6 +259,12 @@ public:
 	MMINLINE uintptr_t getDarkMatterCellCount(uintptr_t sizeClass) { return _darkMatterCellCount[sizeClass]; }
 
 	void joinBucketListsForSplitIndex(MM_EnvironmentBase *env);
+
+	/**
+	 * Join the defragment bucket lists of every split index, for use outside of a GC task
+	 * once the last small region has been swept in the background.
+	 */
+	void joinBucketListsForAllSplitIndexes(MM_EnvironmentBase *env);
 	
 	void setSweepScheme(MM_SweepSchemeSegregated *sweepScheme) { _sweepScheme = sweepScheme; }
 
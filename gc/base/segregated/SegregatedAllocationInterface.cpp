@@ -183,6 +183,10 @@ MM_SegregatedAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_All
 		}
 	}
 
+	if ((NULL != cell) && (sizeInBytes <= OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES)) {
+		TRIGGER_J9HOOK_MM_PRIVATE_SMALL_ALLOCATION(env->getExtensions()->privateHookInterface, env->getOmrVMThread(), sizeInBytes);
+	}
+
 	if ((NULL != cell) && !allocateDescription->isCompletedFromTlh()) {
 		_stats._allocationBytes += allocateDescription->getContiguousBytes();
 		++_stats._allocationCount;
@@ -262,6 +266,16 @@ MM_SegregatedAllocationInterface::flushCache(MM_EnvironmentBase *env)
 		}
 	}
 	memset(_allocationCache, 0, sizeof(LanguageSegregatedAllocationCache));
+
+	/* the magazines, and the depot of the context they are refilled from, hold pre-allocated cells too */
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		_magazines[sizeClass].flush(compressed);
+	}
+	MM_AllocationContextSegregated *ac = (MM_AllocationContextSegregated *) env->getAllocationContext();
+	if (NULL != ac) {
+		ac->flushMagazineDepots(env);
+	}
+
 	env->getExtensions()->allocationStats.merge(&_stats);
 	_stats.clear();
 }
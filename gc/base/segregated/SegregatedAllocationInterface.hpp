@@ -26,6 +26,7 @@
 #include "omrcfg.h"
 #include "sizeclasses.h"
 
+#include "CellMagazine.hpp"
 #include "LanguageSegregatedAllocationCache.hpp"
 
 #include "ObjectAllocationInterface.hpp"
@@ -59,6 +60,8 @@ private:
 	
 	uintptr_t *_allocationCacheBases[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< The Base of each current cache (per size class). */
 
+	MM_CellMagazine _magazines[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< Pre-allocated cell ranges waiting to become the current cache (per size class). */
+
 	/*
 	 * Function members
 	 */
@@ -90,6 +93,12 @@ public:
 	void* allocateFromCache(MM_EnvironmentBase* env, uintptr_t sizeInBytes);
 	void replenishCache(MM_EnvironmentBase* env, uintptr_t sizeInBytes, void *cacheMemory, uintptr_t cacheSize);
 	uintptr_t getReplenishSize(MM_EnvironmentBase* env, uintptr_t sizeInBytes);
+
+	/**
+	 * @return true if the cache is replenished from per size class magazines of pre-allocated cell ranges
+	 */
+	MMINLINE bool magazinesEnabled(MM_EnvironmentBase* env) { return _cachedAllocationsEnabled && (0 != env->getExtensions()->allocationCacheMagazineSize); }
+	MMINLINE MM_CellMagazine *getMagazine(uintptr_t sizeClass) { return &_magazines[sizeClass]; }
 	
 	virtual void enableCachedAllocations(MM_EnvironmentBase *env);
 	virtual void disableCachedAllocations(MM_EnvironmentBase *env);
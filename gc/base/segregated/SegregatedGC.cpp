@@ -94,6 +94,13 @@ MM_SegregatedGC::initialize(MM_EnvironmentBase *env)
 	}
 
 	_sweepScheme->setClearMarkMapAfterSweep(false);
+
+	if (_extensions->sizeClassHistogram) {
+		_sizeClassHistogram = MM_SizeClassHistogram::newInstance(env);
+		if (NULL == _sizeClassHistogram) {
+			return false;
+		}
+	}
 	return true;
 }
 
@@ -112,6 +119,11 @@ MM_SegregatedGC::tearDown(MM_EnvironmentBase *env)
 		_sweepScheme->kill(env);
 		_sweepScheme = NULL;
 	}
+
+	if (NULL != _sizeClassHistogram) {
+		_sizeClassHistogram->kill(env);
+		_sizeClassHistogram = NULL;
+	}
 }
 
 bool
@@ -129,12 +141,23 @@ MM_SegregatedGC::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *sub
 bool
 MM_SegregatedGC::collectorStartup(MM_GCExtensionsBase* extensions)
 {
-	return true;
+	bool result = true;
+	if (extensions->backgroundSweep) {
+		result = _sweepScheme->startupBackgroundSweep();
+	}
+	return result;
 }
 
 void
 MM_SegregatedGC::collectorShutdown(MM_GCExtensionsBase *extensions)
 {
+	if (extensions->backgroundSweep) {
+		_sweepScheme->shutdownBackgroundSweep();
+	}
+
+	if (NULL != _sizeClassHistogram) {
+		_sizeClassHistogram->report(extensions);
+	}
 }
 
 void *
@@ -178,6 +201,10 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	env->_cycleState->_activeSubSpace->reset();
 	_extensions->globalGCStats.clear();
 	_extensions->globalGCStats.gcCount++;
+	if (_extensions->backgroundSweep) {
+		/* regions the background sweeper has not reached are swept by this GC after marking */
+		_sweepScheme->suspendBackgroundSweep(env, &_extensions->globalGCStats.sweepStats);
+	}
 
 	/*
 	 * Marking
@@ -228,6 +255,9 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	bool isExplicitGC = env->_cycleState->_gcCode.isExplicitGC();
 	/* We now have accurate free space statistics so recalculate any expand/contract amount */
 	activeSubSpace->checkResize(env, allocDescription, isExplicitGC);
+	if (_extensions->backgroundSweep) {
+		_sweepScheme->resumeBackgroundSweep(env, sweepStats);
+	}
 	sweepStats->_endTime = omrtime_hires_clock();
 	reportSweepEnd(env);
 
@@ -30,6 +30,7 @@
 #include "GlobalCollector.hpp"
 #include "MarkMap.hpp"
 #include "SegregatedMarkingScheme.hpp"
+#include "SizeClassHistogram.hpp"
 #include "SweepSchemeSegregated.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
@@ -44,6 +45,7 @@ protected:
 	OMRPortLibrary *_portLibrary;
 	MM_SegregatedMarkingScheme *_markingScheme;
 	MM_SweepSchemeSegregated *_sweepScheme;
+	MM_SizeClassHistogram *_sizeClassHistogram; /**< Allocation size histogram, only when -Xgc:sizeClassHistogram is specified */
 	MM_ParallelDispatcher *_dispatcher;
 
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the main cycle state for GC activity */
@@ -118,6 +120,7 @@ public:
 		, _portLibrary(env->getPortLibrary())
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
+		, _sizeClassHistogram(NULL)
 		, _dispatcher(_extensions->dispatcher)
 		, _scanBytes(0)
 		, _objectsMarked(0)
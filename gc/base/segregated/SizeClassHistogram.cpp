@@ -0,0 +1,206 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "SizeClassHistogram.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "SizeClasses.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/* Smallest derived cell, big enough to hold a free list entry */
+#define MINIMUM_CELL_GRANULES (((2 * sizeof(uintptr_t)) + OMR_SIZECLASSES_HISTOGRAM_GRANULE - 1) / OMR_SIZECLASSES_HISTOGRAM_GRANULE)
+#define MAXIMUM_CELL_GRANULES (OMR_SIZECLASSES_HISTOGRAM_BUCKETS - 1)
+
+MM_SizeClassHistogram *
+MM_SizeClassHistogram::newInstance(MM_EnvironmentBase *env)
+{
+	MM_SizeClassHistogram *histogram = (MM_SizeClassHistogram *)env->getForge()->allocate(sizeof(MM_SizeClassHistogram), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != histogram) {
+		new(histogram) MM_SizeClassHistogram(env);
+		if (!histogram->initialize(env)) {
+			histogram->kill(env);
+			histogram = NULL;
+		}
+	}
+	return histogram;
+}
+
+void
+MM_SizeClassHistogram::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_SizeClassHistogram::initialize(MM_EnvironmentBase *env)
+{
+	memset((void *)_counts, 0, sizeof(_counts));
+	J9HookInterface **privateHooks = env->getExtensions()->getPrivateHookInterface();
+	return (0 == (*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_SMALL_ALLOCATION, hookSmallAllocation, OMR_GET_CALLSITE(), (void *)this));
+}
+
+void
+MM_SizeClassHistogram::tearDown(MM_EnvironmentBase *env)
+{
+	J9HookInterface **privateHooks = env->getExtensions()->getPrivateHookInterface();
+	(*privateHooks)->J9HookUnregister(privateHooks, J9HOOK_MM_PRIVATE_SMALL_ALLOCATION, hookSmallAllocation, (void *)this);
+}
+
+void
+MM_SizeClassHistogram::hookSmallAllocation(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	MM_SmallAllocationEvent *event = (MM_SmallAllocationEvent *)eventData;
+	((MM_SizeClassHistogram *)userData)->recordAllocation(event->bytesRequested);
+}
+
+bool
+MM_SizeClassHistogram::deriveCellSizes(const uint64_t *counts, uintptr_t *cellSizes)
+{
+	/* Prefix sums over granules make the cost of a size class O(1): a class whose cell is b granules and which
+	 * takes the allocations of (a, b] granules wastes b * (count[b] - count[a]) - (granules[b] - granules[a]).
+	 * Allocations smaller than the minimum cell are folded into it.
+	 */
+	uint64_t count[OMR_SIZECLASSES_HISTOGRAM_BUCKETS];
+	uint64_t granules[OMR_SIZECLASSES_HISTOGRAM_BUCKETS];
+	uint64_t folded = 0;
+	for (uintptr_t g = 0; g < MINIMUM_CELL_GRANULES; g++) {
+		folded += counts[g];
+		count[g] = 0;
+		granules[g] = 0;
+	}
+	for (uintptr_t g = MINIMUM_CELL_GRANULES; g <= MAXIMUM_CELL_GRANULES; g++) {
+		uint64_t seen = counts[g] + folded;
+		folded = 0;
+		count[g] = count[g - 1] + seen;
+		granules[g] = granules[g - 1] + (seen * g);
+	}
+	if (0 == count[MAXIMUM_CELL_GRANULES]) {
+		return false;
+	}
+
+	/* wasted[b] is the least waste of the classes chosen so far when the last of them has a cell of b granules,
+	 * previous[k][b] the cell of the class before it
+	 */
+	uint64_t wasted[OMR_SIZECLASSES_HISTOGRAM_BUCKETS];
+	uint64_t nextWasted[OMR_SIZECLASSES_HISTOGRAM_BUCKETS];
+	uint16_t previous[OMR_SIZECLASSES_NUM_SMALL + 1][OMR_SIZECLASSES_HISTOGRAM_BUCKETS];
+	uintptr_t base = MINIMUM_CELL_GRANULES - 1;
+	for (uintptr_t b = MINIMUM_CELL_GRANULES; b <= MAXIMUM_CELL_GRANULES; b++) {
+		wasted[b] = (b * count[b]) - granules[b];
+		previous[OMR_SIZECLASSES_MIN_SMALL][b] = (uint16_t)base;
+	}
+	for (uintptr_t k = OMR_SIZECLASSES_MIN_SMALL + 1; k <= OMR_SIZECLASSES_MAX_SMALL; k++) {
+		/* the k-th cell leaves room below it for k - 1 strictly smaller cells */
+		uintptr_t lowestCell = base + k;
+		for (uintptr_t b = lowestCell; b <= MAXIMUM_CELL_GRANULES; b++) {
+			uint64_t best = U_64_MAX;
+			uintptr_t bestPrevious = 0;
+			for (uintptr_t a = lowestCell - 1; a < b; a++) {
+				uint64_t cost = wasted[a] + (b * (count[b] - count[a])) - (granules[b] - granules[a]);
+				if (cost < best) {
+					best = cost;
+					bestPrevious = a;
+				}
+			}
+			nextWasted[b] = best;
+			previous[k][b] = (uint16_t)bestPrevious;
+		}
+		memcpy(wasted + lowestCell, nextWasted + lowestCell, (MAXIMUM_CELL_GRANULES + 1 - lowestCell) * sizeof(uint64_t));
+	}
+
+	/* the largest class must take every small allocation */
+	uintptr_t cell = MAXIMUM_CELL_GRANULES;
+	for (uintptr_t k = OMR_SIZECLASSES_MAX_SMALL; k >= OMR_SIZECLASSES_MIN_SMALL; k--) {
+		cellSizes[k] = cell * OMR_SIZECLASSES_HISTOGRAM_GRANULE;
+		cell = previous[k][cell];
+	}
+	cellSizes[0] = 0;
+	return true;
+}
+
+uint64_t
+MM_SizeClassHistogram::wastedBytes(const uint64_t *counts, const uintptr_t *cellSizes, uint64_t *cellBytes)
+{
+	uint64_t wasted = 0;
+	uint64_t used = 0;
+	uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL;
+	for (uintptr_t g = 0; g <= MAXIMUM_CELL_GRANULES; g++) {
+		uintptr_t size = g * OMR_SIZECLASSES_HISTOGRAM_GRANULE;
+		while (cellSizes[sizeClass] < size) {
+			sizeClass += 1;
+		}
+		wasted += counts[g] * (cellSizes[sizeClass] - size);
+		used += counts[g] * cellSizes[sizeClass];
+	}
+	*cellBytes = used;
+	return wasted;
+}
+
+void
+MM_SizeClassHistogram::report(MM_GCExtensionsBase *extensions)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(extensions->getOmrVM());
+	uint64_t counts[OMR_SIZECLASSES_HISTOGRAM_BUCKETS];
+	uint64_t total = 0;
+	for (uintptr_t g = 0; g < OMR_SIZECLASSES_HISTOGRAM_BUCKETS; g++) {
+		counts[g] = _counts[g];
+		total += counts[g];
+	}
+
+	omrtty_printf("Size class histogram: %llu small allocations\n", total);
+	if (0 == total) {
+		return;
+	}
+	for (uintptr_t g = 0; g < OMR_SIZECLASSES_HISTOGRAM_BUCKETS; g++) {
+		if (0 != counts[g]) {
+			omrtty_printf("  %5zu bytes: %llu\n", g * OMR_SIZECLASSES_HISTOGRAM_GRANULE, counts[g]);
+		}
+	}
+
+	uintptr_t currentCellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+	uintptr_t derivedCellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+	currentCellSizes[0] = 0;
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		currentCellSizes[sizeClass] = extensions->defaultSizeClasses->getCellSize(sizeClass);
+	}
+	deriveCellSizes(counts, derivedCellSizes);
+
+	const char *tableNames[] = {"current", "derived"};
+	const uintptr_t *tables[] = {currentCellSizes, derivedCellSizes};
+	for (uintptr_t t = 0; t < 2; t++) {
+		uint64_t cellBytes = 0;
+		uint64_t wasted = wastedBytes(counts, tables[t], &cellBytes);
+		omrtty_printf("  %s table: cell bytes %llu, internal fragmentation %llu bytes (%.2f%%)\n",
+				tableNames[t], cellBytes, wasted, (0 == cellBytes) ? 0.0 : (100.0 * (double)wasted / (double)cellBytes));
+	}
+
+	omrtty_printf("  -Xgc:sizeClasses=");
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		omrtty_printf((OMR_SIZECLASSES_MIN_SMALL == sizeClass) ? "%zu" : ",%zu", derivedCellSizes[sizeClass]);
+	}
+	omrtty_printf("\n");
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(SIZECLASSHISTOGRAM_HPP_)
+#define SIZECLASSHISTOGRAM_HPP_
+
+#include "omrcfg.h"
+#include "mmprivatehook.h"
+#include "sizeclasses.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/* Allocation sizes are recorded rounded up to this many bytes, the alignment of every derived cell size */
+#define OMR_SIZECLASSES_HISTOGRAM_GRANULE 8
+/* One bucket per granule up to and including OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES */
+#define OMR_SIZECLASSES_HISTOGRAM_BUCKETS ((OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES / OMR_SIZECLASSES_HISTOGRAM_GRANULE) + 1)
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+
+/**
+ * Histogram of small allocation sizes, recorded from the J9HOOK_MM_PRIVATE_SMALL_ALLOCATION hook,
+ * and the size class table minimizing internal fragmentation for it.
+ * The derived table is reported in the -Xgc:sizeClasses= form MM_SizeClasses loads at startup.
+ */
+class MM_SizeClassHistogram : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	volatile uint64_t _counts[OMR_SIZECLASSES_HISTOGRAM_BUCKETS]; /**< number of allocations seen, indexed by size in granules rounded up */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	static void hookSmallAllocation(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_SizeClassHistogram *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	MMINLINE void
+	recordAllocation(uintptr_t sizeInBytes)
+	{
+		MM_AtomicOperations::addU64(&_counts[(sizeInBytes + OMR_SIZECLASSES_HISTOGRAM_GRANULE - 1) / OMR_SIZECLASSES_HISTOGRAM_GRANULE], 1);
+	}
+
+	/**
+	 * Print the histogram and the fragmentation of the current and derived size class tables.
+	 */
+	void report(MM_GCExtensionsBase *extensions);
+
+	/**
+	 * Find the cell sizes which waste the fewest bytes for the given histogram.
+	 * @param counts[in] number of allocations of each size, indexed by size in granules rounded up
+	 * @param cellSizes[out] cell size of each size class, index 0 unused
+	 * @return true if a table was derived, false if the histogram is empty
+	 */
+	static bool deriveCellSizes(const uint64_t *counts, uintptr_t *cellSizes);
+
+	/**
+	 * Measure the internal fragmentation of a size class table for the given histogram.
+	 * @param counts[in] number of allocations of each size, indexed by size in granules rounded up
+	 * @param cellSizes[in] cell size of each size class, index 0 unused
+	 * @param cellBytes[out] total bytes of the cells the allocations would use
+	 * @return the bytes of those cells left unused by the allocations
+	 */
+	static uint64_t wastedBytes(const uint64_t *counts, const uintptr_t *cellSizes, uint64_t *cellBytes);
+
+	MM_SizeClassHistogram(MM_EnvironmentBase *env)
+		: MM_BaseVirtual()
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* SIZECLASSHISTOGRAM_HPP_ */
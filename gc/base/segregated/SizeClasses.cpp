@@ -22,6 +22,7 @@
 #include "SizeClasses.hpp"
 
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
@@ -61,7 +62,13 @@ MM_SizeClasses::initialize(MM_EnvironmentBase *env)
 	_smallNumCells = sizeClasses->smallNumCells;
 	_sizeClassIndex = sizeClasses->sizeClassIndex;
 	
-	memcpy(_smallCellSizes, initialCellSizes, sizeof(initialCellSizes));
+	uintptr_t *cellSizes = env->getExtensions()->sizeClassCellSizes;
+	if (0 == cellSizes[OMR_SIZECLASSES_MAX_SMALL]) {
+		cellSizes = initialCellSizes;
+	} else if (!validateCellSizes(cellSizes)) {
+		return false;
+	}
+	memcpy(_smallCellSizes, cellSizes, sizeof(initialCellSizes));
 	
 	_sizeClassIndex[0] = 0;
 	_smallNumCells[0] = 0;
@@ -76,6 +83,20 @@ MM_SizeClasses::initialize(MM_EnvironmentBase *env)
 	return true;
 }
 
+bool
+MM_SizeClasses::validateCellSizes(const uintptr_t *cellSizes)
+{
+	/* Keeping every cell a multiple of 8 bytes satisfies the alignment rule of SMALL_SIZECLASSES on all platforms */
+	uintptr_t previous = 2 * sizeof(uintptr_t) - 1;
+	for (uintptr_t szClass = OMR_SIZECLASSES_MIN_SMALL; szClass <= OMR_SIZECLASSES_MAX_SMALL; szClass++) {
+		if ((cellSizes[szClass] <= previous) || (0 != (cellSizes[szClass] % 8))) {
+			return false;
+		}
+		previous = cellSizes[szClass];
+	}
+	return (OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES == previous);
+}
+
 void
 MM_SizeClasses::tearDown(MM_EnvironmentBase *envModron)
 {
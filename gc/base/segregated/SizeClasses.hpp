@@ -72,6 +72,14 @@ public:
 		}
 		return _sizeClassIndex[sizeInBytes / sizeof(uintptr_t)];
 	}
+
+	/**
+	 * Check that a table of cell sizes can replace the built-in one: strictly increasing multiples of 8 bytes,
+	 * each large enough for a free list entry, ending with OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES.
+	 * @param cellSizes[in] cell size of each size class, index 0 unused
+	 * @return true if the table is usable, false otherwise
+	 */
+	static bool validateCellSizes(const uintptr_t *cellSizes);
 	
 protected:
 	bool initialize(MM_EnvironmentBase *env);
@@ -21,6 +21,7 @@
  *******************************************************************************/
 
 #include "omrcomp.h"
+#include "omrport.h"
 #include "sizeclasses.h"
 #include "ModronAssertions.h"
 
@@ -33,7 +34,9 @@
 #include "MarkMap.hpp"
 #include "MemoryPoolAggregatedCellList.hpp"
 #include "MemoryPoolSegregated.hpp"
+#include "ParallelDispatcher.hpp"
 #include "RegionPoolSegregated.hpp"
+#include "SweepStats.hpp"
 #include "Task.hpp"
 
 #include "SweepSchemeSegregated.hpp"
@@ -79,6 +82,9 @@ MM_SweepSchemeSegregated::kill(MM_EnvironmentBase *env)
 bool
 MM_SweepSchemeSegregated::initialize(MM_EnvironmentBase *env)
 {
+	if (0 != omrthread_monitor_init_with_name(&_backgroundSweepMonitor, 0, "MM_SweepSchemeSegregated::_backgroundSweepMonitor")) {
+		return false;
+	}
 	return true;
 }
 
@@ -89,6 +95,10 @@ MM_SweepSchemeSegregated::initialize(MM_EnvironmentBase *env)
 void
 MM_SweepSchemeSegregated::tearDown(MM_EnvironmentBase *env)
 {
+	if (NULL != _backgroundSweepMonitor) {
+		omrthread_monitor_destroy(_backgroundSweepMonitor);
+		_backgroundSweepMonitor = NULL;
+	}
 }
 
 void
@@ -113,16 +123,25 @@ MM_SweepSchemeSegregated::sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated
 	
 	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		/* A heap walk needs every region swept and an explicit GC is expected to leave the heap fully swept */
+		_sweepSmallInBackground = (BACKGROUND_SWEEP_WAITING == _backgroundSweepState)
+				&& !_isFixHeapForWalk
+				&& !env->_cycleState->_gcCode.isExplicitGC();
 		regionPool->setSweepSmallPages(true);
 		regionPool->resetSkipAvailableRegionForAllocation();
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
-	incrementalSweepSmall(env);
-	regionPool->joinBucketListsForSplitIndex(env);
+	if (!_sweepSmallInBackground) {
+		incrementalSweepSmall(env);
+		regionPool->joinBucketListsForSplitIndex(env);
+	}
 
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
-		regionPool->setSweepSmallPages(false);
+		if (!_sweepSmallInBackground) {
+			regionPool->setSweepSmallPages(false);
+		}
+		/* otherwise allocating threads keep searching every bucket until the background sweeper has joined them */
 		postSweep(env);
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
@@ -569,4 +588,229 @@ MM_SweepSchemeSegregated::incrementalSweepSmall(MM_EnvironmentBase *env)
 	}
 }
 
+uintptr_t
+MM_SweepSchemeSegregated::backgroundSweepThreadProc2(OMRPortLibrary *portLib, void *info)
+{
+	MM_SweepSchemeSegregated *sweepScheme = (MM_SweepSchemeSegregated *)info;
+	/* This method will NOT return */
+	sweepScheme->backgroundSweepEntryPoint();
+	Assert_MM_unreachable();
+	return 0;
+}
+
+int J9THREAD_PROC
+MM_SweepSchemeSegregated::backgroundSweepThreadProc(void *info)
+{
+	MM_SweepSchemeSegregated *sweepScheme = (MM_SweepSchemeSegregated *)info;
+	MM_GCExtensionsBase *extensions = sweepScheme->_extensions;
+	OMR_VM *omrVM = extensions->getOmrVM();
+	OMRPORT_ACCESS_FROM_OMRVM(omrVM);
+	uintptr_t rc = 0;
+	omrsig_protect(backgroundSweepThreadProc2, info,
+			extensions->dispatcher->getSignalHandler(), omrVM,
+		OMRPORT_SIG_FLAG_SIGALLSYNC | OMRPORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+		&rc);
+	return 0;
+}
+
+bool
+MM_SweepSchemeSegregated::startupBackgroundSweep()
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of the thread so that it cannot notify us of its state before we wait */
+	omrthread_monitor_enter(_backgroundSweepMonitor);
+	_backgroundSweepState = BACKGROUND_SWEEP_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		backgroundSweepThreadProc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (BACKGROUND_SWEEP_STARTING == _backgroundSweepState) {
+			omrthread_monitor_wait(_backgroundSweepMonitor);
+		}
+		success = (BACKGROUND_SWEEP_ERROR != _backgroundSweepState);
+	} else {
+		_backgroundSweepState = BACKGROUND_SWEEP_ERROR;
+	}
+	omrthread_monitor_exit(_backgroundSweepMonitor);
+
+	return success;
+}
+
+void
+MM_SweepSchemeSegregated::shutdownBackgroundSweep()
+{
+	if ((BACKGROUND_SWEEP_ERROR != _backgroundSweepState) && (BACKGROUND_SWEEP_DISABLED != _backgroundSweepState)) {
+		omrthread_monitor_enter(_backgroundSweepMonitor);
+		while (BACKGROUND_SWEEP_TERMINATED != _backgroundSweepState) {
+			_backgroundSweepState = BACKGROUND_SWEEP_TERMINATION_REQUESTED;
+			omrthread_monitor_notify(_backgroundSweepMonitor);
+			omrthread_monitor_wait(_backgroundSweepMonitor);
+		}
+		omrthread_monitor_exit(_backgroundSweepMonitor);
+	}
+}
+
+void
+MM_SweepSchemeSegregated::resumeBackgroundSweep(MM_EnvironmentBase *env, MM_SweepStats *sweepStats)
+{
+	if (_sweepSmallInBackground) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		uintptr_t regionCount = _memoryPool->getRegionPool()->getCurrentTotalCountOfSweepRegions();
+		sweepStats->_backgroundSweepRegions = regionCount;
+
+		omrthread_monitor_enter(_backgroundSweepMonitor);
+		_backgroundSweptRegions = 0;
+		_mutatorSweptRegions = 0;
+		_backgroundSweepStartTime = omrtime_hires_clock();
+		_backgroundSweepEndTime = 0;
+		if (BACKGROUND_SWEEP_WAITING == _backgroundSweepState) {
+			/* even with nothing to sweep the background sweeper joins the buckets and ends the sweep */
+			_backgroundSweepState = BACKGROUND_SWEEP_REQUESTED;
+			omrthread_monitor_notify(_backgroundSweepMonitor);
+		}
+		omrthread_monitor_exit(_backgroundSweepMonitor);
+		_sweepSmallInBackground = false;
+	}
+}
+
+void
+MM_SweepSchemeSegregated::suspendBackgroundSweep(MM_EnvironmentBase *env, MM_SweepStats *sweepStats)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	omrthread_monitor_enter(_backgroundSweepMonitor);
+	if (BACKGROUND_SWEEP_REQUESTED == _backgroundSweepState) {
+		_backgroundSweepState = BACKGROUND_SWEEP_WAITING;
+	}
+	if (0 != _backgroundSweepStartTime) {
+		uint64_t endTime = (0 != _backgroundSweepEndTime) ? _backgroundSweepEndTime : omrtime_hires_clock();
+		sweepStats->_backgroundSweptRegions = _backgroundSweptRegions;
+		sweepStats->_mutatorSweptRegions = _mutatorSweptRegions;
+		sweepStats->_unsweptRegions = _memoryPool->getRegionPool()->getCurrentTotalCountOfSweepRegions();
+		sweepStats->_sweepLagTime = omrtime_hires_delta(_backgroundSweepStartTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		_backgroundSweepStartTime = 0;
+	}
+	omrthread_monitor_exit(_backgroundSweepMonitor);
+}
+
+void
+MM_SweepSchemeSegregated::backgroundSweepEntryPoint()
+{
+	OMR_VMThread *omrVMThread = MM_EnvironmentBase::attachVMThread(_extensions->getOmrVM(), "GC Background Sweep", MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+	if (NULL == omrVMThread) {
+		/* we failed to attach so notify the creating thread that we should fail to start up */
+		omrthread_monitor_enter(_backgroundSweepMonitor);
+		_backgroundSweepState = BACKGROUND_SWEEP_ERROR;
+		omrthread_monitor_notify(_backgroundSweepMonitor);
+		omrthread_exit(_backgroundSweepMonitor);
+	} else {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+		env->initializeGCThread();
+
+		omrthread_monitor_enter(_backgroundSweepMonitor);
+		_backgroundSweepState = BACKGROUND_SWEEP_WAITING;
+		omrthread_monitor_notify(_backgroundSweepMonitor);
+		do {
+			if (BACKGROUND_SWEEP_REQUESTED == _backgroundSweepState) {
+				omrthread_monitor_exit(_backgroundSweepMonitor);
+				backgroundSweepSmall(env);
+				omrthread_monitor_enter(_backgroundSweepMonitor);
+			} else if (BACKGROUND_SWEEP_WAITING == _backgroundSweepState) {
+				omrthread_monitor_wait(_backgroundSweepMonitor);
+			}
+		} while (BACKGROUND_SWEEP_TERMINATION_REQUESTED != _backgroundSweepState);
+		_backgroundSweepState = BACKGROUND_SWEEP_TERMINATED;
+		omrthread_monitor_notify(_backgroundSweepMonitor);
+		MM_EnvironmentBase::detachVMThread(_extensions->getOmrVM(), omrVMThread, MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+		omrthread_exit(_backgroundSweepMonitor);
+	}
+}
+
+void
+MM_SweepSchemeSegregated::backgroundSweepSmall(MM_EnvironmentBase *env)
+{
+	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+	uintptr_t splitIndex = env->getEnvironmentId() % regionPool->getSplitAvailableListSplitCount();
+
+	/* VM access keeps the sweep lists stable: a GC has to wait for it before it can suspend the sweep */
+	env->acquireVMAccess();
+	while (BACKGROUND_SWEEP_REQUESTED == _backgroundSweepState) {
+		if (env->isExclusiveAccessRequestWaiting()) {
+			env->releaseVMAccess();
+			omrthread_yield();
+			env->acquireVMAccess();
+		} else {
+			uintptr_t sweptRegions = 0;
+			if (0 != regionPool->getCurrentTotalCountOfSweepRegions()) {
+				sweptRegions = backgroundSweepSmallPass(env, splitIndex);
+			}
+			if (0 == sweptRegions) {
+				/* Nothing is left to dequeue. Regions still counted have been dequeued by allocating threads,
+				 * which finish sweeping them on their own, so the sweep is over rather than worth waiting on.
+				 */
+				OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+				omrthread_monitor_enter(_backgroundSweepMonitor);
+				if (BACKGROUND_SWEEP_REQUESTED == _backgroundSweepState) {
+					regionPool->joinBucketListsForAllSplitIndexes(env);
+					/* the joined lists must be visible before allocating threads stop searching every bucket */
+					MM_AtomicOperations::storeSync();
+					regionPool->setSweepSmallPages(false);
+					_backgroundSweepEndTime = omrtime_hires_clock();
+					_backgroundSweepState = BACKGROUND_SWEEP_WAITING;
+				}
+				omrthread_monitor_exit(_backgroundSweepMonitor);
+			}
+		}
+	}
+	env->releaseVMAccess();
+}
+
+uintptr_t
+MM_SweepSchemeSegregated::backgroundSweepSmallPass(MM_EnvironmentBase *env, uintptr_t splitIndex)
+{
+	MM_GCExtensionsBase *ext = env->getExtensions();
+	bool shouldUpdateOccupancy = ext->nonDeterministicSweep;
+	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+	MM_SizeClasses *sizeClasses = ext->defaultSizeClasses;
+	uintptr_t sweptRegions = 0;
+
+	/* one region of each size class at a time, so that every size class soon has somewhere to allocate */
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		if (0 == regionPool->getCurrentCountOfSweepRegions(sizeClass)) {
+			continue;
+		}
+		MM_HeapRegionDescriptorSegregated *region = regionPool->getSmallSweepRegions(sizeClass)->dequeue();
+		if (NULL != region) {
+			uintptr_t numCells = sizeClasses->getNumCells(sizeClass);
+			regionPool->decrementCurrentCountOfSweepRegions(sizeClass, 1);
+			regionPool->decrementCurrentTotalCountOfSweepRegions(1);
+			sweepRegion(env, region);
+			if (region->getMemoryPoolACL()->getFreeCount() < numCells) {
+				uintptr_t occupancy = (region->getMemoryPoolACL()->getMarkCount() * 100) / numCells;
+				if (shouldUpdateOccupancy) {
+					regionPool->updateOccupancy(sizeClass, occupancy);
+				}
+				if (region->getMemoryPoolACL()->getMarkCount() == numCells) {
+					regionPool->getSmallFullRegions(sizeClass)->enqueue(region);
+				} else {
+					regionPool->enqueueAvailable(region, sizeClass, occupancy, splitIndex);
+				}
+			} else {
+				region->emptyRegionReturned(env);
+				regionPool->addFreeRegion(env, region);
+			}
+			sweptRegions += 1;
+		}
+	}
+	MM_AtomicOperations::add(&_backgroundSweptRegions, sweptRegions);
+
+	return sweptRegions;
+}
+
 #endif /* OMR_GC_SEGREGATED_HEAP */
@@ -23,6 +23,9 @@
 #if !defined(SWEEPSCHEMESEGREGATED_HPP_)
 #define SWEEPSCHEMESEGREGATED_HPP_
 
+#include "omrthread.h"
+
+#include "AtomicOperations.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "MemoryPoolAggregatedCellList.hpp"
 
@@ -40,6 +43,7 @@ class MM_EnvironmentRealtime;
 class MM_HeapRegionDescriptorSegregated;
 class MM_MarkMap;
 class MM_MemoryPoolSegregated;
+class MM_SweepStats;
 
 class MM_SweepSchemeSegregated : public MM_BaseVirtual
 {
@@ -55,6 +59,24 @@ private:
 	bool _isFixHeapForWalk;
 	bool _clearMarkMapAfterSweep; /**< If a region should be unmarked after it is swept */
 
+	typedef enum BackgroundSweepState {
+		BACKGROUND_SWEEP_DISABLED = 0, /**< No background sweeper thread */
+		BACKGROUND_SWEEP_ERROR, /**< The background sweeper thread failed to start */
+		BACKGROUND_SWEEP_STARTING, /**< The background sweeper thread is starting */
+		BACKGROUND_SWEEP_WAITING, /**< Idle, no regions have been handed over */
+		BACKGROUND_SWEEP_REQUESTED, /**< Sweeping the small regions left by the last GC */
+		BACKGROUND_SWEEP_TERMINATION_REQUESTED, /**< Asked to exit */
+		BACKGROUND_SWEEP_TERMINATED /**< The background sweeper thread has exited */
+	} BackgroundSweepState;
+
+	bool _sweepSmallInBackground; /**< If the current GC leaves the small regions to the background sweeper */
+	omrthread_monitor_t _backgroundSweepMonitor; /**< Protects _backgroundSweepState, waited on by the idle background sweeper */
+	volatile BackgroundSweepState _backgroundSweepState;
+	volatile uintptr_t _backgroundSweptRegions; /**< Regions swept by the background sweeper since the last GC */
+	volatile uintptr_t _mutatorSweptRegions; /**< Regions swept by allocating threads since the last GC */
+	uint64_t _backgroundSweepStartTime; /**< When the last GC handed regions to the background sweeper, 0 if it did not */
+	uint64_t _backgroundSweepEndTime; /**< When the last of those regions was swept, 0 while some remain */
+
 	/*
 	 * Function members
 	 */
@@ -69,6 +91,51 @@ public:
 
 	bool isClearMarkMapAfterSweep() { return _clearMarkMapAfterSweep; }
 	void setClearMarkMapAfterSweep(bool clearMarkMapAfterSweep) { _clearMarkMapAfterSweep = clearMarkMapAfterSweep; }
+
+	/**
+	 * Start the background sweeper thread.
+	 * @return true on success, false otherwise
+	 */
+	bool startupBackgroundSweep();
+
+	/**
+	 * Stop the background sweeper thread and wait for it to exit.
+	 */
+	void shutdownBackgroundSweep();
+
+	/**
+	 * Hand the small regions the current GC left unswept to the background sweeper. It starts once
+	 * exclusive VM access is released. Must be called with exclusive VM access, after sweep().
+	 * @param sweepStats[out] receives the number of regions handed over
+	 */
+	void resumeBackgroundSweep(MM_EnvironmentBase *env, MM_SweepStats *sweepStats);
+
+	/**
+	 * Stop the background sweeper at the start of a GC. Regions it did not reach stay on the sweep lists
+	 * and are swept (or handed over again) by this GC. Must be called with exclusive VM access.
+	 * @param sweepStats[out] receives how the regions handed over by the previous GC were swept
+	 */
+	void suspendBackgroundSweep(MM_EnvironmentBase *env, MM_SweepStats *sweepStats);
+
+	/**
+	 * @return true while the background sweeper has small regions handed over by the last GC to sweep
+	 */
+	MMINLINE bool isBackgroundSweepActive() { return BACKGROUND_SWEEP_REQUESTED == _backgroundSweepState; }
+
+	/**
+	 * @return true once the background sweeper thread has exited
+	 */
+	MMINLINE bool isBackgroundSweepTerminated() { return BACKGROUND_SWEEP_TERMINATED == _backgroundSweepState; }
+
+	/**
+	 * @return the number of regions the background sweeper has swept since the last GC handed regions over
+	 */
+	MMINLINE uintptr_t getBackgroundSweptRegions() { return _backgroundSweptRegions; }
+
+	/**
+	 * Count a region swept by an allocating thread that needed it before the background sweeper got to it.
+	 */
+	MMINLINE void incrementMutatorSweptRegions() { MM_AtomicOperations::add(&_mutatorSweptRegions, 1); }
 protected:
 	bool initialize(MM_EnvironmentBase *env);
 	void tearDown(MM_EnvironmentBase *env);
@@ -88,6 +155,13 @@ protected:
 		,_extensions(env->getExtensions())
 		,_isFixHeapForWalk(false)
 		,_clearMarkMapAfterSweep(true)
+		,_sweepSmallInBackground(false)
+		,_backgroundSweepMonitor(NULL)
+		,_backgroundSweepState(BACKGROUND_SWEEP_DISABLED)
+		,_backgroundSweptRegions(0)
+		,_mutatorSweptRegions(0)
+		,_backgroundSweepStartTime(0)
+		,_backgroundSweepEndTime(0)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -102,6 +176,19 @@ private:
 	void incrementalSweepLarge(MM_EnvironmentBase *env);
 	void incrementalCoalesceFreeRegions(MM_EnvironmentBase *env);
 
+	static int J9THREAD_PROC backgroundSweepThreadProc(void *info);
+	static uintptr_t backgroundSweepThreadProc2(OMRPortLibrary *portLib, void *info);
+	void backgroundSweepEntryPoint();
+	/**
+	 * Sweep the small regions handed over by the last GC until they are all swept or a GC suspends the sweep.
+	 */
+	void backgroundSweepSmall(MM_EnvironmentBase *env);
+	/**
+	 * Sweep one queued region of each small size class.
+	 * @return the number of regions swept
+	 */
+	uintptr_t backgroundSweepSmallPass(MM_EnvironmentBase *env, uintptr_t splitIndex);
+
 	MMINLINE bool addFreeChunk(MM_MemoryPoolAggregatedCellList *memoryPoolACL, uintptr_t *freeChunk, uintptr_t freeChunkSize, uintptr_t minimumFreeEntrySize, uintptr_t freeChunkCellCount)
 	{
 		bool result = false;
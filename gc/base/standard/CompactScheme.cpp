@@ -71,6 +71,9 @@
 #define getConsumedSizeInBytesWithHeaderForMove getConsumedSizeInBytesWithHeader
 #endif /* !defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
 
+/* The summary live map has one bit per mark map grain, so a page is covered by whole slots of it */
+#define SUMMARY_LIVE_MAP_SLOTS_PER_PAGE (sizeof_page / J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT)
+
 /**
  * Allocate and initialize a new instance of the receiver.
  * @return a new instance of the receiver, or NULL on failure.
@@ -286,6 +289,12 @@ MM_CompactScheme::initialize(MM_EnvironmentBase *env)
 void
 MM_CompactScheme::tearDown(MM_EnvironmentBase *env)
 {
+	if (NULL != _summaryTable) {
+		env->getForge()->free(_summaryTable);
+		_summaryTable = NULL;
+		_summaryLiveMap = NULL;
+		_summaryTableSize = 0;
+	}
 	_delegate.tearDown(env);
 }
 
@@ -369,9 +378,34 @@ MM_CompactScheme::mainSetupForGC(MM_EnvironmentStandard *env)
 	_compactTable = (CompactTableEntry*)_markingScheme->getMarkMap()->getMarkBits();
 	_subAreaTable = (SubAreaEntry*)_extensions->sweepHeapSectioning->getBackingStoreAddress();
 	_subAreaTableSize = _extensions->sweepHeapSectioning->getBackingStoreSize();
+	_useSummaryTable = false;
+#if !defined(OMR_GC_DEFERRED_HASHCODE_INSERTION)
+	/* Sliding to precomputed addresses relies on objects never growing as they move */
+	if (_extensions->compactUsingSummaryTable) {
+		_useSummaryTable = allocateSummaryTable(env);
+	}
+#endif /* !defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
 	_delegate.mainSetupForGC(env);
 }
 
+bool
+MM_CompactScheme::allocateSummaryTable(MM_EnvironmentStandard *env)
+{
+	uintptr_t pageCount = (_heap->getMaximumPhysicalRange() / sizeof_page) + 1;
+	uintptr_t summaryTableSize = pageCount * (1 + SUMMARY_LIVE_MAP_SLOTS_PER_PAGE) * sizeof(uintptr_t);
+
+	if (summaryTableSize > _summaryTableSize) {
+		if (NULL != _summaryTable) {
+			env->getForge()->free(_summaryTable);
+		}
+		_summaryTable = (uintptr_t *)env->getForge()->allocate(summaryTableSize, OMR::GC::AllocationCategory::OTHER, OMR_GET_CALLSITE());
+		_summaryLiveMap = (NULL == _summaryTable) ? NULL : (_summaryTable + pageCount);
+		_summaryTableSize = (NULL == _summaryTable) ? 0 : summaryTableSize;
+	}
+
+	return (NULL != _summaryTable);
+}
+
 omrobjectptr_t
 MM_CompactScheme::freeChunkEnd(omrobjectptr_t chunk)
 {
@@ -580,35 +614,39 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	workerSetupForGC(env, singleThreaded);
 	env->_compactStats._setupEndTime = omrtime_hires_clock();
 
-	/* If a single threaded compaction force compact to run on main thread. Required
-	 * to ensure all events issued on main thread.
-	 */
-	if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
-		env->_compactStats._moveStartTime = omrtime_hires_clock();
-		moveObjects(env, objectCount, byteCount, skippedObjectCount);
-		env->_compactStats._moveEndTime = omrtime_hires_clock();
-
-		if (!singleThreaded) {
-			env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
-			MM_AtomicOperations::sync();
-		}
+	if (_useSummaryTable) {
+		compactUsingSummaryTable(env, singleThreaded, objectCount, byteCount, fixupObjectsCount);
+	} else {
+		/* If a single threaded compaction force compact to run on main thread. Required
+		 * to ensure all events issued on main thread.
+		 */
+		if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+			env->_compactStats._moveStartTime = omrtime_hires_clock();
+			moveObjects(env, objectCount, byteCount, skippedObjectCount);
+			env->_compactStats._moveEndTime = omrtime_hires_clock();
+
+			if (!singleThreaded) {
+				env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+				MM_AtomicOperations::sync();
+			}
 
-		env->_compactStats._fixupStartTime = omrtime_hires_clock();
+			env->_compactStats._fixupStartTime = omrtime_hires_clock();
 
-		fixupObjects(env, fixupObjectsCount);
+			fixupObjects(env, fixupObjectsCount);
 
 
-		env->_compactStats._fixupEndTime = omrtime_hires_clock();
+			env->_compactStats._fixupEndTime = omrtime_hires_clock();
 
-		if (singleThreaded) {
-			env->_currentTask->releaseSynchronizedGCThreads(env);
+			if (singleThreaded) {
+				env->_currentTask->releaseSynchronizedGCThreads(env);
+			}
 		}
-	}
 
-	/* FixupRoots can always be done in parallel */
-	env->_compactStats._rootFixupStartTime = omrtime_hires_clock();
-	_delegate.fixupRoots(env, this);
-	env->_compactStats._rootFixupEndTime = omrtime_hires_clock();
+		/* FixupRoots can always be done in parallel */
+		env->_compactStats._rootFixupStartTime = omrtime_hires_clock();
+		_delegate.fixupRoots(env, this);
+		env->_compactStats._rootFixupEndTime = omrtime_hires_clock();
+	}
 
 	MM_AtomicOperations::sync();
 
@@ -1288,6 +1326,10 @@ MM_CompactScheme::getForwardingPtr(omrobjectptr_t objectPtr) const
 		return objectPtr;
 	}
 
+	if (_useSummaryTable) {
+		return getForwardingPtrFromSummaryTable(objectPtr);
+	}
+
 	intptr_t index = pageIndex(objectPtr);
 	omrobjectptr_t forwardingPtr = _compactTable[index].getAddr();
 	if (forwardingPtr == 0) {
@@ -1359,7 +1401,9 @@ MM_CompactScheme::fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCou
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::fixing_up)) {
-        		fixupSubArea(env, subAreaTable[i].firstObject, subAreaTable[i+1].firstObject, subAreaTable[i].state == SubAreaEntry::fixup_only, objectCount);
+        		/* With a summary table the fixup precedes the move, when only marked objects are still valid */
+        		bool markedOnly = _useSummaryTable || (subAreaTable[i].state == SubAreaEntry::fixup_only);
+        		fixupSubArea(env, subAreaTable[i].firstObject, subAreaTable[i+1].firstObject, markedOnly, objectCount);
 			}
         }
         /* Number of regions in regionTable, including
@@ -1407,6 +1451,11 @@ MM_CompactScheme::fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t first
 void
 MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 {
+	if (_useSummaryTable) {
+		rebuildMarkbitsUsingSummaryTable(env);
+		return;
+	}
+
 	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
 	GC_HeapRegionIteratorStandard regionIterator(regionManager);
 	MM_HeapRegionDescriptorStandard *region = NULL;
@@ -1454,6 +1503,365 @@ MM_CompactScheme::rebuildMarkbitsInSubArea(MM_EnvironmentStandard *env, MM_HeapR
 	}
 }
 
+void
+MM_CompactScheme::compactUsingSummaryTable(MM_EnvironmentStandard *env, bool singleThreaded, uintptr_t &objectCount, uintptr_t &byteCount, uintptr_t &fixupObjectCount)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	env->_compactStats._summaryStartTime = omrtime_hires_clock();
+	summarizeSubAreas(env);
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		calculateSubAreaDestinations(env);
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+	calculatePageDestinations(env);
+	env->_compactStats._summaryEndTime = omrtime_hires_clock();
+
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+
+	/* If a single threaded compaction force compact to run on main thread. Required
+	 * to ensure all events issued on main thread.
+	 */
+	if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		env->_compactStats._fixupStartTime = omrtime_hires_clock();
+		fixupObjects(env, fixupObjectCount);
+		env->_compactStats._fixupEndTime = omrtime_hires_clock();
+
+		if (singleThreaded) {
+			env->_currentTask->releaseSynchronizedGCThreads(env);
+		}
+	}
+
+	/* Forwarding addresses are read from the objects' original locations, so roots are fixed up before the move */
+	env->_compactStats._rootFixupStartTime = omrtime_hires_clock();
+	_delegate.fixupRoots(env, this);
+	env->_compactStats._rootFixupEndTime = omrtime_hires_clock();
+
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+	MM_AtomicOperations::sync();
+
+	if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		env->_compactStats._moveStartTime = omrtime_hires_clock();
+		slideObjects(env, singleThreaded, objectCount, byteCount);
+		env->_compactStats._moveEndTime = omrtime_hires_clock();
+
+		if (singleThreaded) {
+			env->_currentTask->releaseSynchronizedGCThreads(env);
+		}
+	}
+}
+
+void
+MM_CompactScheme::summarizeSubAreas(MM_EnvironmentStandard *env)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	GC_HeapRegionIteratorStandard regionIterator(regionManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::summarizing)) {
+				summarizeSubArea(env, subAreaTable, i);
+			}
+		}
+		/* Number of regions in regionTable, including
+		 * the end_segment region, is i+1 */
+		subAreaTable += (i+1);
+	}
+}
+
+MMINLINE void
+MM_CompactScheme::setSummaryLiveGrains(omrobjectptr_t lowAddress, uintptr_t highAddress)
+{
+	uintptr_t grain = ((uintptr_t)lowAddress - _heapBase) / J9MODRON_HEAP_BYTES_PER_HEAPMAP_BIT;
+	uintptr_t endGrain = (highAddress - _heapBase) / J9MODRON_HEAP_BYTES_PER_HEAPMAP_BIT;
+
+	while (grain < endGrain) {
+		uintptr_t bit = grain % J9BITS_BITS_IN_SLOT;
+		uintptr_t bits = OMR_MIN(J9BITS_BITS_IN_SLOT - bit, endGrain - grain);
+		uintptr_t mask = (J9BITS_BITS_IN_SLOT == bits) ? UDATA_MAX : ((((uintptr_t)1) << bits) - 1);
+		_summaryLiveMap[grain / J9BITS_BITS_IN_SLOT] |= mask << bit;
+		grain += bits;
+	}
+}
+
+void
+MM_CompactScheme::summarizeSubArea(MM_EnvironmentStandard *env, SubAreaEntry *subAreaTable, intptr_t i)
+{
+	/* The subArea owns every page from the one holding its first object up to, but not including, the page
+	 * holding the first object of the next subArea (objects are attributed to the page they start on)
+	 */
+	intptr_t firstPage = pageIndex(subAreaTable[i].firstObject);
+	intptr_t endPage = pageIndex(subAreaTable[i + 1].firstObject);
+	uintptr_t liveBytes = 0;
+	omrobjectptr_t sourceTop = pageStart(firstPage);
+
+	/* The subArea's pages cover whole slots of the live map, so no other thread writes the same slots */
+	memset(&_summaryLiveMap[firstPage * SUMMARY_LIVE_MAP_SLOTS_PER_PAGE], 0, (endPage - firstPage) * SUMMARY_LIVE_MAP_SLOTS_PER_PAGE * sizeof(uintptr_t));
+
+	for (intptr_t page = firstPage; page < endPage; page++) {
+		uintptr_t pageLiveBytes = 0;
+		void *baseOfPage = pageStart(page);
+		uintptr_t endOfPage = (uintptr_t)pageStart(page + 1);
+		for (uintptr_t bias = 0; bias < sizeof_page; bias += J9MODRON_HEAP_BYTES_PER_UDATA_OF_HEAP_MAP) {
+			/* a word iterator over an unmarked word answers no objects without touching the heap */
+			MM_HeapMapWordIterator pagePieceIterator(_markMap, (void *)((uintptr_t)baseOfPage + bias));
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = pagePieceIterator.nextObject())) {
+				uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+				pageLiveBytes += objectSize;
+				sourceTop = (omrobjectptr_t)((uintptr_t)objectPtr + objectSize);
+				/* grains past the end of the page belong to the page the object starts on, not to the next one */
+				setSummaryLiveGrains(objectPtr, OMR_MIN((uintptr_t)sourceTop, endOfPage));
+			}
+		}
+		_summaryTable[page] = pageLiveBytes;
+		liveBytes += pageLiveBytes;
+	}
+
+	subAreaTable[i].liveBytes = liveBytes;
+	subAreaTable[i].sourceTop = sourceTop;
+}
+
+void
+MM_CompactScheme::calculateSubAreaDestinations(MM_EnvironmentStandard *env)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	GC_HeapRegionIteratorStandard regionIterator(regionManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	_slideWaves = 0;
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		uintptr_t destination = (uintptr_t)region->getLowAddress();
+		/* Destinations and sources both rise with the subArea index, so the earlier subAreas whose objects
+		 * lie within a destination form a window which only moves forward: it starts after every subArea
+		 * whose objects all end at or below the destination, and ends before the first subArea whose pages
+		 * start at or above the top of the destination.
+		 */
+		intptr_t windowBase = 0;
+		intptr_t windowTop = 0;
+		omrobjectptr_t skippedSourceTop = (omrobjectptr_t)region->getLowAddress();
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			Assert_MM_true(SubAreaEntry::init == subAreaTable[i].state);
+			omrobjectptr_t destinationBase = (omrobjectptr_t)destination;
+			destination += subAreaTable[i].liveBytes;
+			subAreaTable[i].destination = destinationBase;
+
+			while ((windowBase < i) && (OMR_MAX(skippedSourceTop, subAreaTable[windowBase].sourceTop) <= destinationBase)) {
+				skippedSourceTop = OMR_MAX(skippedSourceTop, subAreaTable[windowBase].sourceTop);
+				windowBase += 1;
+			}
+			while ((windowTop < i) && (pageStart(pageIndex(subAreaTable[windowTop].firstObject)) < (omrobjectptr_t)destination)) {
+				windowTop += 1;
+			}
+
+			/* Slide after every earlier subArea whose objects overlap the destination */
+			uintptr_t slideWave = 0;
+			for (intptr_t j = windowBase; j < windowTop; j++) {
+				if ((subAreaTable[j].sourceTop > destinationBase) && (subAreaTable[j].slideWave >= slideWave)) {
+					slideWave = subAreaTable[j].slideWave + 1;
+				}
+			}
+			subAreaTable[i].slideWave = slideWave;
+			_slideWaves = OMR_MAX(_slideWaves, slideWave);
+		}
+
+		/* Everything from the top of the slid objects to the end of the region becomes free. Describe that
+		 * to rebuildFreelist() the way evacuation does: the free chunk of each subArea is its first object
+		 * if it is entirely free, NULL if it is entirely used, or else where its free space starts.
+		 */
+		omrobjectptr_t liveTop = (omrobjectptr_t)destination;
+		for (intptr_t j = 0; j < i; j++) {
+			if (liveTop <= subAreaTable[j].firstObject) {
+				subAreaTable[j].freeChunk = subAreaTable[j].firstObject;
+			} else if (liveTop < subAreaTable[j + 1].firstObject) {
+				subAreaTable[j].freeChunk = liveTop;
+			} else {
+				subAreaTable[j].freeChunk = NULL;
+			}
+		}
+		/* Number of regions in regionTable, including
+		 * the end_segment region, is i+1 */
+		subAreaTable += (i+1);
+	}
+}
+
+void
+MM_CompactScheme::calculatePageDestinations(MM_EnvironmentStandard *env)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	GC_HeapRegionIteratorStandard regionIterator(regionManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::calculating_destinations)) {
+				uintptr_t destination = (uintptr_t)subAreaTable[i].destination;
+				intptr_t endPage = pageIndex(subAreaTable[i + 1].firstObject);
+				for (intptr_t page = pageIndex(subAreaTable[i].firstObject); page < endPage; page++) {
+					uintptr_t pageLiveBytes = _summaryTable[page];
+					_summaryTable[page] = destination;
+					destination += pageLiveBytes;
+				}
+				Assert_MM_true(destination == ((uintptr_t)subAreaTable[i].destination + subAreaTable[i].liveBytes));
+			}
+		}
+		/* Number of regions in regionTable, including
+		 * the end_segment region, is i+1 */
+		subAreaTable += (i+1);
+	}
+}
+
+omrobjectptr_t
+MM_CompactScheme::getForwardingPtrFromSummaryTable(omrobjectptr_t objectPtr) const
+{
+	intptr_t page = pageIndex(objectPtr);
+	uintptr_t grain = ((uintptr_t)objectPtr - _heapBase) / J9MODRON_HEAP_BYTES_PER_HEAPMAP_BIT;
+	uintptr_t *slot = &_summaryLiveMap[page * SUMMARY_LIVE_MAP_SLOTS_PER_PAGE];
+	uintptr_t *objectSlot = &_summaryLiveMap[grain / J9BITS_BITS_IN_SLOT];
+
+	/* The live objects which precede objectPtr on its page cover every live grain below it on the page */
+	uintptr_t liveGrains = 0;
+	for (; slot < objectSlot; slot++) {
+		liveGrains += MM_Bits::populationCount(*slot);
+	}
+	liveGrains += MM_Bits::populationCount(*objectSlot & ((((uintptr_t)1) << (grain % J9BITS_BITS_IN_SLOT)) - 1));
+
+	return (omrobjectptr_t)(_summaryTable[page] + (liveGrains * J9MODRON_HEAP_BYTES_PER_HEAPMAP_BIT));
+}
+
+void
+MM_CompactScheme::slideObjects(MM_EnvironmentStandard *env, bool singleThreaded, uintptr_t &objectCount, uintptr_t &byteCount)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	/* A single thread slides in address order, which empties each destination before it is filled */
+	uintptr_t slideWaves = singleThreaded ? 0 : _slideWaves;
+
+	for (uintptr_t wave = 0; wave <= slideWaves; wave++) {
+		GC_HeapRegionIteratorStandard regionIterator(regionManager);
+		MM_HeapRegionDescriptorStandard *region = NULL;
+		SubAreaEntry *subAreaTable = _subAreaTable;
+
+		while (NULL != (region = regionIterator.nextRegion())) {
+			if (!region->isCommitted() || (0 == region->getSize())) {
+				continue;
+			}
+			intptr_t i;
+			for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+				if ((singleThreaded || (wave == subAreaTable[i].slideWave)) && changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::evacuating)) {
+					slideSubArea(env, subAreaTable, i, objectCount, byteCount);
+				}
+			}
+			/* Number of regions in regionTable, including
+			 * the end_segment region, is i+1 */
+			subAreaTable += (i+1);
+		}
+
+		if (wave < slideWaves) {
+			/* the next wave overwrites the old locations of objects moved in this one */
+			env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+			MM_AtomicOperations::sync();
+		}
+	}
+}
+
+void
+MM_CompactScheme::slideSubArea(MM_EnvironmentStandard *env, SubAreaEntry *subAreaTable, intptr_t i, uintptr_t &objectCount, uintptr_t &byteCount)
+{
+	omrobjectptr_t deadObject = subAreaTable[i].destination;
+	omrobjectptr_t destinationTop = (omrobjectptr_t)((uintptr_t)deadObject + subAreaTable[i].liveBytes);
+
+	uintptr_t nobjects = 0;
+	uintptr_t nbytes = 0;
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)pageStart(pageIndex(subAreaTable[i].firstObject)), (uintptr_t *)pageStart(pageIndex(subAreaTable[i + 1].firstObject)));
+	omrobjectptr_t objectPtr = NULL;
+	omrobjectptr_t nextObject = NULL;
+	for (objectPtr = markedObjectIterator.nextObject(); NULL != objectPtr; objectPtr = nextObject) {
+		/* find the next object before this one is moved, as the move may overwrite its header */
+		nextObject = markedObjectIterator.nextObject();
+
+		uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+		if (deadObject != objectPtr) {
+			preObjectMove(env, objectPtr);
+			memmove(deadObject, objectPtr, objectSize);
+			postObjectMove(env, deadObject);
+			nobjects += 1;
+			nbytes += objectSize;
+		}
+		deadObject = (omrobjectptr_t)((uintptr_t)deadObject + objectSize);
+	}
+	Assert_MM_true(deadObject == destinationTop);
+
+	objectCount += nobjects;
+	byteCount += nbytes;
+}
+
+void
+MM_CompactScheme::rebuildMarkbitsUsingSummaryTable(MM_EnvironmentStandard *env)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	GC_HeapRegionIteratorStandard regionIterator(regionManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
+				_markMap->setBitsInRange(env, pageStart(pageIndex(subAreaTable[i].firstObject)), pageStart(pageIndex(subAreaTable[i + 1].firstObject)), true);
+			}
+		}
+		/* Number of regions in regionTable, including
+		 * the end_segment region, is i+1 */
+		subAreaTable += (i+1);
+	}
+
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+
+	GC_HeapRegionIteratorStandard destinationRegionIterator(regionManager);
+	subAreaTable = _subAreaTable;
+	while (NULL != (region = destinationRegionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::setting_mark_bits)) {
+				/* The slid objects of a subArea are contiguous from its destination. Neighbouring destinations
+				 * can share a mark map word, hence the atomic update.
+				 */
+				omrobjectptr_t objectPtr = subAreaTable[i].destination;
+				omrobjectptr_t destinationTop = (omrobjectptr_t)((uintptr_t)objectPtr + subAreaTable[i].liveBytes);
+				while (objectPtr < destinationTop) {
+					_markMap->atomicSetBit(objectPtr);
+					objectPtr = (omrobjectptr_t)((uintptr_t)objectPtr + _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr));
+				}
+			}
+		}
+		/* Number of regions in regionTable, including
+		 * the end_segment region, is i+1 */
+		subAreaTable += (i+1);
+	}
+}
+
 /*
  * fixHeapForWalk isn't required in Phase 4, since it simply attempts to fix up any areas which
  * weren't compacted. In Tarok, regions are entirely compacted or entirely fixed up. There is
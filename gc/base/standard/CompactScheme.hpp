@@ -92,6 +92,10 @@ private:
 		omrobjectptr_t freeChunk;
 		volatile uintptr_t state;
 		volatile uintptr_t currentAction; /**< record the status of the subarea for parallelization */
+		uintptr_t liveBytes; /**< bytes of the live objects starting in the subarea (summary table compaction only) */
+		omrobjectptr_t sourceTop; /**< end of the last live object starting in the subarea (summary table compaction only) */
+		omrobjectptr_t destination; /**< new address of the first live object in the subarea (summary table compaction only) */
+		uintptr_t slideWave; /**< slide pass in which the subarea moves, after every subarea its destination overlaps (summary table compaction only) */
         
 		/* legal values for currentAction */
 		enum {
@@ -100,7 +104,10 @@ private:
 			evacuating,
 			fixing_up,
 			rebuilding_mark_bits,
-			fixing_heap_for_walk
+			fixing_heap_for_walk,
+			summarizing,
+			calculating_destinations,
+			setting_mark_bits
 		};
     	
 		/* legal values for state
@@ -137,6 +144,11 @@ protected:
 	SubAreaEntry           *_subAreaTable;  /**< Reference to the subAreaTable which is shared data from the SweepHeapSectioning */
 	omrobjectptr_t         _compactFrom;
 	omrobjectptr_t         _compactTo;
+	uintptr_t              *_summaryTable; /**< Per page live bytes, then new address of the first live object on each page, when compacting using a summary table */
+	uintptr_t              *_summaryLiveMap; /**< One bit per mark map grain covered by a live object, clipped to the page the object starts on (follows the summaryTable in the same allocation) */
+	uintptr_t              _summaryTableSize; /**< Size of the summaryTable and summaryLiveMap in bytes */
+	uintptr_t              _slideWaves; /**< Highest slideWave of any subArea in the current compaction */
+	bool                   _useSummaryTable; /**< True if the current compaction slides objects to addresses computed from the summary table */
 	MM_CompactDelegate     _delegate;
 
 public:
@@ -220,6 +232,88 @@ protected:
 
 	void rebuildFreelist(MM_EnvironmentStandard *env);
 
+	/**
+	 * Allocate (or reuse) a summary table large enough to cover every page of the heap.
+	 * @param env[in] the current thread
+	 * @return true if the table is available, false otherwise
+	 */
+	bool allocateSummaryTable(MM_EnvironmentStandard *env);
+
+	/**
+	 * Compact by sliding each region's live objects down to its base. Every new address is known from the
+	 * summary table before any object moves, so objects and roots are fixed up first, in parallel and in
+	 * any order, and the move follows.
+	 *
+	 * @param env[in] the current thread
+	 * @param singleThreaded[in] true if the fixup and move must run on the main thread only
+	 * @param[in/out] objectCount the number of objects moved (accumulated)
+	 * @param[in/out] byteCount the number of bytes moved (accumulated)
+	 * @param[in/out] fixupObjectCount the number of objects fixed up (accumulated)
+	 */
+	void compactUsingSummaryTable(MM_EnvironmentStandard *env, bool singleThreaded, uintptr_t &objectCount, uintptr_t &byteCount, uintptr_t &fixupObjectCount);
+
+	/**
+	 * Record the live bytes of every page of the specified subArea in the summary table, along with the
+	 * totals for the subArea, and the grains its live objects cover in the summary live map.
+	 *
+	 * @param env[in] the current thread
+	 * @param subAreaTable[in] the subAreas of the region containing the subArea
+	 * @param i[in] the index of the subArea in subAreaTable
+	 */
+	void summarizeSubArea(MM_EnvironmentStandard *env, SubAreaEntry *subAreaTable, intptr_t i);
+	void summarizeSubAreas(MM_EnvironmentStandard *env);
+
+	/**
+	 * Assign each subArea the address its live objects slide to and the wave in which it can slide, and
+	 * record where the free space of each region will start. Must be called by a single thread once all
+	 * subAreas are summarized.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void calculateSubAreaDestinations(MM_EnvironmentStandard *env);
+
+	/**
+	 * Replace the live bytes of every page in the summary table with the new address of the first live
+	 * object on the page.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void calculatePageDestinations(MM_EnvironmentStandard *env);
+
+	/**
+	 * Slide the live objects of the specified subArea to its destination. Every earlier subArea whose
+	 * objects occupied that destination has moved them out in an earlier wave.
+	 *
+	 * @param env[in] the current thread
+	 * @param subAreaTable[in] the subAreas of the region containing the subArea
+	 * @param i[in] the index of the subArea in subAreaTable
+	 * @param[in/out] objectCount the number of objects moved (accumulated)
+	 * @param[in/out] byteCount the number of bytes moved (accumulated)
+	 */
+	void slideSubArea(MM_EnvironmentStandard *env, SubAreaEntry *subAreaTable, intptr_t i, uintptr_t &objectCount, uintptr_t &byteCount);
+
+	/**
+	 * Slide every subArea, one wave at a time. Threads synchronize between waves unless the compaction
+	 * is single threaded, in which case address order alone keeps each destination clear.
+	 *
+	 * @param env[in] the current thread
+	 * @param singleThreaded[in] true if only the main thread is sliding
+	 * @param[in/out] objectCount the number of objects moved (accumulated)
+	 * @param[in/out] byteCount the number of bytes moved (accumulated)
+	 */
+	void slideObjects(MM_EnvironmentStandard *env, bool singleThreaded, uintptr_t &objectCount, uintptr_t &byteCount);
+
+	/**
+	 * Answer the new address of a live object: the new address of the first live object on its page,
+	 * plus the live grains which precede it on the page counted from the summary live map.
+	 */
+	omrobjectptr_t getForwardingPtrFromSummaryTable(omrobjectptr_t objectPtr) const;
+
+	/**
+	 * Set the summary live map bits of every grain from lowAddress up to, but not including, highAddress.
+	 */
+	MMINLINE void setSummaryLiveGrains(omrobjectptr_t lowAddress, uintptr_t highAddress);
+
 	void addFreeEntry(MM_EnvironmentStandard *env,
 					MM_MemorySubSpace *memorySubSpace,
 					MM_CompactMemoryPoolState *poolState,
@@ -290,6 +384,14 @@ protected:
 	 */
 	void rebuildMarkbitsInSubArea(MM_EnvironmentStandard *env, MM_HeapRegionDescriptorStandard *region, SubAreaEntry *subAreaTable, intptr_t i);
 
+	/**
+	 * Rebuild the mark bits after a summary table compaction. SubArea boundaries do not survive the slide,
+	 * so the mark bits of every page are cleared first and then set again from the destination of each subArea.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void rebuildMarkbitsUsingSummaryTable(MM_EnvironmentStandard *env);
+
 	/**
 	 * Atomically change the currentAction value of the subArea to the specified action. This allows
 	 * a worker thread to claim responsibility for performing the specified action on the specified
@@ -335,6 +437,11 @@ public:
 		, _markMap(markingScheme->getMarkMap())
 		, _subAreaTableSize(0)
 		, _subAreaTable(NULL)
+		, _summaryTable(NULL)
+		, _summaryLiveMap(NULL)
+		, _summaryTableSize(0)
+		, _slideWaves(0)
+		, _useSummaryTable(false)
 		, _delegate()
 	{
 		_typeId = __FUNCTION__;
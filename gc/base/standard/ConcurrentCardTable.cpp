@@ -1627,25 +1627,12 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 
 		for (currentCard = firstCard; currentCard < lastCardToClean; currentCard++) {
 
-			/* Are we are on an uintptr_t boundary? If so scan the card table a uintptr_t
-	 		 * at a time until we find a slot which is non-zero or the end of card table
-	 		 * found. This is based on the premise that the card table will be mostly
-	 		 * empty and scanning an uintptr_t at a time will reduce the time taken to
-	 		 * scan the card table.
-	 		 */
-			if (((Card)CARD_CLEAN == *currentCard) && (0 == (uintptr_t)currentCard % sizeof(uintptr_t))) {
-				uintptr_t *nextSlot = (uintptr_t *)currentCard;
-				/* Last card may be in middle of a slot so only scan up to an including last
-				 * complete slots worth of cards; then go card at a time
-				 **/
-				uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)lastCardToClean);
-				while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
-					nextSlot += 1;
-				}
-				/*
-			     * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
-				 */
-				currentCard = (Card *)nextSlot;
+			/* Is this card clean? If so skip the run of clean cards in bulk until we find
+			 * a card which is not clean or the end of the range. This is based on the premise
+			 * that the card table will be mostly empty.
+			 */
+			if ((Card)CARD_CLEAN == *currentCard) {
+				currentCard = findNextNonCleanCard(currentCard, lastCardToClean);
 
 				if (currentCard >= lastCardToClean) {
 					break;
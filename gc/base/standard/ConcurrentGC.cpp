@@ -212,7 +212,11 @@ MM_ConcurrentGC::reportConcurrentKickoff(MM_EnvironmentBase *env)
 		_stats.getKickoffThreshold(),
 		_stats.getRemainingFree(),
 		_stats.getKickoffReason(),
-		_languageKickoffReason
+		_languageKickoffReason,
+		_stats.getForecastAllocationRate(),
+		_stats.getForecastAllocationBurst(),
+		_stats.getPredictedConcurrentTime(),
+		_stats.getPredictedFreeAtCompletion()
 	);
 }
 
@@ -377,7 +381,11 @@ MM_ConcurrentGC::reportConcurrentCollectionStart(MM_EnvironmentBase *env)
 			_stats.getConcurrentWorkStackOverflowCount(),
 			_stats.getThreadsToScanCount(),
 			_stats.getThreadsScannedCount(),
-			_stats.getCardCleaningReason()
+			_stats.getCardCleaningReason(),
+			_stats.getPredictedConcurrentTime(),
+			_stats.getPredictedFreeAtCompletion(),
+			_stats.getActualConcurrentTime(),
+			_stats.getActualFreeAtCompletion()
 		);
 	}
 }
@@ -1486,6 +1494,11 @@ MM_ConcurrentGC::tuneToHeap(MM_EnvironmentBase *env)
 	_stats.setCardCleaningThreshold((uintptr_t)((float)cardCleaningThreshold + boost + ((float)_extensions->concurrentSlack * cardCleaningProportion)));
 	_kickoffThresholdBuffer = MM_Math::saturatingSubtract(kickoffThresholdPlusBuffer, kickoffThreshold);
 
+	/* Free space jumps across a collection, so the next forecast sample only sets a new baseline */
+	_kickoffThresholdUnbuffered = kickoffThreshold;
+	_forecastSampleTime = 0;
+	_forecastKickoffThreshold = 0;
+
 	if (_extensions->debugConcurrentMark) {
 		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 		omrtty_printf("Tune to heap : Trace target Pass 1=\"%zu\" (Trace=\"%zu\" Clean=\"%zu\")\n",
@@ -1747,6 +1760,9 @@ MM_ConcurrentGC::calculateTraceSize(MM_EnvironmentBase *env, MM_AllocateDescript
 	 * that all work is assigned to mutators by the time free space drops to
 	 * _kickoffThresholdBuffer.
 	 */
+	if (_extensions->concurrentKickoffForecast) {
+		_lastTaxedRemainingFree = remainingFree;
+	}
 	 remainingFree = (remainingFree > _kickoffThresholdBuffer) ? remainingFree - _kickoffThresholdBuffer : 0;
 
 	/* Calculate the size to trace for this alloc based on the
@@ -2017,24 +2033,6 @@ MM_ConcurrentGC::kickoffCardCleaning(MM_EnvironmentBase *env, ConcurrentCardClea
 	}
 }
 
-#if defined(OMR_GC_CONCURRENT_SWEEP)
-/**
- * Replenish a pools free lists to satisfy a given allocate.
- * The given pool was unable to satisfy an allocation request of (at least) the given size.  See if there is work
- * that can be done to increase the free stores of the pool so that the request can be met.
- * @note This call is made under the pools allocation lock (or equivalent)
- * @return True if the pool was replenished with a free entry that can satisfy the size, false otherwise.
- */
-bool
-MM_ConcurrentGC::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size)
-{
-	if(_extensions->concurrentSweep) {
-		return _sweepScheme->replenishPoolForAllocate(env, memoryPool, size);
-	}
-	return false;
-}
-#endif /* OMR_GC_CONCURRENT_SWEEP */
-
 /**
  * Pay the allocation tax for the mutator.
  * @note This is a potential GC point.
@@ -2328,11 +2326,24 @@ MM_ConcurrentGC::timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDes
 		return false;
 	}
 
-	if ((remainingFree < _stats.getKickoffThreshold()) || _forcedKickoff) {
+	uintptr_t kickoffThreshold = _stats.getKickoffThreshold();
+	if (_extensions->concurrentKickoffForecast) {
+		updateKickoffForecast(env, remainingFree);
+		uintptr_t forecastKickoffThreshold = _forecastKickoffThreshold;
+		if (0 != forecastKickoffThreshold) {
+			kickoffThreshold = forecastKickoffThreshold;
+		}
+	}
+
+	if ((remainingFree < kickoffThreshold) || _forcedKickoff) {
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 		/* Finish off any sweep work that was still in progress */
 		completeConcurrentSweepForKickoff(env);
 #endif /* OMR_GC_CONCURRENT_SWEEP */
+		/* Concurrent marking reuses the mark map that chunks left unswept by a lazy sweep still depend on */
+		if (_extensions->lazySweep) {
+			_sweepScheme->completeLazySweep(env);
+		}
 
 		if(_stats.switchExecutionMode(CONCURRENT_OFF, CONCURRENT_INIT_RUNNING)) {
 #if defined(OMR_GC_REALTIME)
@@ -2342,6 +2353,24 @@ MM_ConcurrentGC::timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDes
 #endif /* defined(OMR_GC_REALTIME) */
 
 			_stats.setRemainingFree(remainingFree);
+			if (_extensions->concurrentKickoffForecast) {
+				OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+				uintptr_t freeNeeded = _forecastFreeNeeded;
+				uintptr_t allocRate = (uintptr_t)_forecastAllocRate;
+				uint64_t predictedTime = 0;
+				if ((0 != _forecastKickoffThreshold) && (0 != allocRate)) {
+					/* Concurrent mark is paced to finish once freeNeeded is allocated, and the buffer is kept in reserve */
+					_stats.setKickoffThreshold(kickoffThreshold);
+					_kickoffThresholdBuffer = MM_Math::saturatingSubtract(kickoffThreshold, freeNeeded);
+					predictedTime = ((uint64_t)freeNeeded * 1000) / allocRate;
+				} else {
+					freeNeeded = MM_Math::saturatingSubtract(_stats.getKickoffThreshold(), _kickoffThresholdBuffer);
+				}
+				_stats.setKickoffForecast(allocRate, _forecastAllocBurst, (uintptr_t)_forecastHelperTraceRate, predictedTime, MM_Math::saturatingSubtract(remainingFree, freeNeeded));
+				_lastTaxedRemainingFree = remainingFree;
+				_kickoffTime = omrtime_hires_clock();
+				Trc_MM_ConcurrentGC_kickoffForecast(env->getLanguageVMThread(), remainingFree, kickoffThreshold, freeNeeded, allocRate, _forecastAllocBurst ? "true" : "false", (uintptr_t)_forecastHelperTraceRate, predictedTime);
+			}
 			/* Set kickoff reason if it is not set yet */
 			_stats.setKickoffReason(KICKOFF_THRESHOLD_REACHED);
 			if (LANGUAGE_DEFINED_REASON != _stats.getKickoffReason()) {
@@ -2358,6 +2387,86 @@ MM_ConcurrentGC::timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDes
 	}
 }
 
+void
+MM_ConcurrentGC::updateKickoffForecast(MM_EnvironmentBase *env, uintptr_t remainingFree)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t lastSampleTime = _forecastSampleTime;
+	uint64_t now = omrtime_hires_clock();
+
+	if (0 == lastSampleTime) {
+		/* First sample since the last collection just sets the baseline */
+		if (0 == MM_AtomicOperations::lockCompareExchangeU64(&_forecastSampleTime, 0, now)) {
+			_forecastSampleFree = remainingFree;
+		}
+		return;
+	}
+
+	uint64_t elapsed = omrtime_hires_delta(lastSampleTime, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	if ((elapsed < CONCURRENT_FORECAST_SAMPLE_INTERVAL)
+	|| (lastSampleTime != MM_AtomicOperations::lockCompareExchangeU64(&_forecastSampleTime, lastSampleTime, now))) {
+		/* Too soon, or another thread took this sample */
+		return;
+	}
+
+	uintptr_t lastSampleFree = _forecastSampleFree;
+	_forecastSampleFree = remainingFree;
+	if (remainingFree >= lastSampleFree) {
+		/* Free space grew (e.g. the heap expanded), so there is no allocation rate to learn from */
+		return;
+	}
+
+	float sampleRate = ((float)(lastSampleFree - remainingFree) * 1000) / (float)elapsed;
+	if (0 == _forecastAllocRateLongTerm) {
+		_forecastAllocRateLongTerm = sampleRate;
+		_forecastAllocRateShortTerm = sampleRate;
+	} else {
+		_forecastAllocRateLongTerm = MM_Math::weightedAverage(_forecastAllocRateLongTerm, sampleRate, CONCURRENT_FORECAST_LONG_TERM_WEIGHT);
+		_forecastAllocRateShortTerm = MM_Math::weightedAverage(_forecastAllocRateShortTerm, sampleRate, CONCURRENT_FORECAST_SHORT_TERM_WEIGHT);
+	}
+
+	/* Plan for the burst rate while a burst lasts, since it is what will consume the free space during the cycle */
+	_forecastAllocBurst = (_forecastAllocRateShortTerm > (_forecastAllocRateLongTerm * CONCURRENT_FORECAST_BURST_FACTOR));
+	_forecastAllocRate = _forecastAllocBurst ? _forecastAllocRateShortTerm : _forecastAllocRateLongTerm;
+
+	/* While X bytes are allocated mutators trace X * allocToTraceRate bytes, and helpers trace for the X / allocRate
+	 * milliseconds it takes. The unbuffered threshold is the free space needed when only mutators trace, so the work is
+	 * done once X * (allocToTraceRate + helperRate / allocRate) = unbuffered * allocToTraceRate.
+	 */
+	float traceRatePerByte = (float)_allocToTraceRateNormal + (_forecastHelperTraceRate / _forecastAllocRate);
+	uintptr_t freeNeeded = (uintptr_t)(((float)_kickoffThresholdUnbuffered * (float)_allocToTraceRateNormal) / traceRatePerByte);
+
+	_forecastFreeNeeded = freeNeeded;
+	_forecastKickoffThreshold = freeNeeded + _extensions->concurrentKickoffForecastMargin + _extensions->concurrentSlack;
+}
+
+void
+MM_ConcurrentGC::recordKickoffForecastOutcome(MM_EnvironmentBase *env, bool cycleCompleted)
+{
+	uint64_t kickoffTime = _kickoffTime;
+	if (0 == kickoffTime) {
+		return;
+	}
+	_kickoffTime = 0;
+
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t actualTime = omrtime_hires_delta(kickoffTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	uintptr_t actualFree = _lastTaxedRemainingFree;
+	_stats.setKickoffForecastOutcome(actualTime, actualFree);
+
+	/* A cycle cut short before helpers got going would understate how fast they trace */
+	if (cycleCompleted && (0 != actualTime)) {
+		float helperRate = ((float)_stats.getConHelperTraced() * 1000) / (float)actualTime;
+		if (0 == _forecastHelperTraceRate) {
+			_forecastHelperTraceRate = helperRate;
+		} else {
+			_forecastHelperTraceRate = MM_Math::weightedAverage(_forecastHelperTraceRate, helperRate, CONCURRENT_HELPER_HISTORY_WEIGHT);
+		}
+	}
+
+	Trc_MM_ConcurrentGC_kickoffForecastOutcome(env->getLanguageVMThread(), _stats.getPredictedConcurrentTime(), actualTime, _stats.getPredictedFreeAtCompletion(), actualFree, (uintptr_t)_forecastHelperTraceRate);
+}
+
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 /**
  * Run a concurrent sweep as part of the current allocation tax.
@@ -2788,6 +2897,9 @@ MM_ConcurrentGC::concurrentFinalCollection(MM_EnvironmentBase *env, MM_MemorySub
 		postConcurrentUpdateStatsAndReport(env);
 		if(env->acquireExclusiveVMAccessForGC(this, true, true)) {
 			/* We got exclusive control first so do collection */
+			if (_extensions->concurrentKickoffForecast) {
+				recordKickoffForecastOutcome(env, true);
+			}
 			reportConcurrentCollectionStart(env);
 			uint64_t startTime = omrtime_hires_clock();
 			garbageCollect(env, subSpace, NULL, J9MMCONSTANT_IMPLICIT_GC_DEFAULT, NULL, NULL, NULL);
@@ -2996,6 +3108,11 @@ MM_ConcurrentGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
 		env->_cycleState->_activeSubSpace = subSpace;
 		env->_cycleState->_collectionStatistics = &_collectionStatistics;
 
+		if (_extensions->concurrentKickoffForecast) {
+			/* Nothing to record if concurrentFinalCollection already did */
+			recordKickoffForecastOutcome(env, !MM_GCCode(gcCode).isExplicitGC() && (CONCURRENT_TRACE_ONLY <= executionModeAtGC));
+		}
+
 		/* Report concurrent-end now, concurrent-start was reported but we didn't get
 		 * the opportunity to report concurrent-end (due to GC idle collection or concurrent halted)
 		 */
@@ -3037,6 +3154,11 @@ MM_ConcurrentGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
 		if (_stats.switchExecutionMode(executionModeAtGC, CONCURRENT_OFF)) {
 #if defined(OMR_GC_REALTIME)
 			if (_extensions->configuration->isSnapshotAtTheBeginningBarrierEnabled()) {
+				/* The cycle may complete without passing through concurrentFinalCollection, so stop recording here */
+				if (!_extensions->sATBBarrierRememberedSet->isGlobalFragmentIndexPreserved(env)) {
+					_extensions->sATBBarrierRememberedSet->preserveGlobalFragmentIndex(env);
+				}
+				_extensions->sATBBarrierRememberedSet->flushAllBuffers(env);
 				if (((MM_WorkPacketsSATB *)_markingScheme->getWorkPackets())->inUsePacketsAvailable(env)) {
 					((MM_WorkPacketsSATB *)_markingScheme->getWorkPackets())->moveInUseToNonEmpty(env);
 					_extensions->sATBBarrierRememberedSet->flushFragments(env);
@@ -3257,6 +3379,16 @@ MM_ConcurrentGC::abortCollection(MM_EnvironmentBase *env, CollectionAbortReason
 	 */
 	_concurrentDelegate.abortCollection(env);
 
+#if defined(OMR_GC_REALTIME)
+	if (_extensions->configuration->isSnapshotAtTheBeginningBarrierEnabled()) {
+		/* Stop recording and move any buffered values into packets so the reset below discards them */
+		if (!_extensions->sATBBarrierRememberedSet->isGlobalFragmentIndexPreserved(env)) {
+			_extensions->sATBBarrierRememberedSet->preserveGlobalFragmentIndex(env);
+		}
+		_extensions->sATBBarrierRememberedSet->flushAllBuffers(env);
+	}
+#endif /* defined(OMR_GC_REALTIME) */
+
 	/* Clear contents of all work packets */
 	_markingScheme->getWorkPackets()->resetAllPackets(env);
 
@@ -3351,8 +3483,10 @@ MM_ConcurrentGC::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *sub
 	/* Contract any superclass structures */
 	bool result = MM_ParallelGlobalGC::heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 
-	/* ...and then contract the card table */
-	result = result && ((MM_ConcurrentCardTable *)_cardTable)->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+	/* ...and then contract the card table, if there is one (there is none with the snapshot at the beginning barrier) */
+	if (NULL != _cardTable) {
+		result = result && ((MM_ConcurrentCardTable *)_cardTable)->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+	}
 	_heapAlloc = (void *)_extensions->heap->getHeapTop();
 
 	Trc_MM_ConcurrentGC_heapRemoveRange_Exit(env->getLanguageVMThread());
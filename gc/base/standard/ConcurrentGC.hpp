@@ -122,6 +122,11 @@ void J9ConcurrentWriteBarrierBatchStore (OMR_VMThread *vmThread, omrobjectptr_t
 #define LAST_FREE_SIZE_NEEDS_INITIALIZING ((uintptr_t)-1)
 #define ALL_BYTES_TRACED_IN_PASS_1 ((float)1.0)
 
+#define CONCURRENT_FORECAST_SAMPLE_INTERVAL 1000 /* microseconds between allocation rate samples */
+#define CONCURRENT_FORECAST_LONG_TERM_WEIGHT ((float)0.9)
+#define CONCURRENT_FORECAST_SHORT_TERM_WEIGHT ((float)0.3)
+#define CONCURRENT_FORECAST_BURST_FACTOR ((float)1.5) /* short term rate over long term rate taken as a burst */
+
 /**
  * @}
  */
@@ -249,6 +254,20 @@ private:
 	float _maxCardCleaningFactorPass2;
 	float _cardCleaningThresholdFactor;
 
+	/* Kickoff forecast statistics, maintained only with -Xgc:concurrentKickoffForecast */
+	uintptr_t _kickoffThresholdUnbuffered; /**< free bytes needed to complete concurrent mark at the normal trace rate, without helpers or buffer */
+	volatile uint64_t _forecastSampleTime; /**< time of the last allocation rate sample, 0 if a new baseline is needed */
+	uintptr_t _forecastSampleFree; /**< free bytes at the last allocation rate sample */
+	float _forecastAllocRateLongTerm; /**< slowly moving average of the allocation rate, in bytes per millisecond */
+	float _forecastAllocRateShortTerm; /**< quickly moving average of the allocation rate, in bytes per millisecond */
+	float _forecastHelperTraceRate; /**< average rate concurrent helpers traced in past cycles, in bytes per millisecond */
+	float _forecastAllocRate; /**< allocation rate used by the latest forecast, in bytes per millisecond */
+	bool _forecastAllocBurst; /**< true if the latest forecast used the short term allocation rate because of a burst */
+	volatile uintptr_t _forecastKickoffThreshold; /**< kickoff threshold from the latest forecast, 0 until there is one */
+	volatile uintptr_t _forecastFreeNeeded; /**< free bytes the latest forecast expects concurrent mark to consume */
+	uint64_t _kickoffTime; /**< time of the last forecast kickoff, 0 once its outcome has been recorded */
+	volatile uintptr_t _lastTaxedRemainingFree; /**< free bytes seen by the latest allocation tax of the current cycle */
+
 	bool _forcedKickoff;	/**< Kickoff forced externally flag */
 
 	uintptr_t _languageKickoffReason;
@@ -314,6 +333,22 @@ private:
 	void shutdownConHelperThreads(MM_GCExtensionsBase *extensions);
 	bool timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
 
+	/**
+	 * Sample the allocation rate, at most once per sample interval, and recompute the forecast kickoff threshold.
+	 * The threshold leaves enough free space for the work of a concurrent cycle, at the normal mutator trace rate
+	 * plus the trace rate of concurrent helpers over the time the forecast allocation rate takes to consume it,
+	 * and then the configured margin.
+	 * @param remainingFree[in] the free bytes the kickoff threshold is compared with
+	 */
+	void updateKickoffForecast(MM_EnvironmentBase *env, uintptr_t remainingFree);
+
+	/**
+	 * Record how long the concurrent cycle of a forecast kickoff actually took and how much free space it left,
+	 * and learn the concurrent helper trace rate from it. Does nothing if the cycle was not forecast or was recorded already.
+	 * @param cycleCompleted[in] true if tracing got far enough for the helper trace rate to be representative
+	 */
+	void recordKickoffForecastOutcome(MM_EnvironmentBase *env, bool cycleCompleted);
+
 	bool tracingRateDropped(MM_EnvironmentBase *env);
 #if defined(OMR_GC_MODRON_SCAVENGER)	
 	uintptr_t potentialFreeSpace(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
@@ -421,9 +456,6 @@ public:
 	 */
 	virtual bool forceKickoff(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode);
 
-#if defined(OMR_GC_CONCURRENT_SWEEP)
-	virtual bool replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size);
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 	virtual void payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_MemorySubSpace *baseSubSpace, MM_AllocateDescription *allocDescription);
 	bool concurrentFinalCollection(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace);
 	virtual uintptr_t localMark(MM_EnvironmentBase *env, uintptr_t sizeToTrace);
@@ -514,6 +546,18 @@ public:
 		,_lastTotalTraced(0)
 		,_lastConHelperTraceSizeCount(0)
 		,_alloc2ConHelperTraceRate(0)
+		,_kickoffThresholdUnbuffered(0)
+		,_forecastSampleTime(0)
+		,_forecastSampleFree(0)
+		,_forecastAllocRateLongTerm(0)
+		,_forecastAllocRateShortTerm(0)
+		,_forecastHelperTraceRate(0)
+		,_forecastAllocRate(0)
+		,_forecastAllocBurst(false)
+		,_forecastKickoffThreshold(0)
+		,_forecastFreeNeeded(0)
+		,_kickoffTime(0)
+		,_lastTaxedRemainingFree(0)
 		,_forcedKickoff(false)
 		,_languageKickoffReason(NO_LANGUAGE_KICKOFF_REASON)
 		,_conHelpersRequest(CONCURRENT_HELPER_WAIT)
@@ -169,6 +169,15 @@ MM_ConfigurationStandard::createMemoryPool(MM_EnvironmentBase* env, bool appendC
 	}
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
+	if (extensions->lazySweep && !extensions->largeObjectArea) {
+		/* Lazily swept chunks are appended to the tail of a single address ordered free list, and free entry
+		 * statistics are incomplete until the sweep completes (as for concurrent sweep)
+		 */
+		doSplit = false;
+		extensions->processLargeAllocateStats = false;
+		extensions->estimateFragmentation = NO_ESTIMATE_FRAGMENTATION;
+	}
+
 	if ((UDATA_MAX == extensions->largeObjectAllocationProfilingVeryLargeObjectThreshold) && extensions->processLargeAllocateStats) {
 		extensions->largeObjectAllocationProfilingVeryLargeObjectThreshold = OMR_MAX(10*1024*1024, extensions->memoryMax/100);
 	}
@@ -0,0 +1,58 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#include "CopyScanCacheDeque.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Math.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+bool
+MM_CopyScanCacheDeque::initialize(MM_EnvironmentBase *env, uintptr_t capacity, uintptr_t seed)
+{
+	uintptr_t entryCount = (uintptr_t)1 << MM_Math::floorLog2(capacity);
+	if (entryCount < capacity) {
+		entryCount <<= 1;
+	}
+	_mask = entryCount - 1;
+	_top = 0;
+	_bottom = 0;
+	/* xorshift state must never be zero */
+	_stealSeed = (0 == seed) ? 1 : seed;
+
+	_entries = (MM_CopyScanCacheStandard * volatile *)env->getForge()->allocate(sizeof(MM_CopyScanCacheStandard *) * entryCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	return (NULL != _entries);
+}
+
+void
+MM_CopyScanCacheDeque::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _entries) {
+		env->getForge()->free((void *)_entries);
+		_entries = NULL;
+	}
+}
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
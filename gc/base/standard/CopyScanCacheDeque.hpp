@@ -0,0 +1,186 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(COPYSCANCACHEDEQUE_HPP_)
+#define COPYSCANCACHEDEQUE_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+
+/* Separation between the thief and owner ends of the deque, generous enough for all supported platforms */
+#define OMR_SCAVENGER_DEQUE_PADDING 256
+
+class MM_CopyScanCacheStandard;
+class MM_EnvironmentBase;
+
+/**
+ * Fixed capacity work-stealing deque of scan caches (Chase-Lev).
+ * The owning GC thread pushes and pops at the bottom without locking; any other GC thread may steal from the top.
+ * When the deque is full push fails and the caller is expected to fall back to the shared scan list.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_CopyScanCacheDeque : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	volatile intptr_t _top; /**< index of the oldest entry, advanced by stealing threads (and the owner taking the last entry) */
+	uint8_t _padding[OMR_SCAVENGER_DEQUE_PADDING - sizeof(intptr_t)]; /**< keep thieves off the owner's cache line */
+	volatile intptr_t _bottom; /**< index one past the newest entry, only written by the owner */
+	MM_CopyScanCacheStandard * volatile *_entries; /**< circular array of _mask + 1 entries */
+	uintptr_t _mask; /**< capacity - 1, the capacity being a power of two */
+	uintptr_t _stealSeed; /**< owner private state for picking random victims */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	/**
+	 * Allocate the entry array.
+	 * @param env[in] the current thread
+	 * @param capacity[in] the maximum number of entries, rounded up to a power of two
+	 * @param seed[in] initial state for victim selection, should differ between deques
+	 * @return true on success, false otherwise
+	 */
+	bool initialize(MM_EnvironmentBase *env, uintptr_t capacity, uintptr_t seed);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Add a cache to the bottom of the deque. Must only be called by the owning thread.
+	 * @param cache[in] the cache to add
+	 * @return true if the cache was added, false if the deque is full
+	 */
+	MMINLINE bool
+	push(MM_CopyScanCacheStandard *cache)
+	{
+		intptr_t bottom = _bottom;
+		intptr_t top = _top;
+		if ((uintptr_t)(bottom - top) > _mask) {
+			return false;
+		}
+		_entries[(uintptr_t)bottom & _mask] = cache;
+		/* entry must be visible before thieves can see the new bottom */
+		MM_AtomicOperations::storeSync();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Remove the newest cache from the bottom of the deque. Must only be called by the owning thread.
+	 * @return the cache, or NULL if the deque is empty or the last entry was stolen
+	 */
+	MMINLINE MM_CopyScanCacheStandard *
+	pop()
+	{
+		MM_CopyScanCacheStandard *cache = NULL;
+		intptr_t bottom = _bottom - 1;
+		_bottom = bottom;
+		/* the bottom update must be globally visible before top is read, or the owner and a thief could both take the last entry */
+		MM_AtomicOperations::sync();
+		intptr_t top = _top;
+		if (top <= bottom) {
+			cache = _entries[(uintptr_t)bottom & _mask];
+			if (top == bottom) {
+				/* last entry - race any thieves for it */
+				if ((uintptr_t)top != MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_top, (uintptr_t)top, (uintptr_t)(top + 1))) {
+					cache = NULL;
+				}
+				_bottom = top + 1;
+			}
+		} else {
+			_bottom = top;
+		}
+		return cache;
+	}
+
+	/**
+	 * Remove the oldest cache from the top of the deque. May be called by any thread.
+	 * @return the cache, or NULL if the deque is empty or another thread won the race for the entry
+	 */
+	MMINLINE MM_CopyScanCacheStandard *
+	steal()
+	{
+		MM_CopyScanCacheStandard *cache = NULL;
+		intptr_t top = _top;
+		/* full fence, pairing with the one in pop(), so that the top read is ordered before the bottom read on weakly ordered platforms */
+		MM_AtomicOperations::sync();
+		intptr_t bottom = _bottom;
+		if (top < bottom) {
+			cache = _entries[(uintptr_t)top & _mask];
+			if ((uintptr_t)top != MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_top, (uintptr_t)top, (uintptr_t)(top + 1))) {
+				cache = NULL;
+			}
+		}
+		return cache;
+	}
+
+	/**
+	 * @return true if the deque appears to hold no entries. The answer may be stale by the time it is used.
+	 */
+	MMINLINE bool isEmpty() { return _top >= _bottom; }
+
+	/**
+	 * Pick a pseudo-random number below the given bound. Must only be called by the owning thread.
+	 * @param bound[in] the exclusive upper bound, greater than 0
+	 */
+	MMINLINE uintptr_t
+	nextRandom(uintptr_t bound)
+	{
+		/* xorshift, good enough to spread thieves across victims */
+		uintptr_t x = _stealSeed;
+		x ^= x << 13;
+		x ^= x >> 7;
+		x ^= x << 17;
+		_stealSeed = x;
+		return x % bound;
+	}
+
+	/**
+	 * Create a CopyScanCacheDeque object.
+	 */
+	MM_CopyScanCacheDeque()
+		: MM_BaseNonVirtual()
+		, _top(0)
+		, _bottom(0)
+		, _entries(NULL)
+		, _mask(0)
+		, _stealSeed(1)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* COPYSCANCACHEDEQUE_HPP_ */
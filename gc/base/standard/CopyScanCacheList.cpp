@@ -41,8 +41,18 @@ MM_CopyScanCacheList::initialize(MM_EnvironmentBase *env, volatile uintptr_t *ca
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 	bool result = true;
 	
-	_sublistCount = extensions->cacheListSplit;
-	Assert_MM_true(0 < _sublistCount);
+	_sublistsPerNode = extensions->cacheListSplit;
+	Assert_MM_true(0 < _sublistsPerNode);
+
+	/* With NUMA-aware copying every node gets its own group of sublists, so threads prefer caches local to them */
+	_nodeCount = 1;
+	if (extensions->scavengerNumaAwareCopy) {
+		uintptr_t maximumNodeNumber = extensions->_numaManager.getMaximumNodeNumber();
+		if (1 < maximumNodeNumber) {
+			_nodeCount = maximumNodeNumber;
+		}
+	}
+	_sublistCount = _sublistsPerNode * _nodeCount;
 
 	_sublists = (struct CopyScanCacheSublist *)extensions->getForge()->allocate(sizeof(struct CopyScanCacheSublist) * _sublistCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
 	if (NULL == _sublists) {
@@ -300,7 +310,11 @@ MM_CopyScanCacheList::decrementCount(CopyScanCacheSublist *sublist, uintptr_t va
 void
 MM_CopyScanCacheList::pushCache(MM_EnvironmentBase *env, MM_CopyScanCacheStandard *cacheEntry)
 {
-	MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[getSublistIndex(env)];
+	uintptr_t numaNode = cacheEntry->_numaNode;
+	if (0 == numaNode) {
+		numaNode = MM_EnvironmentStandard::getEnvironment(env)->_scavengerNumaNode;
+	}
+	MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[getSublistIndex(env, getNodeGroup(numaNode))];
 
 	/* This is a useful assertion to find who drop the same element to list twice
 	 * It is fatal and caused hang right away.
@@ -320,32 +334,39 @@ MM_CopyScanCacheList::pushCache(MM_EnvironmentBase *env, MM_CopyScanCacheStandar
 MM_CopyScanCacheStandard *
 MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
 {
-	uintptr_t index = getSublistIndex(env);
+	uintptr_t localGroup = getNodeGroup(MM_EnvironmentStandard::getEnvironment(env)->_scavengerNumaNode);
+	uintptr_t localOffset = env->getEnvironmentId() % _sublistsPerNode;
 	MM_CopyScanCacheStandard *cache = NULL;
 
-	for (uintptr_t i = 0; i < _sublistCount; i++) {
-		MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[index];
-
-		if (NULL != list->_cacheHead) {
-			env->_scavengerStats._acquireListLockCount += 1;
-			list->_cacheLock.acquire();
-			cache = list->_cacheHead;
-			if (NULL != cache) {
-				decrementCount(list, 1);
-				list->_cacheHead = (MM_CopyScanCacheStandard *)cache->next;
-
-				if (NULL == list->_cacheHead) {
-					Assert_MM_true(0 == list->_entryCount);
+	/* search the local node group first, then the remote ones */
+	for (uintptr_t g = 0; (NULL == cache) && (g < _nodeCount); g++) {
+		uintptr_t groupBase = ((localGroup + g) % _nodeCount) * _sublistsPerNode;
+		uintptr_t offset = localOffset;
+
+		for (uintptr_t i = 0; i < _sublistsPerNode; i++) {
+			MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[groupBase + offset];
+
+			if (NULL != list->_cacheHead) {
+				env->_scavengerStats._acquireListLockCount += 1;
+				list->_cacheLock.acquire();
+				cache = list->_cacheHead;
+				if (NULL != cache) {
+					decrementCount(list, 1);
+					list->_cacheHead = (MM_CopyScanCacheStandard *)cache->next;
+
+					if (NULL == list->_cacheHead) {
+						Assert_MM_true(0 == list->_entryCount);
+					}
 				}
-			}
-			list->_cacheLock.release();
+				list->_cacheLock.release();
 
-			if (NULL != cache) {
-				break;
+				if (NULL != cache) {
+					break;
+				}
 			}
-		}
 
-		index = (index + 1) % _sublistCount;
+			offset = (offset + 1) % _sublistsPerNode;
+		}
 	}
 
 	return cache;
@@ -75,6 +75,8 @@ private:
 	
 	struct CopyScanCacheSublist *_sublists;	/**< An array of CopyScanCacheSublist structures which is _sublistCount elements long */
 	uintptr_t _sublistCount; /**< the number of lists (split for parallelism). Must be at least 1 */
+	uintptr_t _nodeCount; /**< the number of NUMA node groups the sublists are divided into. Must be at least 1 */
+	uintptr_t _sublistsPerNode; /**< the number of sublists in each node group (_sublistCount / _nodeCount) */
 	
 	MM_CopyScanCacheChunk *_chunkHead; 
 	uintptr_t _incrementEntryCount;
@@ -91,6 +93,32 @@ public:
 private:
 	bool appendCacheEntries(MM_EnvironmentBase *env, uintptr_t cacheEntryCount);
 
+	/**
+	 * Determine the node group a NUMA node's caches are kept in
+	 *
+	 * @param numaNode the NUMA node, where 1 is the first node and 0 means unknown
+	 *
+	 * @return the index of the node group
+	 */
+	MMINLINE uintptr_t getNodeGroup(uintptr_t numaNode)
+	{
+		return (0 == numaNode) ? 0 : ((numaNode - 1) % _nodeCount);
+	}
+
+	/**
+	 * Hash the specified environment to determine what sublist index
+	 * it should use within the given node group
+	 * 
+	 * @param env the current environment
+	 * @param nodeGroup the node group, as returned by getNodeGroup()
+	 * 
+	 * @return an index into the _sublists array
+	 */
+	MMINLINE uintptr_t getSublistIndex(MM_EnvironmentBase *env, uintptr_t nodeGroup)
+	{
+		return (nodeGroup * _sublistsPerNode) + (env->getEnvironmentId() % _sublistsPerNode);
+	}
+
 	/**
 	 * Hash the specified environment to determine what sublist index
 	 * it should use
@@ -99,9 +127,9 @@ private:
 	 * 
 	 * @return an index into the _sublists array
 	 */
-	uintptr_t getSublistIndex(MM_EnvironmentBase *env)
+	MMINLINE uintptr_t getSublistIndex(MM_EnvironmentBase *env)
 	{
-		return env->getEnvironmentId() % _sublistCount;
+		return getSublistIndex(env, getNodeGroup(MM_EnvironmentStandard::getEnvironment(env)->_scavengerNumaNode));
 	}
 	
 	/**
@@ -182,6 +210,7 @@ public:
 
 	/**
 	 * Add the specified entry to this list.
+	 * The entry goes to a sublist of the NUMA node its memory is bound to, or of the current thread's node if it is not bound.
 	 * @param env[in] the current GC thread
 	 * @param cacheEntry[in] the cache entry to add
 	 */
@@ -189,6 +218,7 @@ public:
 
 	/**
 	 * Pop a cache entry from this list.
+	 * Sublists of the current thread's NUMA node are tried before those of other nodes.
 	 * @param env[in] the current GC thread
 	 * @return the cache entry, or NULL if the list is empty
 	 */
@@ -202,6 +232,8 @@ public:
 		, _allocationInHeap(false)
 		, _sublists(NULL)
 		, _sublistCount(0)
+		, _nodeCount(1)
+		, _sublistsPerNode(0)
 		, _chunkHead(NULL)
 		, _incrementEntryCount(0)
 		, _totalAllocatedEntryCount(0)
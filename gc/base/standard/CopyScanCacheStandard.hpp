@@ -52,6 +52,7 @@ public:
 	uintptr_t _arraySplitIndex; /**< The index within a split array to start scanning from (meaningful if OMR_SCAVENGER_CACHE_TYPE_SPLIT_ARRAY is set) */
 	uintptr_t _arraySplitAmountToScan; /**< The amount of elements that should be scanned by split array scanning. */
 	omrobjectptr_t* _arraySplitRememberedSlot; /**< A pointer to the remembered set slot a split array came from if applicable. */
+	uintptr_t _numaNode; /**< The NUMA node the cache memory is bound to (1 is the first node), or 0 if the memory is not bound */
 
 	/* Members Function */
 private:
@@ -89,6 +90,7 @@ public:
 		_arraySplitRememberedSlot = NULL;
 		_hasPartiallyScannedObject = false;
 		_shouldBeRemembered = false;
+		_numaNode = 0;
 	}
 
 	/**
@@ -100,6 +102,7 @@ public:
 		, _arraySplitIndex(0)
 		, _arraySplitAmountToScan(0)
 		, _arraySplitRememberedSlot(NULL)
+		, _numaNode(0)
 	{}
 };
 
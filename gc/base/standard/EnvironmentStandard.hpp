@@ -66,6 +66,9 @@ public:
 	bool _loaAllocation;  /** true, if tenure TLH remainder is in LOA (TODO: try preventing remainder creation in LOA) */
 	void *_survivorTLHRemainderBase; /**< base and top pointers of the last unused survivor TLH copy cache, that might be reused  on next copy refresh */
 	void *_survivorTLHRemainderTop;
+	uintptr_t _scavengerNumaNode; /**< NUMA node of this thread (1 is the first node), cached at the start of each scavenge; 0 if unknown or NUMA-aware copy is disabled */
+	uintptr_t _copyScanCacheSizeMaximum; /**< upper bound on the size of copy/scan caches taken by this thread in the current scavenge */
+	uintptr_t _scanStallPercent; /**< percentage of this thread's time in its most recent scavenge spent stalled waiting for scan work */
 
 protected:
 
@@ -98,6 +101,9 @@ public:
 		,_loaAllocation(false)
 		,_survivorTLHRemainderBase(NULL)
 		,_survivorTLHRemainderTop(NULL)
+		,_scavengerNumaNode(0)
+		,_copyScanCacheSizeMaximum(0)
+		,_scanStallPercent(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -22,6 +22,8 @@
 
 #include "omr.h"
 
+#include <string.h>
+
 #include "OverflowStandard.hpp"
 
 #include "CollectorLanguageInterface.hpp"
@@ -57,12 +59,33 @@ MM_OverflowStandard::newInstance(MM_EnvironmentBase *env, MM_WorkPackets *workPa
 bool
 MM_OverflowStandard::initialize(MM_EnvironmentBase *env)
 {
+	_spillSlotsPerThread = _extensions->workPacketOverflowSpillSize / sizeof(void *);
+	if (0 != _spillSlotsPerThread) {
+		_spillThreadCount = _extensions->gcThreadCount;
+		_spillBuffer = (void **)env->getForge()->allocate(sizeof(void *) * _spillSlotsPerThread * _spillThreadCount, OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+		_spillCounts = (uintptr_t *)env->getForge()->allocate(sizeof(uintptr_t) * _spillThreadCount, OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+		if ((NULL == _spillBuffer) || (NULL == _spillCounts)) {
+			return false;
+		}
+		memset(_spillCounts, 0, sizeof(uintptr_t) * _spillThreadCount);
+	}
+
 	return MM_WorkPacketOverflow::initialize(env);
 }
 
 void
 MM_OverflowStandard::tearDown(MM_EnvironmentBase *env)
 {
+	if (NULL != _spillBuffer) {
+		env->getForge()->free(_spillBuffer);
+		_spillBuffer = NULL;
+	}
+	if (NULL != _spillCounts) {
+		env->getForge()->free(_spillCounts);
+		_spillCounts = NULL;
+	}
+	_spillThreadCount = 0;
+
 	MM_WorkPacketOverflow::tearDown(env);
 }
 
@@ -113,8 +136,14 @@ MM_OverflowStandard::overflowItemInternal(MM_EnvironmentBase *env, void *item)
 		Assert_MM_true(markMap->isBitSet(objectPtr));
 		Assert_MM_false(markMap->isBitSet((omrobjectptr_t)((uintptr_t)item + markMap->getObjectGrain())));
 
-		/* set overflow bit (double marking) */
-		markMap->atomicSetBit((omrobjectptr_t)((uintptr_t)item + markMap->getObjectGrain()));
+		if (spillItem(env, objectPtr)) {
+			env->_workPacketStats.incrementSTWOverflowSpillCount();
+		} else {
+			/* set overflow bit (double marking) and leave the object for the heap rescan */
+			markMap->atomicSetBit((omrobjectptr_t)((uintptr_t)item + markMap->getObjectGrain()));
+			_heapRescanRequired = true;
+			env->_workPacketStats.incrementSTWOverflowMarkCount();
+		}
 
 		/* Perform language specific actions */
 		markingScheme->getMarkingDelegate()->handleWorkPacketOverflowItem(env,objectPtr);
@@ -134,37 +163,66 @@ MM_OverflowStandard::handleOverflow(MM_EnvironmentBase *env)
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
 		_overflow = false;
 
-		MM_Heap *heap = _extensions->heap;
-		MM_HeapRegionManager *regionManager = heap->getHeapRegionManager();
-		GC_HeapRegionIterator regionIterator(regionManager);
-		MM_HeapRegionDescriptor *region = NULL;
-		MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)_extensions->getGlobalCollector();
-		MM_MarkingScheme *markingScheme = globalCollector->getMarkingScheme();
-		MM_MarkMap *markMap = markingScheme->getMarkMap();
-
-		while((region = regionIterator.nextRegion()) != NULL) {
-			GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, region, false);
-			omrobjectptr_t object;
-
-			while((object = objectIterator.nextObject()) != NULL) {
-				/* search for double marked (overflowed) objects */
-				if ((markMap->isBitSet(object)) && (markMap->isBitSet((omrobjectptr_t)((uintptr_t)object + markMap->getObjectGrain())))) {
-					/* clean overflow mark */
-					markMap->clearBit((omrobjectptr_t)((uintptr_t)object + markMap->getObjectGrain()));
-
-					/* scan overflowed object */
-					markingScheme->scanObject(env, object, SCAN_REASON_OVERFLOWED_OBJECT);
+		if (_heapRescanRequired) {
+			_heapRescanRequired = false;
+			env->_workPacketStats.incrementSTWOverflowHeapRescanCount();
+
+			MM_Heap *heap = _extensions->heap;
+			MM_HeapRegionManager *regionManager = heap->getHeapRegionManager();
+			GC_HeapRegionIterator regionIterator(regionManager);
+			MM_HeapRegionDescriptor *region = NULL;
+			MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)_extensions->getGlobalCollector();
+			MM_MarkingScheme *markingScheme = globalCollector->getMarkingScheme();
+			MM_MarkMap *markMap = markingScheme->getMarkMap();
+
+			while((region = regionIterator.nextRegion()) != NULL) {
+				GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, region, false);
+				omrobjectptr_t object;
+
+				while((object = objectIterator.nextObject()) != NULL) {
+					/* search for double marked (overflowed) objects */
+					if ((markMap->isBitSet(object)) && (markMap->isBitSet((omrobjectptr_t)((uintptr_t)object + markMap->getObjectGrain())))) {
+						/* clean overflow mark */
+						markMap->clearBit((omrobjectptr_t)((uintptr_t)object + markMap->getObjectGrain()));
+
+						/* scan overflowed object */
+						markingScheme->scanObject(env, object, SCAN_REASON_OVERFLOWED_OBJECT);
+					}
 				}
 			}
 		}
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
+
+	/* Objects held in spill buffers were never left for the rescan, so each thread scans its own */
+	drainSpillBuffer(env);
 }
 
 void
-MM_OverflowStandard::reset(MM_EnvironmentBase *env)
+MM_OverflowStandard::drainSpillBuffer(MM_EnvironmentBase *env)
 {
+	uintptr_t workerID = env->getWorkerID();
+	if (workerID < _spillThreadCount) {
+		MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)_extensions->getGlobalCollector();
+		MM_MarkingScheme *markingScheme = globalCollector->getMarkingScheme();
+		void **spillSlots = _spillBuffer + (workerID * _spillSlotsPerThread);
 
+		/* scanning may spill more objects into the same slots, so re-read the count each time */
+		while (0 != _spillCounts[workerID]) {
+			_spillCounts[workerID] -= 1;
+			omrobjectptr_t object = (omrobjectptr_t)spillSlots[_spillCounts[workerID]];
+			markingScheme->scanObject(env, object, SCAN_REASON_OVERFLOWED_OBJECT);
+		}
+	}
+}
+
+void
+MM_OverflowStandard::reset(MM_EnvironmentBase *env)
+{
+	if (NULL != _spillCounts) {
+		memset(_spillCounts, 0, sizeof(uintptr_t) * _spillThreadCount);
+	}
+	_heapRescanRequired = false;
 }
 
 bool
@@ -41,6 +41,11 @@ public:
 protected:
 private:
 	MM_GCExtensionsBase *_extensions;
+	void **_spillBuffer; /**< Overflow spill slots of all GC threads, _spillSlotsPerThread consecutive slots per worker ID */
+	uintptr_t *_spillCounts; /**< Number of items each GC thread holds in its spill slots */
+	uintptr_t _spillSlotsPerThread; /**< Spill slots per GC thread, 0 if overflowed items always wait for a heap rescan */
+	uintptr_t _spillThreadCount; /**< Number of GC threads with spill slots */
+	volatile bool _heapRescanRequired; /**< True if an item was marked for a heap rescan since the last one */
 	
 /* Methods */
 public:
@@ -83,7 +88,8 @@ public:
 	virtual void overflowItem(MM_EnvironmentBase *env, void *item, MM_OverflowType type);
 
 	/**
-	 * Handle Overflow - clean card table
+	 * Handle Overflow - rescan the heap for marked overflowed objects if any spill buffer
+	 * filled up, then have every thread scan the objects held in its own spill buffer
 	 * @param env current thread environment
 	 */
 	virtual void handleOverflow(MM_EnvironmentBase *env);
@@ -93,7 +99,12 @@ public:
 	 */
 	MM_OverflowStandard(MM_EnvironmentBase *env, MM_WorkPackets *workPackets) :
 		MM_WorkPacketOverflow(env, workPackets),
-		_extensions(MM_GCExtensionsBase::getExtensions(env->getOmrVM()))
+		_extensions(MM_GCExtensionsBase::getExtensions(env->getOmrVM())),
+		_spillBuffer(NULL),
+		_spillCounts(NULL),
+		_spillSlotsPerThread(0),
+		_spillThreadCount(0),
+		_heapRescanRequired(false)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -122,6 +133,27 @@ protected:
 	void overflowItemInternal(MM_EnvironmentBase *env, void *item);
 
 private:
+	/**
+	 * Hold an overflowed object in the spill buffer of the current thread.
+	 * @param objectPtr - marked object waiting to be scanned
+	 * @return true if the object was held, false if the thread has no room left
+	 */
+	MMINLINE bool spillItem(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+	{
+		uintptr_t workerID = env->getWorkerID();
+		if ((workerID < _spillThreadCount) && (_spillCounts[workerID] < _spillSlotsPerThread)) {
+			_spillBuffer[(workerID * _spillSlotsPerThread) + _spillCounts[workerID]] = (void *)objectPtr;
+			_spillCounts[workerID] += 1;
+			return true;
+		}
+		return false;
+	}
+
+	/**
+	 * Scan the objects held in the spill buffer of the current thread, including any
+	 * spilled again while doing so.
+	 */
+	void drainSpillBuffer(MM_EnvironmentBase *env);
 
 };
 
@@ -721,10 +721,12 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		MM_MemorySubSpace *memorySubSpace = heap->getDefaultMemorySpace()->getTenureMemorySubSpace();
 		uintptr_t totalSize = memorySubSpace->getActiveMemorySize();
 		MM_MemoryPool *memoryPool= memorySubSpace->getMemoryPool();
-		uintptr_t darkMatterBytes = 0;
-		if (!_extensions->concurrentSweep) {
-			darkMatterBytes = memoryPool->getDarkMatterBytes();
+		uintptr_t darkMatterBytes = memoryPool->getDarkMatterBytes();
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+		if (_extensions->concurrentSweep) {
+			darkMatterBytes = 0;
 		}
+#endif /* OMR_GC_CONCURRENT_SWEEP */
 		uintptr_t freeMemorySize = memoryPool->getActualFreeMemorySize();
 		/* Consider the trigger only if heap fully expanded */
 		if (heap->getMemorySize() == heap->getMaximumMemorySize()) {
@@ -925,6 +927,9 @@ MM_ParallelGlobalGC::completeFreelistRebuildRequired(MM_EnvironmentBase *env, Sw
 		// after a concurrent sweep cycle has started but for now we need to complete sweep
 		// if current LOA size is > 0.
 		*reason = EXPANSION_REQUIRED;
+	} else if (_extensions->lazySweep && (0 != activeSubSpace->getExpansionSize()) && !_sweepScheme->isSweepCompleted(env)) {
+		/* Expansion adds free memory to the free list, which must not precede lazily swept chunks */
+		*reason = EXPANSION_REQUIRED;
 	} else if (0 != activeSubSpace->getContractionSize()) {
 		*reason = CONTRACTION_REQUIRED;
 	} else if (activeSubSpace->completeFreelistRebuildRequired(env)) {
@@ -1055,6 +1060,11 @@ MM_ParallelGlobalGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	}
 
 	GC_OMRVMInterface::flushCachesForGC(env);
+
+	/* Finish off any lazy sweep work left from the previous cycle while its mark map is still intact */
+	if (!_sweepScheme->isSweepCompleted(env)) {
+		_sweepScheme->completeSweep(env, ABOUT_TO_GC);
+	}
 	
 	_markingScheme->getMarkMap()->setMarkMapValid(false);
 	
@@ -1288,6 +1298,15 @@ MM_ParallelGlobalGC::fixHeapForWalk(MM_EnvironmentBase *env, UDATA walkFlags, ui
 	return fixedObjectCount;
 }
 
+/* (non-doxygen)
+ * @see MM_Collector::replenishPoolForAllocate()
+ */
+bool
+MM_ParallelGlobalGC::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size)
+{
+	return _sweepScheme->replenishPoolForAllocate(env, memoryPool, size);
+}
+
 /* (non-doxygen)
  * @see MM_GlobalCollector::heapAddRange()
  */
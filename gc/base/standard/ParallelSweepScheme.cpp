@@ -29,6 +29,7 @@
 
 #include "AllocateDescription.hpp"
 #include "Bits.hpp"
+#include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
@@ -276,6 +277,9 @@ MM_ParallelSweepScheme::getPoolState(MM_MemoryPool *memoryPool)
 bool
 MM_ParallelSweepScheme::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress)
 {
+	/* the added range joins the free list in address order, which lazily swept chunks would otherwise be connected after */
+	completeLazySweep(env);
+
 	/* this method is called too often in some configurations (ie: Tarok) so we update the sectioning table in heapReconfigured */
 	return true;
 }
@@ -293,6 +297,9 @@ MM_ParallelSweepScheme::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace
 bool
 MM_ParallelSweepScheme::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress)
 {
+	/* the removed range may hold chunks left unswept */
+	completeLazySweep(env);
+
 	/* this method is called too often in some configurations (ie: Tarok) so we update the sectioning table in heapReconfigured */
 	return true;
 }
@@ -341,14 +348,7 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		markMapCurrent = MM_HeapMap::findNextNonEmptySlot(markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -615,6 +615,11 @@ MM_ParallelSweepScheme::sweepAllChunks(MM_EnvironmentBase *env, uintptr_t totalC
 		chunk = sectioningIterator.nextChunk();
 			
 		Assert_MM_true (chunk != NULL);  /* Should never return NULL */
+
+		/* all threads skip the same chunks, so work units stay in step */
+		if (isSkippedChunk(chunk, chunkNum)) {
+			continue;
+		}
 		
 		if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
 			
@@ -684,7 +689,10 @@ MM_ParallelSweepScheme::connectAllChunks(MM_EnvironmentBase *env, uintptr_t tota
 		sweepChunk = sectioningIterator.nextChunk();
 		Assert_MM_true(sweepChunk != NULL);  /* Should never return NULL */
 
-		connectChunk(env, sweepChunk);
+		/* Chunks left unswept are connected as they are swept */
+		if (!isSkippedChunk(sweepChunk, chunkNum)) {
+			connectChunk(env, sweepChunk);
+		}
 	}
 
 	/* Walk all memory spaces flushing the previous free entry */
@@ -733,12 +741,129 @@ MM_ParallelSweepScheme::flushAllFinalChunks(MM_EnvironmentBase *env)
 	while(NULL != (memoryPool = poolIterator.nextPool())) {
 		MM_SweepPoolManager *sweepPoolManager = memoryPool->getSweepPoolManager();
 		
-		/* Find any unaccounted for free entries and flush them to the free list */
-		sweepPoolManager->flushFinalChunk(env, memoryPool);
+		/* Find any unaccounted for free entries and flush them to the free list.  The trailing free entry of the last
+		 * chunk before any chunks left unswept may still join with free memory in the next chunk, so is kept back.
+		 */
+		if ((memoryPool != _lazySweepPool) || (NULL == _lazySweepNextChunk)) {
+			sweepPoolManager->flushFinalChunk(env, memoryPool);
+		}
 		sweepPoolManager->connectFinalChunk(env, memoryPool);
 	}
 }
 
+bool
+MM_ParallelSweepScheme::isSkippedChunk(MM_ParallelSweepChunk *chunk, uintptr_t chunkNum)
+{
+	bool deferred = (NULL != _lazySweepNextChunk) && (chunk->memoryPool == _lazySweepPool) && (chunkNum >= _lazySweepNextChunkIndex);
+	return deferred != _lazySweepCompleting;
+}
+
+void
+MM_ParallelSweepScheme::selectDeferredChunks(MM_EnvironmentBase *env, uintptr_t totalChunkCount)
+{
+	uintptr_t eagerChunksRemaining = env->_currentTask->getThreadCount();
+	MM_SweepHeapSectioningIterator sectioningIterator(_sweepHeapSectioning);
+
+	_lazySweepNextChunk = NULL;
+	_lazySweepNextChunkIndex = 0;
+	_lazySweepDeferredBytes = 0;
+	_lazySweepSweptBytes = 0;
+
+	for (uintptr_t chunkNum = 0; chunkNum < totalChunkCount; chunkNum++) {
+		MM_ParallelSweepChunk *chunk = sectioningIterator.nextChunk();
+		Assert_MM_true(chunk != NULL);  /* Should never return NULL */
+
+		if (chunk->memoryPool == _lazySweepPool) {
+			if (0 != eagerChunksRemaining) {
+				eagerChunksRemaining -= 1;
+				_lazySweepSweptBytes += chunk->size();
+			} else {
+				if (NULL == _lazySweepNextChunk) {
+					_lazySweepNextChunk = chunk;
+					_lazySweepNextChunkIndex = chunkNum;
+				}
+				_lazySweepDeferredBytes += chunk->size();
+			}
+		}
+	}
+}
+
+bool
+MM_ParallelSweepScheme::sweepDeferredChunks(MM_EnvironmentBase *env, uintptr_t minimumFreeSize)
+{
+	MM_MemoryPool *memoryPool = _lazySweepPool;
+	MM_SweepPoolManager *sweepPoolManager = memoryPool->getSweepPoolManager();
+	MM_SweepPoolState *sweepState = getPoolState(memoryPool);
+	uintptr_t largestFreeEntry = memoryPool->getLargestFreeEntry();
+
+	/* Resume connecting at the tail of the free list, which the pool has followed through any allocation that split or
+	 * consumed it since the last connection.  Connections add to the free memory the pool already holds.
+	 */
+	MM_HeapLinkedFreeHeader *tailFreeEntry = sweepState->_connectPreviousFreeEntry;
+	Assert_MM_true((NULL == tailFreeEntry) || (NULL == tailFreeEntry->getNext(env->compressObjectReferences())));
+	sweepState->_connectPreviousFreeEntrySize = (NULL == tailFreeEntry) ? 0 : tailFreeEntry->getSize();
+	sweepState->_connectPreviousPreviousFreeEntry = NULL;
+	sweepState->resetFreeStats();
+	sweepState->_sweepFreeBytes = memoryPool->getActualFreeMemorySize();
+	sweepState->_sweepFreeHoles = memoryPool->getActualFreeEntryCount();
+
+	if (!_lazySweepCompleting) {
+		env->_freeEntrySizeClassStats.resetCounts();
+		env->_freeEntrySizeClassStats.initializeFrequentAllocation(memoryPool->getLargeObjectAllocateStats());
+	}
+
+	MM_ParallelSweepChunk *chunk = _lazySweepNextChunk;
+	while ((NULL != chunk) && (sweepState->_largestFreeEntry < minimumFreeSize)) {
+		if (!_lazySweepCompleting) {
+			sweepChunk(env, chunk);
+		}
+		connectChunk(env, chunk);
+		_lazySweepDeferredBytes -= chunk->size();
+
+		/* Move on to the next chunk of the pool */
+		do {
+			chunk = chunk->_next;
+			_lazySweepNextChunkIndex += 1;
+		} while ((NULL != chunk) && (chunk->memoryPool != memoryPool));
+	}
+
+	if (!_lazySweepCompleting) {
+		memoryPool->getLargeObjectAllocateStats()->getFreeEntrySizeClassStats()->mergeLocked(&env->_freeEntrySizeClassStats);
+	}
+
+	bool found = sweepState->_largestFreeEntry >= minimumFreeSize;
+
+	/* Once the last chunk is connected its trailing free entry has no more chunks to join */
+	if (NULL == chunk) {
+		sweepPoolManager->flushFinalChunk(env, memoryPool);
+	}
+	sweepPoolManager->connectFinalChunk(env, memoryPool);
+	memoryPool->setLargestFreeEntry(OMR_MAX(largestFreeEntry, sweepState->_largestFreeEntry));
+
+	_lazySweepNextChunk = chunk;
+	if (NULL == chunk) {
+		Assert_MM_true(0 == _lazySweepDeferredBytes);
+		memoryPool->setApproximateFreeMemorySize(0);
+	} else {
+		memoryPool->setApproximateFreeMemorySize((uintptr_t)((double)_lazySweepDeferredBytes * _lazySweepFreeRatio));
+	}
+
+	return found;
+}
+
+void
+MM_ParallelSweepScheme::completeLazySweep(MM_EnvironmentBase *env)
+{
+	if (NULL != _lazySweepNextChunk) {
+		_lazySweepPool->lock(env);
+		/* another thread may have completed the sweep while we waited for the lock */
+		if (NULL != _lazySweepNextChunk) {
+			sweepDeferredChunks(env, UDATA_MAX);
+		}
+		_lazySweepPool->unlock(env);
+	}
+}
+
 void
 MM_ParallelSweepScheme::allPoolsPostProcess(MM_EnvironmentBase *env)
 {
@@ -763,10 +888,17 @@ MM_ParallelSweepScheme::internalSweep(MM_EnvironmentBase *env)
 {
 	/* main thread does initialization */
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
-		/* Reset largestFreeEntry of all subSpaces at beginning of sweep */
-		_extensions->heap->resetLargestFreeEntry();
-		
-		_chunksPrepared = prepareAllChunks(env);
+		/* Chunks are already prepared when completing a lazy sweep */
+		if (!_lazySweepCompleting) {
+			/* Reset largestFreeEntry of all subSpaces at beginning of sweep */
+			_extensions->heap->resetLargestFreeEntry();
+
+			_chunksPrepared = prepareAllChunks(env);
+
+			if (NULL != _lazySweepPool) {
+				selectDeferredChunks(env, _chunksPrepared);
+			}
+		}
 		
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
@@ -783,10 +915,14 @@ MM_ParallelSweepScheme::internalSweep(MM_EnvironmentBase *env)
 		mergeStartTime = omrtime_hires_clock();
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
-		connectAllChunks(env, _chunksPrepared);
+		if (_lazySweepCompleting) {
+			sweepDeferredChunks(env, UDATA_MAX);
+		} else {
+			connectAllChunks(env, _chunksPrepared);
 
-		_extensions->splitFreeListNumberChunksPrepared = _chunksPrepared;
-		allPoolsPostProcess(env);
+			_extensions->splitFreeListNumberChunksPrepared = _chunksPrepared;
+			allPoolsPostProcess(env);
+		}
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		mergeEndTime = omrtime_hires_clock();
@@ -817,7 +953,7 @@ MM_ParallelSweepScheme::sweep(MM_EnvironmentBase *env)
 
 /**
  * Complete any sweep work after a basic sweep operation.
- * Completing the sweep is a noop - the basic sweep operation consists of a full sweep.
+ * Completing the sweep is a noop unless a lazy sweep left chunks to be swept on allocation.
  * 
  * @note Expect to have the dispatcher and worker threads available for work
  * @note Expect to have exclusive access
@@ -829,13 +965,23 @@ MM_ParallelSweepScheme::sweep(MM_EnvironmentBase *env)
 void
 MM_ParallelSweepScheme::completeSweep(MM_EnvironmentBase *env, SweepCompletionReason reason)
 {
-	/* No work - basic sweep will have done all the work */
+	/* No work unless a lazy sweep left chunks unswept */
+	if (NULL != _lazySweepNextChunk) {
+		/* sweep the remaining chunks in parallel, the main thread then connects them */
+		_lazySweepCompleting = true;
+		MM_ParallelSweepTask sweepTask(env, _dispatcher, this);
+		_dispatcher->run(env, &sweepTask);
+		_lazySweepCompleting = false;
+		Assert_MM_true(NULL == _lazySweepNextChunk);
+
+		_extensions->globalGCStats.sweepStats._deferredBytes = 0;
+	}
 }
 
 /**
  * Sweep and connect the heap until a free entry of the specified size is found.
- * Sweeping for a minimum size involves completing a full sweep (there is no incremental operation) then
- * evaluating whether the minimum free size was found.
+ * Sweeping for a minimum size involves completing a full sweep then evaluating whether the minimum free size was found.
+ * With lazy sweep the tenure pool is only swept until the minimum size is found, and the rest is swept on allocation.
  * 
  * @note Expects to have exclusive access
  * @note Expects to have control over the parallel GC threads (ie: able to dispatch tasks)
@@ -848,7 +994,23 @@ MM_ParallelSweepScheme::sweepForMinimumSize(
 	MM_MemorySubSpace *baseMemorySubSpace, 
 	MM_AllocateDescription *allocateDescription)
 {
+	/* Leave most of the tenure sweep to allocating threads when lazy sweep is enabled - explicit GCs sweep fully */
+	_lazySweepPool = NULL;
+	if (_extensions->lazySweep && !_extensions->largeObjectArea && !env->_cycleState->_gcCode.isExplicitGC()) {
+		_lazySweepPool = getHeap()->getDefaultMemorySpace()->getTenureMemorySubSpace()->getMemoryPool();
+	}
+
 	sweep(env);
+
+	if (NULL != _lazySweepNextChunk) {
+		_lazySweepFreeRatio = (0 == _lazySweepSweptBytes) ? 0.0 : ((double)_lazySweepPool->getActualFreeMemorySize() / (double)_lazySweepSweptBytes);
+
+		/* sweep on until the allocation which triggered the GC can be satisfied */
+		uintptr_t minimumFreeSize = (NULL == allocateDescription) ? 0 : allocateDescription->getBytesRequested();
+		sweepDeferredChunks(env, minimumFreeSize);
+	}
+	_extensions->globalGCStats.sweepStats._deferredBytes = _lazySweepDeferredBytes;
+
 	if (allocateDescription) {
 		uintptr_t minimumFreeSize =  allocateDescription->getBytesRequested();
 		return minimumFreeSize <= baseMemorySubSpace->findLargestFreeEntry(env, allocateDescription);
@@ -857,21 +1019,22 @@ MM_ParallelSweepScheme::sweepForMinimumSize(
 	}	
 }
 
-#if defined(OMR_GC_CONCURRENT_SWEEP)
 /**
  * Replenish a pools free lists to satisfy a given allocate.
  * The given pool was unable to satisfy an allocation request of (at least) the given size.  See if there is work
  * that can be done to increase the free stores of the pool so that the request can be met.
  * @note This call is made under the pools allocation lock (or equivalent)
- * @note The base implementation has completed all work, nothing further can be done.
+ * @note Only chunks left unswept by a lazy sweep can be swept, otherwise all work has been completed.
  * @return True if the pool was replenished with a free entry that can satisfy the size, false otherwise.
  */
 bool
 MM_ParallelSweepScheme::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size)
 {
+	if ((memoryPool == _lazySweepPool) && (NULL != _lazySweepNextChunk)) {
+		return sweepDeferredChunks(env, size);
+	}
 	return false;
 }
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 
 void
 MM_ParallelSweepScheme::setMarkMap(MM_MarkMap *markMap)
@@ -97,6 +97,14 @@ class MM_ParallelSweepScheme : public MM_BaseVirtual
 private:
 	uintptr_t _chunksPrepared; 
 
+	MM_MemoryPool *_lazySweepPool; /**< Pool whose sweep may be left to allocating threads this cycle, NULL if lazy sweep is not in use */
+	MM_ParallelSweepChunk *_lazySweepNextChunk; /**< Next chunk of the lazy sweep pool left unswept, NULL once the sweep is complete */
+	uintptr_t _lazySweepNextChunkIndex; /**< Position of _lazySweepNextChunk in sectioning iterator order */
+	uintptr_t _lazySweepDeferredBytes; /**< Heap bytes in the chunks left unswept */
+	uintptr_t _lazySweepSweptBytes; /**< Heap bytes of the lazy sweep pool swept in the GC */
+	double _lazySweepFreeRatio; /**< Fraction of the bytes swept in the GC found free, used to project the free memory in the unswept chunks */
+	bool _lazySweepCompleting; /**< Set while a sweep task sweeps just the chunks left unswept */
+
 protected:
 	MM_GCExtensionsBase *_extensions;
 	MM_ParallelDispatcher *_dispatcher;
@@ -135,6 +143,30 @@ protected:
 
 	void initializeSweepStates(MM_EnvironmentBase *env);
 
+	/**
+	 * Choose the chunks of the lazy sweep pool to leave unswept at the end of the GC. Enough leading chunks are
+	 * kept for every GC thread to sweep one; the rest are left for allocating threads.
+	 * @param totalChunkCount total number of chunks in the heap
+	 */
+	void selectDeferredChunks(MM_EnvironmentBase *env, uintptr_t totalChunkCount);
+
+	/**
+	 * Determine whether a chunk is skipped by the current sweep task: chunks left unswept by a lazy sweep are skipped
+	 * in the GC, and all others are skipped when completing the sweep.
+	 * @param chunk the chunk
+	 * @param chunkNum position of the chunk in sectioning iterator order
+	 */
+	bool isSkippedChunk(MM_ParallelSweepChunk *chunk, uintptr_t chunkNum);
+
+	/**
+	 * Sweep (unless already swept by a completion task) and connect unswept chunks of the lazy sweep pool onto the tail
+	 * of its free list, until a free entry of the given size is found or no chunks are left.
+	 * @note The caller holds the pool lock or has exclusive access
+	 * @param minimumFreeSize the size of free entry to stop at
+	 * @return true if a free entry of at least minimumFreeSize was connected, false otherwise
+	 */
+	bool sweepDeferredChunks(MM_EnvironmentBase *env, uintptr_t minimumFreeSize);
+
 	void flushFinalChunk(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool);
 	void flushAllFinalChunks(MM_EnvironmentBase *env);
 
@@ -189,9 +221,13 @@ public:
 	 */
 	void heapReconfigured(MM_EnvironmentBase *env);
 
-#if defined(OMR_GC_CONCURRENT_SWEEP)
 	virtual bool replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size);
-#endif /* OMR_GC_CONCURRENT_SWEEP */
+
+	/**
+	 * Serially sweep all chunks left unswept by a lazy sweep, for callers that cannot dispatch GC threads.
+	 * @note Takes the lazy sweep pool lock, which the caller must not hold
+	 */
+	void completeLazySweep(MM_EnvironmentBase *env);
 
 	/**
 	 * Accurately measure the dark matter within the mark map uintptr_t beginning at heapSlotFreeCurrent.
@@ -209,7 +245,7 @@ public:
 	 */
 	uintptr_t performSamplingCalculations(MM_ParallelSweepChunk *sweepChunk, uintptr_t* markMapCurrent, uintptr_t* heapSlotFreeCurrent);
 
-	virtual bool isSweepCompleted(MM_EnvironmentBase* env) { return true; }
+	virtual bool isSweepCompleted(MM_EnvironmentBase* env) { return NULL == _lazySweepNextChunk; }
 
 	/**
 	 * Create a ParallelSweepScheme object.
@@ -217,6 +253,13 @@ public:
 	MM_ParallelSweepScheme(MM_EnvironmentBase *env)
 		: MM_BaseVirtual()
 		, _chunksPrepared(0)
+		, _lazySweepPool(NULL)
+		, _lazySweepNextChunk(NULL)
+		, _lazySweepNextChunkIndex(0)
+		, _lazySweepDeferredBytes(0)
+		, _lazySweepSweptBytes(0)
+		, _lazySweepFreeRatio(0.0)
+		, _lazySweepCompleting(false)
 		, _extensions(env->getExtensions())
 		, _dispatcher(_extensions->dispatcher)
 		, _currentMarkMap(NULL)
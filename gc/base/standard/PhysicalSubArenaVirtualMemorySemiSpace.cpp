@@ -707,7 +707,8 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::contract(MM_EnvironmentBase *env, uin
 		_subSpace->heapReconfigured(env, HEAP_RECONFIG_CONTRACT);
 
 		/* Decommit the heap (the return value really doesn't matter here - its already too late) */
-		_heap->decommitMemory(
+		_heap->decommitContractedMemory(
+			env,
 			removeMemoryBase,
 			removeMemorySize,
 			previousValidAddressNotRemoved,
@@ -890,7 +891,8 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::contract(MM_EnvironmentBase *env, uin
 		_subSpace->heapReconfigured(env, HEAP_RECONFIG_CONTRACT);
 
 		/* Decommit the heap (the return value really doesn't matter here - its already too late) */
-		_heap->decommitMemory(
+		_heap->decommitContractedMemory(
+			env,
 			removeMemoryBase,
 			removeMemorySize,
 			previousValidAddressNotRemoved,
@@ -26,9 +26,13 @@
 #if defined(OMR_GC_REALTIME)
 
 #include "Debug.hpp"
+#include "GCExtensionsBase.hpp"
+#include "OMRVMThreadListIterator.hpp"
 #include "RememberedSetSATB.hpp"
 #include "WorkPackets.hpp"
 
+#include <string.h>
+
 /**
  * Object creation and destruction 
  *
@@ -44,7 +48,7 @@ MM_RememberedSetSATB::newInstance(MM_EnvironmentBase *env, MM_WorkPacketsSATB *w
 {
 	MM_RememberedSetSATB *rememberedSet;
 	
-	rememberedSet = (MM_RememberedSetSATB *)env->getForge()->allocate(sizeof(MM_RememberedSetSATB), MM_AllocationCategory::WORK_PACKETS, J9_GET_CALLSITE());
+	rememberedSet = (MM_RememberedSetSATB *)env->getForge()->allocate(sizeof(MM_RememberedSetSATB), MM_AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
 	if (NULL != rememberedSet) {
 		new(rememberedSet) MM_RememberedSetSATB(env, workPackets);
 		if (!rememberedSet->initialize(env)) {
@@ -308,4 +312,81 @@ MM_RememberedSetSATB::refreshFragment(MM_EnvironmentBase *env, MM_GCRememberedSe
 	return result;
 }
 
+/**
+ * Handle a store into a thread's local buffer which is full or not yet allocated.
+ * @param value The value to store.
+ */
+void
+MM_RememberedSetSATB::storeInBufferSlow(MM_EnvironmentBase* env, UDATA* value)
+{
+	if (NULL == env->_sATBBarrierBufferBase) {
+		UDATA bufferSize = env->getExtensions()->sATBBarrierBufferSize;
+		if (0 != bufferSize) {
+			env->_sATBBarrierBufferBase = (UDATA *)env->getForge()->allocate(bufferSize * sizeof(UDATA), MM_AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+		}
+		if (NULL == env->_sATBBarrierBufferBase) {
+			/* No local buffer, so the value has to go straight to overflow */
+			_workPackets->overflowItem(env, (void *)value, OVERFLOW_TYPE_BARRIER);
+			return;
+		}
+		env->_sATBBarrierBufferAlloc = env->_sATBBarrierBufferBase;
+		env->_sATBBarrierBufferTop = env->_sATBBarrierBufferBase + bufferSize;
+	} else {
+		flushBuffer(env);
+	}
+
+	*env->_sATBBarrierBufferAlloc = (UDATA)value;
+	env->_sATBBarrierBufferAlloc += 1;
+}
+
+/**
+ * Copy the entries of the thread's local buffer into barrier packets, a packet at a time, and publish
+ * the packets so concurrent tracing can process them while the thread carries on. The buffer is empty
+ * on return.
+ */
+void
+MM_RememberedSetSATB::flushBuffer(MM_EnvironmentBase* env)
+{
+	UDATA *entry = env->_sATBBarrierBufferBase;
+	UDATA *endEntry = env->_sATBBarrierBufferAlloc;
+
+	while (entry < endEntry) {
+		MM_Packet *packet = _workPackets->getBarrierPacket(env);
+		if (NULL == packet) {
+			/* Out of packets, so the remaining entries have to go to overflow */
+			while (entry < endEntry) {
+				_workPackets->overflowItem(env, (void *)*entry, OVERFLOW_TYPE_BARRIER);
+				entry += 1;
+			}
+			break;
+		}
+
+		UDATA **packetAlloc = packet->getCurrentAddr(env);
+		UDATA count = OMR_MIN(packet->freeSlots(), (UDATA)(endEntry - entry));
+		memcpy(*packetAlloc, entry, count * sizeof(UDATA));
+		*packetAlloc += count;
+		entry += count;
+		_workPackets->putPacket(env, packet);
+	}
+
+	env->_sATBBarrierBufferAlloc = env->_sATBBarrierBufferBase;
+}
+
+/**
+ * Flush the local buffers of all threads so that every recorded value is visible to the collector.
+ * Called before the final tracing of a cycle.
+ */
+void
+MM_RememberedSetSATB::flushAllBuffers(MM_EnvironmentBase* env)
+{
+	GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+	OMR_VMThread *walkThread = NULL;
+	while (NULL != (walkThread = threadListIterator.nextOMRVMThread())) {
+		MM_EnvironmentBase *walkEnv = MM_EnvironmentBase::getEnvironment(walkThread);
+		if (walkEnv->_sATBBarrierBufferAlloc != walkEnv->_sATBBarrierBufferBase) {
+			flushBuffer(walkEnv);
+		}
+	}
+}
+
 #endif /* defined(OMR_GC_REALTIME) */
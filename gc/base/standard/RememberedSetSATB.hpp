@@ -28,6 +28,7 @@
 
 #include "WorkPacketsSATB.hpp"
 #include "BaseNonVirtual.hpp"
+#include "EnvironmentBase.hpp"
 
 class EnvironmentModron;
 
@@ -77,6 +78,37 @@ public:
 	}
 	void flushFragments(MM_EnvironmentBase* env); /* Ensures all fragments will be seen as invalid next time they are accessed. */
 	bool refreshFragment(MM_EnvironmentBase *env, MM_GCRememberedSetFragment* fragment);
+
+	/**
+	 * Record a value in the calling thread's local buffer. This is an alternative to storeInFragment for
+	 * barriers which can reach the environment: the fast path is a bump and store, and the buffer is
+	 * handed to the collector in bulk when it fills.
+	 * @param value The value to record.
+	 */
+	MMINLINE void
+	storeInBuffer(MM_EnvironmentBase* env, UDATA* value)
+	{
+		if (env->_sATBBarrierBufferAlloc < env->_sATBBarrierBufferTop) {
+			*env->_sATBBarrierBufferAlloc = (UDATA)value;
+			env->_sATBBarrierBufferAlloc += 1;
+		} else {
+			storeInBufferSlow(env, value);
+		}
+	}
+	/**
+	 * Snapshot at the beginning pre-store barrier. Records the reference about to be overwritten, but only
+	 * while the barrier is enabled (between kickoff and the final collection of a concurrent cycle).
+	 * @param overwrittenObject The object currently held by the slot being stored into, or NULL.
+	 */
+	MMINLINE void
+	preObjectStore(MM_EnvironmentBase* env, omrobjectptr_t overwrittenObject)
+	{
+		if ((NULL != overwrittenObject) && !isGlobalFragmentIndexPreserved(env)) {
+			storeInBuffer(env, (UDATA *)overwrittenObject);
+		}
+	}
+	void flushBuffer(MM_EnvironmentBase* env); /* Moves the entries of the thread's local buffer into barrier packets. */
+	void flushAllBuffers(MM_EnvironmentBase* env); /* Flushes the local buffers of all threads. Caller must hold exclusive VM access. */
 	
 protected:
 	bool initialize(MM_EnvironmentBase *env);
@@ -86,6 +118,7 @@ protected:
 	
 private:
 	void setGlobalIndex(MM_EnvironmentBase* env, UDATA indexValue); /* Increments the appropriate global index (global or preserved). */
+	void storeInBufferSlow(MM_EnvironmentBase* env, UDATA* value); /* Allocates or flushes the thread's local buffer, then stores the value. */
 };
 #endif /* defined(OMR_GC_REALTIME) */
 #endif /* REMEMBEREDSETSATB_HPP_ */
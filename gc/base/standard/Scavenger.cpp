@@ -30,6 +30,7 @@
 #endif
 
 #include <math.h>
+#include <new>
 
 #include "omrcfg.h"
 #include "omrcomp.h"
@@ -101,6 +102,8 @@
 
 #define INITIAL_FREE_HISTORY_WEIGHT ((float)0.8)
 #define TENURE_BYTES_HISTORY_WEIGHT ((float)0.9)
+#define PAUSE_TARGET_HISTORY_WEIGHT ((float)0.5)
+#define PAUSE_TARGET_REMEMBERED_SET_ENTRY_BYTES 64 /* bytes of copy work equivalent to scanning one remembered set entry */
 
 #define FLIP_TENURE_LARGE_SCAN 4
 #define FLIP_TENURE_LARGE_SCAN_DEFERRED 5
@@ -232,6 +235,24 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	/* Concurrent Scavenger mutators push caches on behalf of other threads, so they keep using the shared scan lists */
+	if (_extensions->scavengerWorkStealing && !_extensions->isConcurrentScavengerEnabled()) {
+		_scanCacheDequeCount = _extensions->gcThreadCount;
+		_scanCacheDeques = (MM_CopyScanCacheDeque *)_extensions->getForge()->allocate(sizeof(MM_CopyScanCacheDeque) * _scanCacheDequeCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _scanCacheDeques) {
+			_scanCacheDequeCount = 0;
+			return false;
+		}
+		for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+			new (&_scanCacheDeques[i]) MM_CopyScanCacheDeque();
+		}
+		for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+			if (!_scanCacheDeques[i].initialize(env, _extensions->scavengerScanDequeSize, i + 1)) {
+				return false;
+			}
+		}
+	}
+
 	if (omrthread_monitor_init_with_name(&_scanCacheMonitor, 0, "MM_Scavenger::scanCacheMonitor")) {
 		return false;
 	}
@@ -307,6 +328,15 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
+	if (NULL != _scanCacheDeques) {
+		for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+			_scanCacheDeques[i].tearDown(env);
+		}
+		_extensions->getForge()->free(_scanCacheDeques);
+		_scanCacheDeques = NULL;
+		_scanCacheDequeCount = 0;
+	}
+
 	if (NULL != _scanCacheMonitor) {
 		omrthread_monitor_destroy(_scanCacheMonitor);
 		_scanCacheMonitor = NULL;
@@ -391,6 +421,13 @@ MM_Scavenger::mainSetupForGC(MM_EnvironmentStandard *env)
 	/* Clear the cycle gc statistics. Increment level stats will be cleared just prior to increment start. */
 	clearCycleGCStats(env);
 
+	/* Record the copy/scan cache size bound chosen for this cycle and the stall it was chosen from */
+	if (0 == _copyScanCacheSizeTarget) {
+		_copyScanCacheSizeTarget = _extensions->scavengerScanCacheMaximumSize;
+	}
+	_extensions->scavengerStats._copyScanCacheSizeTarget = _copyScanCacheSizeTarget;
+	_extensions->scavengerStats._previousScanStallPercent = _previousScanStallPercent;
+
 	/* invoke language-specific interface callback */
 	_delegate.mainSetupForGC(env);
 
@@ -419,6 +456,8 @@ MM_Scavenger::mainSetupForGC(MM_EnvironmentStandard *env)
 	scavengerStats->_tenureSpaceAllocBytesAcumulation += heapStatsTenureSpace._allocBytes;
 	scavengerStats->_semiSpaceAllocBytesAcumulation += heapStatsSemiSpace._allocBytes;
 
+	calculatePauseTargetThreads(env, _evacuateMemorySubSpace->getActiveMemorySize() - _evacuateMemorySubSpace->getApproximateActiveFreeMemorySize());
+
 	/* Check if scvTenureAdaptiveTenureAge has not been initialized or forced (by cmdline option) */
 	if (0 == _extensions->scvTenureAdaptiveTenureAge) {
 		/* With larger initial Nursery sizes, we'll reduce initial tenure age, to help promote peristant object sooner. */
@@ -440,9 +479,51 @@ MM_Scavenger::mainSetupForGC(MM_EnvironmentStandard *env)
 	_activeSubSpace->cacheRanges(_evacuateMemorySubSpace, &_evacuateSpaceBase, &_evacuateSpaceTop);
 	_activeSubSpace->cacheRanges(_survivorMemorySubSpace, &_survivorSpaceBase, &_survivorSpaceTop);
 
+	bindSurvivorToNumaNodes(env);
+
 	/* assume that value of RS Overflow flag will not be changed until scavengeRememberedSet() call, so handle it first */
 	_isRememberedSetInOverflowAtTheBeginning = isRememberedSetInOverflowState();
-	_extensions->rememberedSet.startProcessingSublist();
+	if (isRememberedSetChunked()) {
+		_extensions->rememberedSet.startProcessingChunks();
+	} else {
+		_extensions->rememberedSet.startProcessingSublist();
+	}
+}
+
+void
+MM_Scavenger::bindSurvivorToNumaNodes(MM_EnvironmentStandard *env)
+{
+	_numaSurvivorStripeSize = 0;
+	if (_extensions->scavengerNumaAwareCopy) {
+		_numaSurvivorNodes = _extensions->_numaManager.getAffinityLeaders(&_numaSurvivorNodeCount);
+		if (0 < _numaSurvivorNodeCount) {
+			uintptr_t survivorSize = (uintptr_t)_survivorSpaceTop - (uintptr_t)_survivorSpaceBase;
+			uintptr_t stripeSize = MM_Math::roundToCeiling(_extensions->heap->getPageSize(), survivorSize / _numaSurvivorNodeCount);
+			bool bound = ((_survivorSpaceBase == _numaBoundSurvivorBase[0]) && (_survivorSpaceTop == _numaBoundSurvivorTop[0]))
+					|| ((_survivorSpaceBase == _numaBoundSurvivorBase[1]) && (_survivorSpaceTop == _numaBoundSurvivorTop[1]));
+
+			if (!bound) {
+				bound = true;
+				for (uintptr_t i = 0; bound && (i < _numaSurvivorNodeCount); i++) {
+					uintptr_t stripeBase = (uintptr_t)_survivorSpaceBase + (i * stripeSize);
+					uintptr_t stripeTop = OMR_MIN(stripeBase + stripeSize, (uintptr_t)_survivorSpaceTop);
+					if (stripeBase < stripeTop) {
+						bound = _extensions->heap->setNumaAffinity(_numaSurvivorNodes[i].j9NodeNumber, (void *)stripeBase, stripeTop - stripeBase);
+					}
+				}
+				if (bound) {
+					/* semispaces alternate as survivor space, so remember both */
+					_numaBoundSurvivorBase[1] = _numaBoundSurvivorBase[0];
+					_numaBoundSurvivorTop[1] = _numaBoundSurvivorTop[0];
+					_numaBoundSurvivorBase[0] = _survivorSpaceBase;
+					_numaBoundSurvivorTop[0] = _survivorSpaceTop;
+				}
+			}
+			if (bound) {
+				_numaSurvivorStripeSize = stripeSize;
+			}
+		}
+	}
 }
 
 void
@@ -477,6 +558,26 @@ MM_Scavenger::workerSetupForGC(MM_EnvironmentStandard *env)
 	Assert_MM_false(env->_loaAllocation);
 	Assert_MM_true(NULL == env->_survivorTLHRemainderBase);
 	Assert_MM_true(NULL == env->_survivorTLHRemainderTop);
+
+	/* Cache the node of this thread so copy caches can be taken from, and bound to, local memory */
+	env->_scavengerNumaNode = 0;
+	if (_extensions->scavengerNumaAwareCopy && (0 < _extensions->_numaManager.getAffinityLeaderCount())) {
+		env->_scavengerNumaNode = env->getNumaAffinity();
+	}
+
+	/* Bound this thread's copy/scan cache sizes */
+	uintptr_t maxCacheSize = _extensions->scavengerScanCacheMaximumSize;
+	if (_extensions->scavengerAdaptiveCacheSize && (0 != _copyScanCacheSizeTarget)) {
+		maxCacheSize = _copyScanCacheSizeTarget;
+		if (env->_scanStallPercent < _previousScanStallPercent) {
+			/* This thread was busier than average in the last cycle, so it likely held work that others
+			 * stalled waiting for. Have it hand out work in proportionally smaller caches. */
+			uintptr_t minCacheSize = _extensions->scavengerScanCacheMinimumSize;
+			maxCacheSize = (maxCacheSize / (100 - env->_scanStallPercent)) * (100 - _previousScanStallPercent);
+			maxCacheSize = MM_Math::roundToCeiling(_extensions->getObjectAlignmentInBytes(), OMR_MAX(maxCacheSize, minCacheSize));
+		}
+	}
+	env->_copyScanCacheSizeMaximum = maxCacheSize;
 }
 
 uintptr_t
@@ -567,6 +668,117 @@ MM_Scavenger::calculateRecommendedWorkingThreads(MM_EnvironmentStandard *env)
 	Trc_MM_Scavenger_calculateRecommendedWorkingThreads_setRecommendedThreads(env->getLanguageVMThread(), scavengeTotalTime, totalStallTime, (percentStall*100), totalThreads, idealThreads, adjustedAverage, (adjustedAverage +  _extensions->adaptiveThreadBooster), _recommendedThreads);
 }
 
+void
+MM_Scavenger::calculatePauseTargetThreads(MM_EnvironmentStandard *env, uintptr_t evacuateBytes)
+{
+	MM_ScavengerStats *scavengerStats = &_extensions->scavengerStats;
+	_pauseTargetThreads = UDATA_MAX;
+	_pauseTargetEvacuateBytes = evacuateBytes;
+	scavengerStats->_pauseTargetExpectedBytes = 0;
+	scavengerStats->_pauseTargetThreads = 0;
+
+	if ((0 == _extensions->scavengerPauseTarget) || !_extensions->adaptiveThreadingEnabled() || _extensions->isConcurrentScavengerEnabled() || (0 == _pauseTargetThroughput)) {
+		/* Disabled, thread count forced by the user, or nothing observed yet to project from */
+		return;
+	}
+
+	uintptr_t rememberedSetCount = (uintptr_t)_extensions->rememberedSet.countElements();
+	uintptr_t expectedBytes = (uintptr_t)((float)evacuateBytes * _pauseTargetSurvivalRate) + (rememberedSetCount * PAUSE_TARGET_REMEMBERED_SET_ENTRY_BYTES);
+
+	/* Each thread adds throughput * efficiency bytes per millisecond of pause */
+	float bytesPerThreadInTarget = _pauseTargetThroughput * _pauseTargetEfficiency * (float)_extensions->scavengerPauseTarget;
+	uintptr_t threads = (uintptr_t)((float)expectedBytes / bytesPerThreadInTarget) + 1;
+
+	_pauseTargetThreads = threads;
+	scavengerStats->_pauseTargetExpectedBytes = expectedBytes;
+	scavengerStats->_pauseTargetThreads = threads;
+
+	Trc_MM_Scavenger_calculatePauseTargetThreads(env->getLanguageVMThread(), evacuateBytes, rememberedSetCount, expectedBytes, (uintptr_t)_pauseTargetThroughput, (uintptr_t)(_pauseTargetEfficiency * 100), threads);
+}
+
+void
+MM_Scavenger::updatePauseTargetModel(MM_EnvironmentStandard *env)
+{
+	if ((0 == _extensions->scavengerPauseTarget) || !_extensions->adaptiveThreadingEnabled() || _extensions->isConcurrentScavengerEnabled()) {
+		return;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_ScavengerStats *scavengerStats = &_extensions->scavengerStats;
+	uint64_t scavengeTime = omrtime_hires_delta(scavengerStats->_startTime, scavengerStats->_endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	uintptr_t copiedBytes = scavengerStats->_flipBytes + scavengerStats->_tenureAggregateBytes;
+	uintptr_t work = copiedBytes + (scavengerStats->_rememberedSetEntryCount * PAUSE_TARGET_REMEMBERED_SET_ENTRY_BYTES);
+	float efficiency = (float)(100 - scavengerStats->_scanStallPercent) / 100.0f;
+	float busyThreadMillis = ((float)_dispatcher->activeThreadCount() * (float)scavengeTime * efficiency) / 1000.0f;
+
+	if ((0 == _pauseTargetEvacuateBytes) || (0 == work) || (0 == busyThreadMillis)) {
+		/* Nothing to learn from an empty Scavenge */
+		return;
+	}
+
+	float survivalRate = (float)copiedBytes / (float)_pauseTargetEvacuateBytes;
+	float throughput = (float)work / busyThreadMillis;
+	if (0 == _pauseTargetThroughput) {
+		_pauseTargetSurvivalRate = survivalRate;
+		_pauseTargetThroughput = throughput;
+		_pauseTargetEfficiency = efficiency;
+	} else {
+		_pauseTargetSurvivalRate = MM_Math::weightedAverage(_pauseTargetSurvivalRate, survivalRate, PAUSE_TARGET_HISTORY_WEIGHT);
+		_pauseTargetThroughput = MM_Math::weightedAverage(_pauseTargetThroughput, throughput, PAUSE_TARGET_HISTORY_WEIGHT);
+		_pauseTargetEfficiency = MM_Math::weightedAverage(_pauseTargetEfficiency, efficiency, PAUSE_TARGET_HISTORY_WEIGHT);
+	}
+}
+
+void
+MM_Scavenger::calculateRecommendedCopyScanCacheSize(MM_EnvironmentStandard *env)
+{
+	MM_ScavengerStats *scavengerStats = &_extensions->scavengerStats;
+	_previousScanStallPercent = scavengerStats->_scanStallPercent;
+
+	if (!_extensions->scavengerAdaptiveCacheSize || _extensions->isConcurrentScavengerEnabled()) {
+		return;
+	}
+
+	if (_isRememberedSetInOverflowAtTheBeginning || scavengerStats->_causedRememberedSetOverflow) {
+		/* Stalling in an overflowed cycle says little about cache sizing, keep the current bound */
+		return;
+	}
+
+	/* Fold this cycle's copy/scan history into a single record to get the cycle's overall scaling factor */
+	uintptr_t recordCount = 0;
+	MM_ScavengerCopyScanRatio::UpdateHistory *history = _extensions->copyScanRatio.getHistory(&recordCount);
+	MM_ScavengerCopyScanRatio::UpdateHistory cycleRecord;
+	memset(&cycleRecord, 0, sizeof(cycleRecord));
+	for (uintptr_t i = 0; i < recordCount; i++) {
+		cycleRecord.waits += history[i].waits;
+		cycleRecord.copied += history[i].copied;
+		cycleRecord.scanned += history[i].scanned;
+		cycleRecord.updates += history[i].updates;
+		cycleRecord.threads += history[i].threads;
+		cycleRecord.majorUpdates += history[i].majorUpdates;
+	}
+	double scalingFactor = 1.0;
+	if (0 < cycleRecord.majorUpdates) {
+		scalingFactor = _extensions->copyScanRatio.getScalingFactor(env, &cycleRecord);
+	}
+
+	uintptr_t minCacheSize = _extensions->scavengerScanCacheMinimumSize;
+	uintptr_t maxCacheSize = _extensions->scavengerScanCacheMaximumSize;
+	uintptr_t stallThreshold = _extensions->scavengerAdaptiveCacheSizeStallThreshold;
+	uintptr_t cacheSize = _copyScanCacheSizeTarget;
+	if (scavengerStats->_scanStallPercent > stallThreshold) {
+		/* Threads starved for scan work, so publish work sooner in smaller caches. Shrink harder the further
+		 * copying ran ahead of scanning, but by at least 1/8 and at most 1/2 per cycle to converge quickly without oscillating. */
+		double shrinkFactor = OMR_MAX(0.5, OMR_MIN(0.875, scalingFactor));
+		cacheSize = (uintptr_t)((double)cacheSize * shrinkFactor);
+	} else if ((scavengerStats->_scanStallPercent * 2) < stallThreshold) {
+		/* Little stalling, so win back per-cache overhead with larger caches */
+		cacheSize += cacheSize / 4;
+	}
+	cacheSize = OMR_MIN(OMR_MAX(cacheSize, minCacheSize), maxCacheSize);
+	_copyScanCacheSizeTarget = MM_Math::roundToCeiling(_extensions->getObjectAlignmentInBytes(), cacheSize);
+}
+
 /**
  * Run a scavenge.
  */
@@ -574,7 +786,7 @@ void
 MM_Scavenger::scavenge(MM_EnvironmentBase *envBase)
 {
 	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envBase);
-	MM_ParallelScavengeTask scavengeTask(env, _dispatcher, this, env->_cycleState, _recommendedThreads);
+	MM_ParallelScavengeTask scavengeTask(env, _dispatcher, this, env->_cycleState, OMR_MIN(_recommendedThreads, _pauseTargetThreads));
 	_dispatcher->run(env, &scavengeTask);
 
 	/* remove all scan caches temporary allocated in Heap */
@@ -780,6 +992,9 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	finalGCStats->_acquireScanListCount += scavStats->_acquireScanListCount;
 	finalGCStats->_releaseScanListCount += scavStats->_releaseScanListCount;
 	finalGCStats->_acquireListLockCount += scavStats->_acquireListLockCount;
+	finalGCStats->_scanCacheStealAttemptCount += scavStats->_scanCacheStealAttemptCount;
+	finalGCStats->_scanCacheStealCount += scavStats->_scanCacheStealCount;
+	finalGCStats->_scanCacheStealFailCount += scavStats->_scanCacheStealFailCount;
 	finalGCStats->_aliasToCopyCacheCount += scavStats->_aliasToCopyCacheCount;
 	finalGCStats->_arraySplitCount += scavStats->_arraySplitCount;
 	finalGCStats->_arraySplitAmount += scavStats->_arraySplitAmount;
@@ -813,6 +1028,11 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	finalGCStats->_tenureExpandedCount += scavStats->_tenureExpandedCount;
 	finalGCStats->_tenureExpandedTime += scavStats->_tenureExpandedTime;
 
+	finalGCStats->_rememberedSetEntryCount += scavStats->_rememberedSetEntryCount;
+	finalGCStats->_rememberedSetChunkCount += scavStats->_rememberedSetChunkCount;
+	finalGCStats->_rememberedSetScanTime = OMR_MAX(finalGCStats->_rememberedSetScanTime, scavStats->_rememberedSetScanTime);
+	finalGCStats->_rememberedSetPruneTime = OMR_MAX(finalGCStats->_rememberedSetPruneTime, scavStats->_rememberedSetPruneTime);
+
 #if defined(OMR_SCAVENGER_TRACK_COPY_DISTANCE)
 	for (uintptr_t i = 0; i < OMR_SCAVENGER_DISTANCE_BINS; i++) {
 		finalGCStats->_copy_distance_counts[i] += scavStats->_copy_distance_counts[i];
@@ -821,6 +1041,15 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	for (uintptr_t i = 0; i < OMR_SCAVENGER_CACHESIZE_BINS; i++) {
 		finalGCStats->_copy_cachesize_counts[i] += scavStats->_copy_cachesize_counts[i];
 	}
+	for (uintptr_t i = 0; i < OMR_SCAVENGER_NUMA_NODE_BINS; i++) {
+		finalGCStats->_numaPreferredCopyCount[i] += scavStats->_numaPreferredCopyCount[i];
+		finalGCStats->_numaOtherCopyCount[i] += scavStats->_numaOtherCopyCount[i];
+	}
+	for (uintptr_t age = 0; age <= OBJECT_HEADER_AGE_MAX+1; age++) {
+		for (uintptr_t i = 0; i < OMR_SCAVENGER_AGE_SIZE_BINS; i++) {
+			finalGCStats->_ageSizeHistogram[age][i] += scavStats->_ageSizeHistogram[age][i];
+		}
+	}
 	finalGCStats->_leafObjectCount += scavStats->_leafObjectCount;
 	finalGCStats->_copy_cachesize_sum += scavStats->_copy_cachesize_sum;
 	finalGCStats->_workStallTime += scavStats->_workStallTime;
@@ -853,6 +1082,14 @@ MM_Scavenger::mergeThreadGCStats(MM_EnvironmentBase *env)
 	env->_scavengerStats._workerScavengeEndTime = omrtime_hires_clock();
 	mergeGCStatsBase(env, &_extensions->incrementScavengerStats, scavStats);
 
+	/* Remember how much of this thread's time went to stalling, to bound its cache sizes in the next cycle */
+	MM_EnvironmentStandard *envStandard = MM_EnvironmentStandard::getEnvironment(env);
+	uint64_t workerScavengeTime = scavStats->_workerScavengeEndTime - scavStats->_workerScavengeStartTime;
+	envStandard->_scanStallPercent = 0;
+	if (0 < workerScavengeTime) {
+		envStandard->_scanStallPercent = (uintptr_t)OMR_MIN((uint64_t)100, ((scavStats->_workStallTime + scavStats->_completeStallTime) * 100) / workerScavengeTime);
+	}
+
 	/* Merge language specific statistics. No known interesting data per increment - they are merged directly to aggregate cycle stats */
 	_delegate.mergeGCStats_mergeLangStats(env);
 
@@ -901,6 +1138,14 @@ MM_Scavenger::mergeIncrementGCStats(MM_EnvironmentBase *env, bool lastIncrement)
 		}
 		finalGCStats->_tenureAge = tenureAge;
 
+		/* Calculate the share of GC thread time spent stalled waiting for scan work */
+		uint64_t scavengeTime = _extensions->incrementScavengerStats._endTime - _extensions->incrementScavengerStats._startTime;
+		uint64_t threadTime = scavengeTime * _dispatcher->activeThreadCount();
+		finalGCStats->_scanStallPercent = 0;
+		if (0 < threadTime) {
+			finalGCStats->_scanStallPercent = (uintptr_t)OMR_MIN((uint64_t)100, ((finalGCStats->_workStallTime + finalGCStats->_completeStallTime) * 100) / threadTime);
+		}
+
 		/* Update historical flip stats for age 0 */
 		MM_ScavengerStats::FlipHistory* flipHistoryPrevious = finalGCStats->getFlipHistory(1);
 		flipHistoryPrevious->_flipBytes[0] = finalGCStats->_semiSpaceAllocBytesAcumulation;
@@ -1021,7 +1266,11 @@ MMINLINE uintptr_t
 MM_Scavenger::calculateOptimumCopyScanCacheSize(MM_EnvironmentStandard *env)
 {
 	uintptr_t threadCount = _dispatcher->threadCount();
-	uintptr_t maxCacheSize = _extensions->scavengerScanCacheMaximumSize;
+	uintptr_t maxCacheSize = env->_copyScanCacheSizeMaximum;
+	if (0 == maxCacheSize) {
+		/* not a GC thread set up for this scavenge */
+		maxCacheSize = _extensions->scavengerScanCacheMaximumSize;
+	}
 	uintptr_t cacheSize = maxCacheSize;
 	uintptr_t waitingThreads = _waitingCount;
 	if (waitingThreads > 0) {
@@ -1035,7 +1284,7 @@ MM_Scavenger::calculateOptimumCopyScanCacheSize(MM_EnvironmentStandard *env)
 		cacheSize = OMR_MIN(cacheSizeBasedOnScanCacheCount, cacheSize);
 	}
 
-	env->_scavengerStats.countCopyCacheSize(cacheSize, maxCacheSize);
+	env->_scavengerStats.countCopyCacheSize(cacheSize, _extensions->scavengerScanCacheMaximumSize);
 
 #if defined(J9MODRON_SCAVENGER_TRACE)
     PORT_ACCESS_FROM_ENVIRONMENT(env);
@@ -1206,6 +1455,7 @@ retry:
 				copyCache->flags &= OMR_SCAVENGER_CACHE_TYPE_HEAP;
 				copyCache->flags |= OMR_SCAVENGER_CACHE_TYPE_SEMISPACE | OMR_SCAVENGER_CACHE_TYPE_COPY;
 				copyCache->reinitCache(addrBase, addrTop);
+				copyCache->_numaNode = getSurvivorNumaNode(addrBase);
 			} else {
 				/* can not allocate a copyCache header, release allocated memory */
 				/* return memory to pool */
@@ -1556,6 +1806,10 @@ MM_Scavenger::forwardingSucceeded(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 		scavStats->_flipCount += 1;
 		scavStats->_flipBytes += objectCopySizeInBytes;
 		scavStats->getFlipHistory(0)->_flipBytes[oldObjectAge + 1] += objectReserveSizeInBytes;
+		scavStats->countAgeSize(oldObjectAge + 1, objectReserveSizeInBytes);
+		if (0 != env->_scavengerNumaNode) {
+			scavStats->countNumaCopy(env->_scavengerNumaNode, env->_scavengerNumaNode == copyCache->_numaNode);
+		}
 	}
 }
 
@@ -1989,13 +2243,46 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 	GC_SlotObject *slotObject = NULL;
 
 	MM_CopyScanCacheStandard **copyCache = &(env->_effectiveCopyScanCache);
-	while (NULL != (slotObject = objectScanner->getNextSlot())) {
-		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
-		shouldRemember |= isSlotObjectInNewSpace;
-		if (NULL != *copyCache) {
-			slotsCopied += 1;
+	uintptr_t batchSize = OMR_MIN(_extensions->scavengerSlotBatchSize, (uintptr_t)OMR_SCAVENGER_SLOT_BATCH_MAX);
+	if (1 < batchSize) {
+		/* Gather a batch of slots, prefetching the headers of referents that will have to be forwarded,
+		 * then forward the batch so that the header reads of later slots overlap with the copying of earlier ones */
+		fomrobject_t *batch[OMR_SCAVENGER_SLOT_BATCH_MAX];
+		bool moreSlots = true;
+		while (moreSlots) {
+			uintptr_t count = 0;
+			while (count < batchSize) {
+				slotObject = objectScanner->getNextSlot();
+				if (NULL == slotObject) {
+					moreSlots = false;
+					break;
+				}
+				omrobjectptr_t referent = slotObject->readReferenceFromSlot();
+				if ((NULL != referent) && isObjectInEvacuateMemory(referent)) {
+					MM_AtomicOperations::prefetchRead(referent);
+				}
+				batch[count] = slotObject->readAddressFromSlot();
+				count += 1;
+			}
+			for (uintptr_t i = 0; i < count; i++) {
+				GC_SlotObject batchSlotObject(env->getOmrVM(), batch[i]);
+				bool isSlotObjectInNewSpace = copyAndForward(env, &batchSlotObject);
+				shouldRemember |= isSlotObjectInNewSpace;
+				if (NULL != *copyCache) {
+					slotsCopied += 1;
+				}
+			}
+			slotsScanned += count;
+		}
+	} else {
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+			bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
+			shouldRemember |= isSlotObjectInNewSpace;
+			if (NULL != *copyCache) {
+				slotsCopied += 1;
+			}
+			slotsScanned += 1;
 		}
-		slotsScanned += 1;
 	}
 	updateCopyScanCounts(env, slotsScanned, slotsCopied);
 
@@ -2294,12 +2581,12 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
  	while (!doneFlag && !shouldAbortScanLoop(env)) {
- 		while (_cachedEntryCount > 0) {
+ 		while (isScanCacheAvailable()) {
  			cache = getNextScanCacheFromList(env);
 
 			if (NULL != cache) {
  				/* Check if there are threads waiting that should be notified because of pending entries */
- 				if((_cachedEntryCount > 0) && _waitingCount) {
+ 				if(isScanCacheAvailable() && _waitingCount) {
 					if (0 == omrthread_monitor_try_enter(_scanCacheMonitor)) {
 						if(0 != _waitingCount) {
 							omrthread_monitor_notify(_scanCacheMonitor);
@@ -2320,7 +2607,7 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 		_waitingCount += 1;
 
 		if(doneIndex == _doneIndex) {
-			if((env->_currentTask->getThreadCount() == _waitingCount) && (0 == _cachedEntryCount)) {
+			if((env->_currentTask->getThreadCount() == _waitingCount) && !isScanCacheAvailable()) {
 				flushBuffersForGetNextScanCache(env, true);
 
 				if (shouldDoFinalNotify(env)) {
@@ -2331,7 +2618,7 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 					env->_scavengerStats.addToNotifyStallTime(notifyStartTime, omrtime_hires_clock());
 				}
 			} else {
-				while((0 == _cachedEntryCount) && (doneIndex == _doneIndex) && !shouldAbortScanLoop(env)) {
+				while(!isScanCacheAvailable() && (doneIndex == _doneIndex) && !shouldAbortScanLoop(env)) {
 					flushBuffersForGetNextScanCache(env);
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 					uint64_t waitEndTime, waitStartTime;
@@ -2843,7 +3130,10 @@ MM_Scavenger::pruneRememberedSet(MM_EnvironmentStandard *env)
 	if(isRememberedSetInOverflowState()) {
 		pruneRememberedSetOverflow(env);
 	} else {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		uint64_t startTime = omrtime_hires_clock();
 		pruneRememberedSetList(env);
+		env->_scavengerStats._rememberedSetPruneTime += omrtime_hires_clock() - startTime;
 	}
 }
 
@@ -3071,6 +3361,30 @@ MM_Scavenger::scavengeRememberedSetListIndirect(MM_EnvironmentStandard *env)
 
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
+MMINLINE void
+MM_Scavenger::scavengeRememberedSetEntry(MM_EnvironmentStandard *env, omrobjectptr_t *slotPtr)
+{
+	omrobjectptr_t objectPtr = *slotPtr;
+	Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
+
+	/* First assume the object will not be remembered.
+	 * This is helpful for work completion ordering of split arrays.
+	 * Flag slot for later removal if we complete scavenge OK
+	 */
+	*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr | DEFERRED_RS_REMOVE_FLAG);
+	bool shouldBeRemembered = scavengeObjectSlots(env, NULL, objectPtr, GC_ObjectScanner::scanRoots, slotPtr);
+	if (_extensions->objectModel.hasIndirectObjectReferents((CLI_THREAD_TYPE*)env->getLanguageVMThread(), objectPtr)) {
+		shouldBeRemembered |= _delegate.scavengeIndirectObjectSlots(env, objectPtr);
+	}
+
+	shouldBeRemembered |= isRememberedThreadReference(env, objectPtr);
+
+	if (shouldBeRemembered) {
+		/* We want to remember this object after all; clear the flag for removal. */
+		*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
+	}
+}
+
 void
 MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 {
@@ -3086,39 +3400,48 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 		GC_SublistSlotIterator remSetSlotIterator(puddle);
 		omrobjectptr_t *slotPtr;
 		while((slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot()) != NULL) {
-			omrobjectptr_t objectPtr = *slotPtr;
-
-			if(NULL != objectPtr) {
-				Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
+			if(NULL != *slotPtr) {
 				numElements += 1;
-
-				/* First assume the object will not be remembered.
-				 * This is helpful for work completion ordering of split arrays.
-				 * Flag slot for later removal if we complete scavenge OK
-				 */
-				*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr | DEFERRED_RS_REMOVE_FLAG);
-				bool shouldBeRemembered = scavengeObjectSlots(env, NULL, objectPtr, GC_ObjectScanner::scanRoots, slotPtr);
-				if (_extensions->objectModel.hasIndirectObjectReferents((CLI_THREAD_TYPE*)env->getLanguageVMThread(), objectPtr)) {
-					shouldBeRemembered |= _delegate.scavengeIndirectObjectSlots(env, objectPtr);
-				}
-
-				shouldBeRemembered |= isRememberedThreadReference(env, objectPtr);
-
-				if (shouldBeRemembered) {
-					/* We want to remember this object after all; clear the flag for removal. */
-					*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
-				}
+				scavengeRememberedSetEntry(env, slotPtr);
 			} else {
 				remSetSlotIterator.removeSlot();
 			}
 		}
 
+		env->_scavengerStats._rememberedSetEntryCount += numElements;
 		Trc_MM_ParallelScavenger_scavengeRememberedSetList_donePuddle(env->getLanguageVMThread(), puddle, numElements);
 	}
 
 	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Exit(env->getLanguageVMThread());
 }
 
+void
+MM_Scavenger::scavengeRememberedSetListChunked(MM_EnvironmentStandard *env)
+{
+	Assert_MM_false(IS_CONCURRENT_ENABLED);
+
+	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Entry(env->getLanguageVMThread());
+
+	/* Remembered set walk, claiming fixed size chunks so that large puddles are shared between threads.
+	 * Empty entries are left in place for pruneRememberedSetList() to remove, since removing them here
+	 * would move entries in chunks that other threads may be scanning.
+	 */
+	uintptr_t chunkSize = _extensions->scavengerRememberedSetChunkSize;
+	uintptr_t *chunkBase = NULL;
+	uintptr_t *chunkTop = NULL;
+	while (_extensions->rememberedSet.claimChunk(chunkSize, &chunkBase, &chunkTop)) {
+		env->_scavengerStats._rememberedSetChunkCount += 1;
+		for (omrobjectptr_t *slotPtr = (omrobjectptr_t *)chunkBase; slotPtr < (omrobjectptr_t *)chunkTop; slotPtr++) {
+			if (NULL != *slotPtr) {
+				env->_scavengerStats._rememberedSetEntryCount += 1;
+				scavengeRememberedSetEntry(env, slotPtr);
+			}
+		}
+	}
+
+	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Exit(env->getLanguageVMThread());
+}
+
 /* NOTE - only  scavengeRememberedSetOverflow ends with a sync point.
  * Callers of this function must not assume that there is a sync point
  */
@@ -3136,7 +3459,14 @@ MM_Scavenger::scavengeRememberedSet(MM_EnvironmentStandard *env)
 		}
 	} else {
 		if (!IS_CONCURRENT_ENABLED) {
-			scavengeRememberedSetList(env);
+			OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+			uint64_t startTime = omrtime_hires_clock();
+			if (isRememberedSetChunked()) {
+				scavengeRememberedSetListChunked(env);
+			} else {
+				scavengeRememberedSetList(env);
+			}
+			env->_scavengerStats._rememberedSetScanTime += omrtime_hires_clock() - startTime;
 		}
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		/* Indirect refs are dealt within the root scanning phase (first STW phase), while the direct references are dealt within the main scan phase (typically concurrent). */
@@ -3551,7 +3881,10 @@ MM_Scavenger::returnEmptyCopyCachesToFreeList(MM_EnvironmentStandard *env)
 MMINLINE void
 MM_Scavenger::addCacheEntryToScanListAndNotify(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *newCacheEntry)
 {
-	_scavengeCacheScanList.pushCache(env, newCacheEntry);
+	MM_CopyScanCacheDeque *deque = getScanCacheDeque(env);
+	if ((NULL == deque) || !deque->push(newCacheEntry)) {
+		_scavengeCacheScanList.pushCache(env, newCacheEntry);
+	}
 	if (0 != _waitingCount) {
 		/* Added an entry to the list - notify any other threads that a new entry has appeared on the list */
 		if (0 == omrthread_monitor_try_enter(_scanCacheMonitor)) {
@@ -3630,7 +3963,58 @@ MM_Scavenger::aliasToCopyCache(MM_EnvironmentStandard *env, GC_SlotObject *scann
 MMINLINE MM_CopyScanCacheStandard *
 MM_Scavenger::getNextScanCacheFromList(MM_EnvironmentStandard *env)
 {
-	return _scavengeCacheScanList.popCache(env);
+	MM_CopyScanCacheStandard *cache = NULL;
+	MM_CopyScanCacheDeque *deque = getScanCacheDeque(env);
+	if (NULL != deque) {
+		/* own work first (most recently pushed, so likely still in cache), then other threads', then overflow on the shared lists */
+		cache = deque->pop();
+		if (NULL == cache) {
+			cache = stealScanCache(env);
+		}
+	}
+	if ((NULL == cache) && (0 != _cachedEntryCount)) {
+		cache = _scavengeCacheScanList.popCache(env);
+	}
+	return cache;
+}
+
+MM_CopyScanCacheStandard *
+MM_Scavenger::stealScanCache(MM_EnvironmentStandard *env)
+{
+	MM_CopyScanCacheStandard *cache = NULL;
+	uintptr_t workerID = env->getWorkerID();
+	uintptr_t victim = getScanCacheDeque(env)->nextRandom(_scanCacheDequeCount);
+
+	for (uintptr_t i = 0; (NULL == cache) && (i < _scanCacheDequeCount); i++) {
+		if ((victim != workerID) && !_scanCacheDeques[victim].isEmpty()) {
+			cache = _scanCacheDeques[victim].steal();
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_scavengerStats._scanCacheStealAttemptCount += 1;
+			if (NULL == cache) {
+				env->_scavengerStats._scanCacheStealFailCount += 1;
+			} else {
+				env->_scavengerStats._scanCacheStealCount += 1;
+			}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		}
+		victim += 1;
+		if (victim == _scanCacheDequeCount) {
+			victim = 0;
+		}
+	}
+
+	return cache;
+}
+
+bool
+MM_Scavenger::isStealableScanCacheAvailable()
+{
+	for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+		if (!_scanCacheDeques[i].isEmpty()) {
+			return true;
+		}
+	}
+	return false;
 }
 
 /**
@@ -4051,6 +4435,11 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 			while (NULL != (cache = _scavengeCacheScanList.popCache(env))) {
 				flushCache(env, cache);
 			}
+			for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+				while (NULL != (cache = _scanCacheDeques[i].steal())) {
+					flushCache(env, cache);
+				}
+			}
 		}
 		Assert_MM_true(0 == _cachedEntryCount);
 
@@ -4225,6 +4614,8 @@ MM_Scavenger::mainThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_AllocateD
 		if(scavengeCompletedSuccessfully(env)) {
 
 			calculateRecommendedWorkingThreads(env);
+			calculateRecommendedCopyScanCacheSize(env);
+			updatePauseTargetModel(env);
 
 			/* Merge sublists in the remembered set (if necessary) */
 			_extensions->rememberedSet.compact(env);
@@ -4240,7 +4631,10 @@ MM_Scavenger::mainThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_AllocateD
 			/* Defer to collector language interface */
 			_delegate.mainThreadGarbageCollect_scavengeSuccess(env);
 
-			if(_extensions->scvTenureStrategyAdaptive) {
+			if(_extensions->scvTenureStrategyAdaptive && (0.0 != _extensions->scvTenureAdaptiveSurvivorOccupancy)) {
+				/* Pick the tenure age from the survivor age distribution of this scavenge */
+				_extensions->scvTenureAdaptiveTenureAge = calculateTenureAgeUsingOccupancy(_extensions->scvTenureAdaptiveSurvivorOccupancy);
+			} else if(_extensions->scvTenureStrategyAdaptive) {
 				/* Adjust the tenure age based on the percentage of new space used.  Also, avoid / by 0 */
 				uintptr_t newSpaceTotalSize = _activeSubSpace->getMemorySubSpaceAllocate()->getActiveMemorySize();
 				uintptr_t newSpaceConsumedSize = _extensions->scavengerStats._flipBytes;
@@ -5130,6 +5524,44 @@ MM_Scavenger::calculateTenureMaskUsingFixed(uintptr_t tenureAge)
 	return mask;
 }
 
+uintptr_t
+MM_Scavenger::calculateTenureAgeUsingOccupancy(double targetOccupancy)
+{
+	Assert_MM_true(0.0 <= targetOccupancy);
+	Assert_MM_true(1.0 >= targetOccupancy);
+
+	MM_ScavengerStats *stats = &_extensions->scavengerStats;
+	MM_ScavengerStats::FlipHistory *current = stats->getFlipHistory(0);
+	MM_ScavengerStats::FlipHistory *previous = stats->getFlipHistory(1);
+
+	/* Called after the flip, so survivor space is the copy destination of the next scavenge */
+	double targetBytes = (double)_activeSubSpace->getMemorySubSpaceSurvivor()->getActiveMemorySize() * targetOccupancy;
+
+	/* Objects surviving their first scavenge are always copied to survivor space. Assume the next scavenge sees as many as this one did. */
+	double projectedBytes = (double)current->_flipBytes[1];
+
+	/* Keep each age in survivor space, in order, for as long as the projected occupancy fits.
+	 * The first age that does not fit (and all older ones) will be tenured.
+	 */
+	uintptr_t tenureAge = OBJECT_HEADER_AGE_MIN;
+	while (tenureAge < OBJECT_HEADER_AGE_MAX) {
+		/* Survival rate of this age over the last scavenge, assume everything survives if there is no history */
+		double survivalRate = 1.0;
+		uintptr_t previousBytes = previous->_flipBytes[tenureAge];
+		if (0 != previousBytes) {
+			uintptr_t survivedBytes = current->_flipBytes[tenureAge + 1] + current->_tenureBytes[tenureAge + 1];
+			survivalRate = OMR_MIN(1.0, (double)survivedBytes / (double)previousBytes);
+		}
+		projectedBytes += (double)current->_flipBytes[tenureAge] * survivalRate;
+		if (projectedBytes > targetBytes) {
+			break;
+		}
+		tenureAge += 1;
+	}
+
+	return tenureAge;
+}
+
 void
 MM_Scavenger::resetTenureLargeAllocateStats(MM_EnvironmentBase *env)
 {
@@ -34,6 +34,7 @@
 #include "CollectionStatisticsStandard.hpp"
 #include "Collector.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
+#include "CopyScanCacheDeque.hpp"
 #include "CopyScanCacheList.hpp"
 #include "CopyScanCacheStandard.hpp"
 #include "CycleState.hpp"
@@ -89,6 +90,11 @@ private:
 
 	void *_evacuateSpaceBase, *_evacuateSpaceTop;	/**< cached base and top heap pointers within evacuate subspace */
 	void *_survivorSpaceBase, *_survivorSpaceTop;	/**< cached base and top heap pointers within survivor subspace */
+	uintptr_t _numaSurvivorStripeSize; /**< size of the stripes survivor space is bound to NUMA nodes in for this scavenge, or 0 if it is not bound */
+	J9MemoryNodeDetail const *_numaSurvivorNodes; /**< the nodes the survivor stripes are bound to, in address order */
+	uintptr_t _numaSurvivorNodeCount; /**< number of elements in _numaSurvivorNodes */
+	void *_numaBoundSurvivorBase[2]; /**< the last two survivor ranges (one per semispace) whose stripes are bound, so they are not rebound every scavenge */
+	void *_numaBoundSurvivorTop[2];
 
 	uintptr_t _tenureMask; /**< A bit mask indicating which generations should be tenured on scavenge. */
 	bool _expandFailed;
@@ -101,6 +107,13 @@ private:
 	uintptr_t _minTenureFailureSize;
 	uintptr_t _minSemiSpaceFailureSize;
 	uintptr_t _recommendedThreads; /** Number of threads recommended to the dispatcher for the Scavenge task */
+	uintptr_t _copyScanCacheSizeTarget; /**< Upper bound on copy/scan cache sizes recommended for the next Scavenge by the adaptive cache size controller (0 until first set) */
+	uintptr_t _pauseTargetThreads; /**< Number of threads the pause target allows for the current Scavenge, UDATA_MAX if unconstrained */
+	uintptr_t _pauseTargetEvacuateBytes; /**< Bytes in use in the evacuate space when the thread count for the current Scavenge was chosen */
+	float _pauseTargetSurvivalRate; /**< Average fraction of the evacuate space bytes a Scavenge copies (0 until the first sample) */
+	float _pauseTargetThroughput; /**< Average bytes of work a GC thread completes per busy millisecond (0 until the first sample) */
+	float _pauseTargetEfficiency; /**< Average fraction of GC thread time not spent stalled, the observed scaling efficiency */
+	uintptr_t _previousScanStallPercent; /**< Percentage of GC thread time stalled for scan work in the last completed Scavenge */
 
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the main cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics;  /** Common collect stats (memory, time etc.) */
@@ -108,6 +121,8 @@ private:
 	MM_CopyScanCacheList _scavengeCacheFreeList; /**< pool of unused copy-scan caches */
 	MM_CopyScanCacheList _scavengeCacheScanList; /**< scan lists */
 	volatile uintptr_t _cachedEntryCount; /**< non-empty scanCacheList count (not the total count of caches in the lists) */
+	MM_CopyScanCacheDeque *_scanCacheDeques; /**< per GC thread work-stealing scan deques, indexed by worker ID (NULL unless scavengerWorkStealing is set) */
+	uintptr_t _scanCacheDequeCount; /**< number of entries in _scanCacheDeques */
 	uintptr_t _cachesPerThread; /**< maximum number of copy and scan caches required per thread at any one time */
 	omrthread_monitor_t _scanCacheMonitor; /**< monitor to synchronize threads on scan lists */
 	omrthread_monitor_t _freeCacheMonitor; /**< monitor to synchronize threads on free list */
@@ -345,7 +360,25 @@ public:
 	void deepScanOutline(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t priorityFieldOffset1, uintptr_t priorityFieldOffset2);
 
 	MMINLINE bool scavengeRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+
+	/**
+	 * @return true if the remembered set list is claimed by GC threads in chunks of
+	 * scavengerRememberedSetChunkSize entries, rather than a puddle at a time
+	 */
+	MMINLINE bool
+	isRememberedSetChunked()
+	{
+		return (0 != _extensions->scavengerRememberedSetChunkSize) && !_extensions->isConcurrentScavengerEnabled();
+	}
+
+	/**
+	 * Scavenge the slots of the object in a remembered set entry, flagging the entry for removal
+	 * by pruneRememberedSetList() if the object no longer needs to be remembered.
+	 * @param slotPtr[in] the remembered set entry, holding a non-NULL object
+	 */
+	MMINLINE void scavengeRememberedSetEntry(MM_EnvironmentStandard *env, omrobjectptr_t *slotPtr);
 	void scavengeRememberedSetList(MM_EnvironmentStandard *env);
+	void scavengeRememberedSetListChunked(MM_EnvironmentStandard *env);
 	void scavengeRememberedSetOverflow(MM_EnvironmentStandard *env);
 	MMINLINE void flushRememberedSet(MM_EnvironmentStandard *env);
 	void pruneRememberedSetList(MM_EnvironmentStandard *env);
@@ -415,6 +448,39 @@ public:
 	MMINLINE uintptr_t copyCacheDistanceMetric(MM_CopyScanCacheStandard* cache);
 
 	MMINLINE MM_CopyScanCacheStandard *getNextScanCacheFromList(MM_EnvironmentStandard *env);
+
+	/**
+	 * @return the work-stealing scan deque owned by the thread, or NULL if the thread has none
+	 */
+	MMINLINE MM_CopyScanCacheDeque *
+	getScanCacheDeque(MM_EnvironmentStandard *env)
+	{
+		MM_CopyScanCacheDeque *deque = NULL;
+		if ((NULL != _scanCacheDeques) && (env->getWorkerID() < _scanCacheDequeCount)) {
+			deque = &_scanCacheDeques[env->getWorkerID()];
+		}
+		return deque;
+	}
+
+	/**
+	 * Try to steal a scan cache from the deques of other GC threads, starting at a random victim.
+	 * @return the stolen cache, or NULL if none could be taken
+	 */
+	MM_CopyScanCacheStandard *stealScanCache(MM_EnvironmentStandard *env);
+
+	/**
+	 * @return true if any of the work-stealing scan deques appears to hold caches
+	 */
+	bool isStealableScanCacheAvailable();
+
+	/**
+	 * @return true if there appear to be scan caches available on the shared scan lists or in any thread's deque
+	 */
+	MMINLINE bool
+	isScanCacheAvailable()
+	{
+		return (0 != _cachedEntryCount) || ((NULL != _scanCacheDeques) && isStealableScanCacheAvailable());
+	}
 	/**
 	 * Called at the end of a task to return empty caches to the global free pool
 	 */
@@ -578,6 +644,43 @@ public:
 	 */
 	void calculateRecommendedWorkingThreads(MM_EnvironmentStandard *env);
 
+	/**
+	 * The implementation of adaptive copy/scan cache sizing. This routine is called at the end
+	 * of each successful scavenge to pick the upper bound on cache sizes for the subsequent cycle.
+	 * Caches shrink while GC threads stall waiting for scan work above the configured threshold,
+	 * in proportion to the copy/scan ratio recorded by MM_ScavengerCopyScanRatio over the cycle,
+	 * and grow back while stalling is well below the threshold.
+	 * This function sets _copyScanCacheSizeTarget, from which each thread's cache size bound is
+	 * derived in workerSetupForGC().
+	 */
+	void calculateRecommendedCopyScanCacheSize(MM_EnvironmentStandard *env);
+
+	/**
+	 * Choose the number of threads for this Scavenge so that its expected work, projected from the bytes
+	 * in use in the evacuate space, the survival rate and the remembered set size, completes within the
+	 * -Xgc:scavengerPauseTarget= at the throughput and scaling efficiency observed in previous cycles.
+	 * Threads beyond that count are not woken for the Scavenge task. Like the adaptive thread recommendation,
+	 * this is not applied if the thread count was forced (e.g. -Xgcthreads) or adaptive threading is disabled.
+	 * This function sets _pauseTargetThreads.
+	 * @param evacuateBytes[in] bytes in use in the evacuate space
+	 */
+	void calculatePauseTargetThreads(MM_EnvironmentStandard *env, uintptr_t evacuateBytes);
+
+	/**
+	 * Fold the survival rate, per thread throughput and scaling efficiency of a successful Scavenge
+	 * into the history used by calculatePauseTargetThreads().
+	 */
+	void updatePauseTargetModel(MM_EnvironmentStandard *env);
+
+	/**
+	 * With -Xgc:scavengerNumaAwareCopy, bind survivor space in equal, page aligned stripes, one per affinity
+	 * leader node, before this scavenge copies into it. Copy caches are tagged with the node of the stripe
+	 * they start in (see getSurvivorNumaNode()). This is done once per scavenge by the main thread, and the
+	 * system call is skipped if the range is still bound from an earlier scavenge. Only the memory policy is
+	 * set: pages which are already resident stay where they are.
+	 */
+	void bindSurvivorToNumaNodes(MM_EnvironmentStandard *env);
+
 	void scavenge(MM_EnvironmentBase *env);
 	bool scavengeCompletedSuccessfully(MM_EnvironmentStandard *env);
 	virtual	void mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool initMarkMap = false, bool rebuildMarkBits = false);
@@ -626,6 +729,15 @@ public:
 	 */
 	uintptr_t calculateTenureMaskUsingFixed(uintptr_t tenureAge);
 
+	/**
+	 * Calculates the tenure age for the Adaptive strategy which keeps the projected occupancy of survivor
+	 * space in the next scavenge below the given fraction of its size. Uses the survivor ages of the scavenge
+	 * that just completed, with the survival rate of each age taken from the flip history.
+	 * @param targetOccupancy The fraction (from 0.0 to 1.0) of survivor space that should be occupied.
+	 * @return The tenure age for the next scavenge.
+	 */
+	uintptr_t calculateTenureAgeUsingOccupancy(double targetOccupancy);
+
 	/**
 	 * Calculates which generations should be tenured in the form of a bit mask.
 	 * @return mask of ages to tenure
@@ -826,6 +938,20 @@ public:
 		return _survivorSpaceTop;
 	}
 
+	/**
+	 * @return the NUMA node (1 is the first node) the survivor stripe containing the address is bound to, or 0 if survivor space is not bound
+	 */
+	MMINLINE uintptr_t
+	getSurvivorNumaNode(void *address)
+	{
+		uintptr_t numaNode = 0;
+		if (0 != _numaSurvivorStripeSize) {
+			uintptr_t stripe = ((uintptr_t)address - (uintptr_t)_survivorSpaceBase) / _numaSurvivorStripeSize;
+			numaNode = _numaSurvivorNodes[OMR_MIN(stripe, _numaSurvivorNodeCount - 1)].j9NodeNumber;
+		}
+		return numaNode;
+	}
+
 	void workThreadGarbageCollect(MM_EnvironmentStandard *env);
 
 	void scavengeRememberedSet(MM_EnvironmentStandard *env);
@@ -912,6 +1038,9 @@ public:
 		, _evacuateSpaceTop(NULL)
 		, _survivorSpaceBase(NULL)
 		, _survivorSpaceTop(NULL)
+		, _numaSurvivorStripeSize(0)
+		, _numaSurvivorNodes(NULL)
+		, _numaSurvivorNodeCount(0)
 		, _tenureMask(0)
 		, _expandFailed(false)
 		, _failedTenureThresholdReached(false)
@@ -920,9 +1049,18 @@ public:
 		, _minTenureFailureSize(UDATA_MAX)
 		, _minSemiSpaceFailureSize(UDATA_MAX)
 		, _recommendedThreads(UDATA_MAX)
+		, _copyScanCacheSizeTarget(0)
+		, _pauseTargetThreads(UDATA_MAX)
+		, _pauseTargetEvacuateBytes(0)
+		, _pauseTargetSurvivalRate(0)
+		, _pauseTargetThroughput(0)
+		, _pauseTargetEfficiency(0)
+		, _previousScanStallPercent(0)
 		, _cycleState()
 		, _collectionStatistics()
 		, _cachedEntryCount(0)
+		, _scanCacheDeques(NULL)
+		, _scanCacheDequeCount(0)
 		, _cachesPerThread(0)
 		, _scanCacheMonitor(NULL)
 		, _freeCacheMonitor(NULL)
@@ -949,6 +1087,10 @@ public:
 	{
 		_typeId = __FUNCTION__;
 		_cycleType = OMR_GC_CYCLE_TYPE_SCAVENGE;
+		_numaBoundSurvivorBase[0] = NULL;
+		_numaBoundSurvivorBase[1] = NULL;
+		_numaBoundSurvivorTop[0] = NULL;
+		_numaBoundSurvivorTop[1] = NULL;
 	}
 };
 
@@ -42,6 +42,9 @@ omrobjectptr_t OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, uintptr_t alloc
 
 omr_error_t OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode);
 
+/* Pre-store barrier: must be called with the reference about to be overwritten before any object slot is stored into */
+void OMR_GC_PreObjectStore(OMR_VMThread* omrVMThread, omrobjectptr_t overwrittenObject);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
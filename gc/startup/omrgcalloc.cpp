@@ -29,6 +29,9 @@
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
 #include "omrgcstartup.hpp"
+#if defined(OMR_GC_REALTIME)
+#include "RememberedSetSATB.hpp"
+#endif /* defined(OMR_GC_REALTIME) */
 #include "ModronAssertions.h"
 
 omrobjectptr_t
@@ -60,3 +63,15 @@ OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode)
 	}
 	return result;
 }
+
+void
+OMR_GC_PreObjectStore(OMR_VMThread* omrVMThread, omrobjectptr_t overwrittenObject)
+{
+#if defined(OMR_GC_REALTIME)
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_RememberedSetSATB *rememberedSet = env->getExtensions()->sATBBarrierRememberedSet;
+	if (NULL != rememberedSet) {
+		rememberedSet->preObjectStore(env, overwrittenObject);
+	}
+#endif /* defined(OMR_GC_REALTIME) */
+}
@@ -63,11 +63,6 @@ collectorCreationHelper(OMR_VM *omrVM, MM_EnvironmentBase *env)
 	} else {
 		globalCollector->setGlobalCollector(true);
 		extensions->setGlobalCollector(globalCollector);
-
-		if (!extensions->getGlobalCollector()->collectorStartup(extensions)) {
-			omrtty_printf("Failed to start global collector.\n");
-			rc = OMR_ERROR_INTERNAL;
-		}
 	}
 
 	return rc;
@@ -179,6 +174,13 @@ heapCreationHelper(OMR_VM *omrVM, MM_StartupManager *startupManager, bool create
 	extensions->configuration->defaultMemorySpaceAllocated(extensions, memorySpace);
 	extensions->heap->setDefaultMemorySpace(memorySpace);
 
+	/* Collector threads attach to the VM, which requires the default memory space to be in place. */
+	if (createCollector && !extensions->getGlobalCollector()->collectorStartup(extensions)) {
+		omrtty_printf("Failed to start global collector.\n");
+		rc = OMR_ERROR_INTERNAL;
+		goto done;
+	}
+
 	if (startupManager->isVerboseEnabled()) {
 		extensions->verboseGCManager = startupManager->createVerboseManager(&envBase);
 		if (NULL == extensions->verboseGCManager) {
@@ -283,6 +285,10 @@ OMR_GC_InitializeCollector(OMR_VMThread* omrVMThread)
 
 			/* Make sure sweep scheme is up-to-date with the heap configuration */
 			globalCollector->heapReconfigured(env, HEAP_RECONFIG_EXPAND, NULL, NULL, NULL);
+
+			if (!globalCollector->collectorStartup(extensions)) {
+				rc = OMR_ERROR_INTERNAL;
+			}
 		}
 	}
 
@@ -34,6 +34,7 @@ MM_AllocationStats::clear()
 	_tlhAllocatedReused = 0;
 	_tlhRequestedBytes = 0;
 	_tlhDiscardedBytes = 0;
+	_tlhFlushedBytes = 0;
 	_tlhMaxAbandonedListSize = 0;
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
@@ -58,6 +59,7 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 	MM_AtomicOperations::add(&_tlhAllocatedUsed, stats->_tlhAllocatedUsed);
 	MM_AtomicOperations::add(&_tlhRequestedBytes, stats->_tlhRequestedBytes);
 	MM_AtomicOperations::add(&_tlhDiscardedBytes, stats->_tlhDiscardedBytes);
+	MM_AtomicOperations::add(&_tlhFlushedBytes, stats->_tlhFlushedBytes);
 	MM_AtomicOperations::add(&_tlhAllocatedReused, stats->_tlhAllocatedReused);
 	/* looping to set a maximum value in _tlhMaxAbandonedListSize */
 	for (
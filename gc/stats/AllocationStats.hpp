@@ -41,6 +41,7 @@ public:
 	uintptr_t _tlhAllocatedReused; 		/**< The amount of memory allocated form reused TLHs. */
 	uintptr_t _tlhRequestedBytes; 		/**< The amount of memory requested for refreshes. */
 	uintptr_t _tlhDiscardedBytes; 		/**< The amount of memory from discarded TLHs. */
+	uintptr_t _tlhFlushedBytes; 		/**< The amount of memory left unused in TLHs (and their abandoned lists) flushed for a GC. */
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
@@ -93,6 +94,7 @@ public:
 		_tlhAllocatedReused(0),
 		_tlhRequestedBytes(0),
 		_tlhDiscardedBytes(0),
+		_tlhFlushedBytes(0),
 		_tlhMaxAbandonedListSize(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 		_arrayletLeafAllocationCount(0),
@@ -52,6 +52,8 @@ public:
 	uintptr_t _fixupObjects;
 	uint64_t _setupStartTime;
 	uint64_t _setupEndTime;
+	uint64_t _summaryStartTime; /**< Start of building the summary table, when compacting using one */
+	uint64_t _summaryEndTime; /**< End of building the summary table, when compacting using one */
 	uint64_t _moveStartTime;
 	uint64_t _moveEndTime;
 	uint64_t _fixupStartTime;
@@ -75,6 +75,15 @@ class MM_ConcurrentGCStats : public MM_Base
 	
 	ConcurrentKickoffReason _kickoffReason; /**< a constant indicating why kickoff occured */
 	ConcurrentCardCleaningReason _cardCleaningReason; /**< a constant indicating why card cleaning was kicked off */
+
+	/* The following statistics describe the last forecast kickoff, and are only set when kickoff is forecast */
+	uintptr_t _forecastAllocationRate; /**< forecast allocation rate at kickoff, in bytes per millisecond */
+	bool _forecastAllocationBurst; /**< true if the forecast allocation rate was raised by a detected allocation burst */
+	uintptr_t _forecastHelperTraceRate; /**< forecast concurrent helper trace rate at kickoff, in bytes per millisecond */
+	uint64_t _predictedConcurrentTime; /**< predicted time from kickoff to completion of concurrent mark, in microseconds */
+	uintptr_t _predictedFreeAtCompletion; /**< predicted free bytes when concurrent mark completes */
+	uint64_t _actualConcurrentTime; /**< measured time from kickoff to the final collection, in microseconds */
+	uintptr_t _actualFreeAtCompletion; /**< free bytes last seen by allocation tax before the final collection */
 	
 public:
 	static const char* getConcurrentStatusString(MM_EnvironmentBase *env, uintptr_t status, char *statusBuffer, uintptr_t statusBufferLength);
@@ -202,7 +211,7 @@ public:
 	MMINLINE void incThreadsScannedCount() { incrementCount((uintptr_t*)&_threadsScannedCount, 1); };
 	MMINLINE uintptr_t getThreadsScannedCount() { return _threadsScannedCount; };
 	
-	MMINLINE bool isRootTracingComplete() { return (_completedModes & CONCURRENT_ROOT_TRACING) == CONCURRENT_ROOT_TRACING; };
+	MMINLINE bool isRootTracingComplete() { return 0 != (_completedModes & ((uint32_t)1 << CONCURRENT_ROOT_TRACING)); };
 	MMINLINE void setModeComplete(ConcurrentStatus mode) {
 		uint32_t mask = (uint32_t)1 << mode;
 		uint32_t currentValue = _completedModes;
@@ -213,6 +222,29 @@ public:
 	
 	MMINLINE void setCardCleaningReason(ConcurrentCardCleaningReason reason) { _cardCleaningReason = reason; };
 	MMINLINE ConcurrentCardCleaningReason getCardCleaningReason() { return _cardCleaningReason; };
+
+	MMINLINE void setKickoffForecast(uintptr_t allocationRate, bool allocationBurst, uintptr_t helperTraceRate, uint64_t predictedTime, uintptr_t predictedFree)
+	{
+		_forecastAllocationRate = allocationRate;
+		_forecastAllocationBurst = allocationBurst;
+		_forecastHelperTraceRate = helperTraceRate;
+		_predictedConcurrentTime = predictedTime;
+		_predictedFreeAtCompletion = predictedFree;
+		_actualConcurrentTime = 0;
+		_actualFreeAtCompletion = 0;
+	}
+	MMINLINE void setKickoffForecastOutcome(uint64_t actualTime, uintptr_t actualFree)
+	{
+		_actualConcurrentTime = actualTime;
+		_actualFreeAtCompletion = actualFree;
+	}
+	MMINLINE uintptr_t getForecastAllocationRate() { return _forecastAllocationRate; };
+	MMINLINE bool getForecastAllocationBurst() { return _forecastAllocationBurst; };
+	MMINLINE uintptr_t getForecastHelperTraceRate() { return _forecastHelperTraceRate; };
+	MMINLINE uint64_t getPredictedConcurrentTime() { return _predictedConcurrentTime; };
+	MMINLINE uintptr_t getPredictedFreeAtCompletion() { return _predictedFreeAtCompletion; };
+	MMINLINE uint64_t getActualConcurrentTime() { return _actualConcurrentTime; };
+	MMINLINE uintptr_t getActualFreeAtCompletion() { return _actualFreeAtCompletion; };
 	
 	MMINLINE void reset()
 	{
@@ -264,7 +296,14 @@ public:
 		_concurrentWorkStackOverflowCount(0),
 		_completedModes(0),
 		_kickoffReason(NO_KICKOFF_REASON),
-		_cardCleaningReason(CARD_CLEANING_REASON_NONE)
+		_cardCleaningReason(CARD_CLEANING_REASON_NONE),
+		_forecastAllocationRate(0),
+		_forecastAllocationBurst(false),
+		_forecastHelperTraceRate(0),
+		_predictedConcurrentTime(0),
+		_predictedFreeAtCompletion(0),
+		_actualConcurrentTime(0),
+		_actualFreeAtCompletion(0)
 	{}
 
 };
@@ -71,6 +71,16 @@ private:
 	uint64_t 				_ticksOutsideGC[RATIO_RESIZE_HISTORIES];
 	bool					_excludeCurrentGCTimeFromStats;
 
+	uint64_t				_commitTime; /**< total time in hi-res ticks spent committing heap memory */
+	uint64_t				_decommitTime; /**< total time in hi-res ticks spent decommitting or queueing contracted heap memory */
+	uint64_t				_backgroundDecommitTime; /**< total time in hi-res ticks the background thread spent decommitting */
+	uint64_t				_backgroundPrecommitTime; /**< total time in hi-res ticks the background thread spent committing and pre-faulting */
+	uintptr_t				_deferredDecommitBytes; /**< bytes of contracted memory queued for the background thread */
+	uintptr_t				_backgroundDecommitBytes; /**< bytes decommitted by the background thread */
+	uintptr_t				_precommitBytes; /**< bytes committed and pre-faulted ahead of expansion */
+	uintptr_t				_precommitHitBytes; /**< bytes of expansion found already pre-faulted */
+	uint64_t				_rssReduction; /**< drop in resident set size measured across background decommits */
+
 protected:
 public:
 
@@ -179,6 +189,25 @@ public:
 	MMINLINE void setExcludeCurrentGCTimeFromStats() { _excludeCurrentGCTimeFromStats = TRUE; }
 	MMINLINE bool getExcludeCurrentGCTimeFromStats() { return _excludeCurrentGCTimeFromStats; }
 
+	MMINLINE void addCommitTime(uint64_t ticks) { _commitTime += ticks; }
+	MMINLINE uint64_t getCommitTime() { return _commitTime; }
+	MMINLINE void addDecommitTime(uint64_t ticks) { _decommitTime += ticks; }
+	MMINLINE uint64_t getDecommitTime() { return _decommitTime; }
+	MMINLINE void addBackgroundDecommitTime(uint64_t ticks) { _backgroundDecommitTime += ticks; }
+	MMINLINE uint64_t getBackgroundDecommitTime() { return _backgroundDecommitTime; }
+	MMINLINE void addBackgroundPrecommitTime(uint64_t ticks) { _backgroundPrecommitTime += ticks; }
+	MMINLINE uint64_t getBackgroundPrecommitTime() { return _backgroundPrecommitTime; }
+	MMINLINE void addDeferredDecommitBytes(uintptr_t bytes) { _deferredDecommitBytes += bytes; }
+	MMINLINE uintptr_t getDeferredDecommitBytes() { return _deferredDecommitBytes; }
+	MMINLINE void addBackgroundDecommitBytes(uintptr_t bytes) { _backgroundDecommitBytes += bytes; }
+	MMINLINE uintptr_t getBackgroundDecommitBytes() { return _backgroundDecommitBytes; }
+	MMINLINE void addPrecommitBytes(uintptr_t bytes) { _precommitBytes += bytes; }
+	MMINLINE uintptr_t getPrecommitBytes() { return _precommitBytes; }
+	MMINLINE void addPrecommitHitBytes(uintptr_t bytes) { _precommitHitBytes += bytes; }
+	MMINLINE uintptr_t getPrecommitHitBytes() { return _precommitHitBytes; }
+	MMINLINE void addRSSReduction(uint64_t bytes) { _rssReduction += bytes; }
+	MMINLINE uint64_t getRSSReduction() { return _rssReduction; }
+
 	MM_HeapResizeStats() :
 		MM_Base(),
 		_lastAFEndTime(0),
@@ -196,7 +225,16 @@ public:
 		_lastGCPercentage(0),
 		_lastTimeOutsideGC(0),
 		_globalGCCountAtAF(0),
-		_excludeCurrentGCTimeFromStats(true)
+		_excludeCurrentGCTimeFromStats(true),
+		_commitTime(0),
+		_decommitTime(0),
+		_backgroundDecommitTime(0),
+		_backgroundPrecommitTime(0),
+		_deferredDecommitBytes(0),
+		_backgroundDecommitBytes(0),
+		_precommitBytes(0),
+		_precommitHitBytes(0),
+		_rssReduction(0)
 	{
 		resetRatioTicks();
 	}
@@ -52,6 +52,9 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_releaseFreeListCount(0)
 	,_acquireScanListCount(0)
 	,_acquireListLockCount(0)
+	,_scanCacheStealAttemptCount(0)
+	,_scanCacheStealCount(0)
+	,_scanCacheStealFailCount(0)
 	,_aliasToCopyCacheCount(0)
 	,_arraySplitCount(0)
 	,_arraySplitAmount(0)
@@ -74,6 +77,15 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_avgTenureBytes(0)
 	,_avgTenureBytesDeviation(0)
 	,_tiltRatio(0)
+	,_copyScanCacheSizeTarget(0)
+	,_scanStallPercent(0)
+	,_previousScanStallPercent(0)
+	,_pauseTargetExpectedBytes(0)
+	,_pauseTargetThreads(0)
+	,_rememberedSetEntryCount(0)
+	,_rememberedSetChunkCount(0)
+	,_rememberedSetScanTime(0)
+	,_rememberedSetPruneTime(0)
 	,_nextScavengeWillPercolate(false)
 #if defined(OMR_GC_LARGE_OBJECT_AREA)	
 	,_avgTenureLOABytes(0)
@@ -104,6 +116,9 @@ MM_ScavengerStats::MM_ScavengerStats()
 	memset(_flipHistory, 0, sizeof(_flipHistory));
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
+	memset(_numaPreferredCopyCount, 0, sizeof(_numaPreferredCopyCount));
+	memset(_numaOtherCopyCount, 0, sizeof(_numaOtherCopyCount));
+	memset(_ageSizeHistogram, 0, sizeof(_ageSizeHistogram));
 }
 
 struct MM_ScavengerStats::FlipHistory*
@@ -164,6 +179,9 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_releaseFreeListCount = 0;
 	_acquireScanListCount = 0;
 	_acquireListLockCount = 0;
+	_scanCacheStealAttemptCount = 0;
+	_scanCacheStealCount = 0;
+	_scanCacheStealFailCount = 0;
 	_aliasToCopyCacheCount = 0;
 	_arraySplitCount = 0;
 	_arraySplitAmount = 0;
@@ -196,6 +214,11 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_tenureExpandedCount = 0;
 	_tenureExpandedTime = 0;
 
+	_rememberedSetEntryCount = 0;
+	_rememberedSetChunkCount = 0;
+	_rememberedSetScanTime = 0;
+	_rememberedSetPruneTime = 0;
+
 	_slotsCopied = 0;
 	_slotsScanned = 0;
 
@@ -213,6 +236,9 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_copy_cachesize_sum = 0;
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
+	memset(_numaPreferredCopyCount, 0, sizeof(_numaPreferredCopyCount));
+	memset(_numaOtherCopyCount, 0, sizeof(_numaOtherCopyCount));
+	memset(_ageSizeHistogram, 0, sizeof(_ageSizeHistogram));
 }
 
 bool
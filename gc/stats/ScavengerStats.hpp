@@ -36,6 +36,9 @@ class MM_EnvironmentBase;
 
 #define OMR_SCAVENGER_DISTANCE_BINS 32
 #define OMR_SCAVENGER_CACHESIZE_BINS 16
+#define OMR_SCAVENGER_NUMA_NODE_BINS 16
+#define OMR_SCAVENGER_AGE_SIZE_BINS 8
+#define OMR_SCAVENGER_AGE_SIZE_BIN_SHIFT 4
 
 #define SCAVENGER_FLIP_HISTORY_SIZE 16
 
@@ -84,6 +87,9 @@ public:
 	uintptr_t _releaseFreeListCount;
 	uintptr_t _acquireScanListCount;
 	uintptr_t _acquireListLockCount;  /**< cumulative (for scan&free list) lock count. if this number is much larger than cumulative acquire list count, it indicates over-splitting */
+	uintptr_t _scanCacheStealAttemptCount; /**< number of attempts to steal a scan cache from another thread's deque */
+	uintptr_t _scanCacheStealCount; /**< number of scan caches successfully stolen */
+	uintptr_t _scanCacheStealFailCount; /**< number of steal attempts that found the victim empty or lost the race for its entry */
 	uintptr_t _aliasToCopyCacheCount;
 	uintptr_t _arraySplitCount;
 	uintptr_t _arraySplitAmount;
@@ -119,6 +125,15 @@ public:
 	uintptr_t _avgTenureBytesDeviation; /**< The average, weighted deviation of the tenureBytes*/
 	
 	uintptr_t _tiltRatio;	/**< use to pass tiltRatio to verbose */
+	uintptr_t _copyScanCacheSizeTarget; /**< upper bound on copy/scan cache sizes chosen by the adaptive cache size controller for this cycle */
+	uintptr_t _scanStallPercent; /**< percentage of GC thread time spent stalled waiting for scan work in this cycle */
+	uintptr_t _previousScanStallPercent; /**< _scanStallPercent of the previous cycle, for reporting the effect of the chosen cache sizes */
+	uintptr_t _pauseTargetExpectedBytes; /**< bytes this cycle was expected to copy when its thread count was chosen for the pause target */
+	uintptr_t _pauseTargetThreads; /**< thread count the pause target allowed for this cycle, 0 if it was not constrained */
+	uintptr_t _rememberedSetEntryCount; /**< The number of remembered set entries scanned */
+	uintptr_t _rememberedSetChunkCount; /**< The number of remembered set chunks claimed (0 unless the remembered set is processed in chunks) */
+	uint64_t _rememberedSetScanTime; /**< The time, in hi-res ticks, spent scanning the remembered set list; the longest of any thread once merged */
+	uint64_t _rememberedSetPruneTime; /**< The time, in hi-res ticks, spent pruning the remembered set list; the longest of any thread once merged */
 
 	bool _nextScavengeWillPercolate;
 	
@@ -148,6 +163,10 @@ public:
 	uint64_t _copy_distance_counts[OMR_SCAVENGER_DISTANCE_BINS];
 	uint64_t _copy_cachesize_counts[OMR_SCAVENGER_CACHESIZE_BINS];
 	uint64_t _copy_cachesize_sum;
+	uint64_t _numaPreferredCopyCount[OMR_SCAVENGER_NUMA_NODE_BINS]; /**< Objects copied into survivor memory whose NUMA policy prefers the copying thread's node, indexed by node (0 is the first node). Resident pages are not migrated, so this counts the policy, not where the pages are */
+	uint64_t _numaOtherCopyCount[OMR_SCAVENGER_NUMA_NODE_BINS]; /**< Objects copied into survivor memory whose NUMA policy prefers another node, or none, indexed by node */
+	/* Array size is OBJECT_HEADER_AGE_MAX + 2 to match FlipHistory::_flipBytes */
+	uint64_t _ageSizeHistogram[OBJECT_HEADER_AGE_MAX+2][OMR_SCAVENGER_AGE_SIZE_BINS]; /**< Objects copied into survivor space, indexed by their new age and by size class (size class n holds sizes from 16 << n bytes, the last class holds all larger sizes) */
 
 	uint64_t _slotsCopied; /**< The number of slots copied by the thread since _slotsScanned was last sampled and reset */
 	uint64_t _slotsScanned; /**< The number of slots scanned by the thread since _slotsCopied was last sampled and reset */
@@ -246,6 +265,44 @@ public:
 		_copy_cachesize_sum += copyCacheSize;
 	}
 
+	/**
+	 * Record an object copied into survivor space in the age-by-size histogram.
+	 * @param age[in] the age of the object after the copy
+	 * @param sizeInBytes[in] the size of the copy
+	 */
+	MMINLINE void
+	countAgeSize(uintptr_t age, uintptr_t sizeInBytes)
+	{
+		uintptr_t bin = 0;
+		uintptr_t sizeLog2 = MM_Math::floorLog2(sizeInBytes);
+		if (OMR_SCAVENGER_AGE_SIZE_BIN_SHIFT < sizeLog2) {
+			bin = sizeLog2 - OMR_SCAVENGER_AGE_SIZE_BIN_SHIFT;
+			if (OMR_SCAVENGER_AGE_SIZE_BINS <= bin) {
+				bin = OMR_SCAVENGER_AGE_SIZE_BINS - 1;
+			}
+		}
+		_ageSizeHistogram[age][bin] += 1;
+	}
+
+	/**
+	 * Record an object copy by a thread bound to the given NUMA node.
+	 * @param threadNumaNode[in] the node of the copying thread, where 1 is the first node (must not be 0)
+	 * @param preferred[in] true if the destination memory is bound to the same node
+	 */
+	MMINLINE void
+	countNumaCopy(uintptr_t threadNumaNode, bool preferred)
+	{
+		uintptr_t bin = threadNumaNode - 1;
+		if (OMR_SCAVENGER_NUMA_NODE_BINS <= bin) {
+			bin = OMR_SCAVENGER_NUMA_NODE_BINS - 1;
+		}
+		if (preferred) {
+			_numaPreferredCopyCount[bin] += 1;
+		} else {
+			_numaOtherCopyCount[bin] += 1;
+		}
+	}
+
 	void clear(bool firstIncrement);
 	
 	/**
@@ -44,6 +44,14 @@ MM_SweepStats::clear()
 	mergeTime = 0;
 	sweepChunksProcessed = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */			
+
+	_deferredBytes = 0;
+
+	_backgroundSweepRegions = 0;
+	_backgroundSweptRegions = 0;
+	_mutatorSweptRegions = 0;
+	_unsweptRegions = 0;
+	_sweepLagTime = 0;
 }
 	
 void
@@ -59,6 +67,14 @@ MM_SweepStats::merge(MM_SweepStats *statsToMerge)
 	mergeTime += statsToMerge->mergeTime;
 	sweepChunksProcessed += statsToMerge->sweepChunksProcessed;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+	_deferredBytes += statsToMerge->_deferredBytes;
+
+	_backgroundSweepRegions += statsToMerge->_backgroundSweepRegions;
+	_backgroundSweptRegions += statsToMerge->_backgroundSweptRegions;
+	_mutatorSweptRegions += statsToMerge->_mutatorSweptRegions;
+	_unsweptRegions += statsToMerge->_unsweptRegions;
+	_sweepLagTime = OMR_MAX(_sweepLagTime, statsToMerge->_sweepLagTime);
 }
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
@@ -55,6 +55,14 @@ public:
 	uint64_t _startTime;	/**< Sweep start time */
 	uint64_t _endTime;		/**< Sweep end time */
 
+	uintptr_t _deferredBytes; /**< Heap bytes left unswept at the end of the GC, to be swept on allocation (lazy sweep) */
+
+	uintptr_t _backgroundSweepRegions; /**< Small regions queued for the background sweeper at the end of the GC (segregated heap) */
+	uintptr_t _backgroundSweptRegions; /**< Regions queued by the previous GC that the background sweeper swept */
+	uintptr_t _mutatorSweptRegions; /**< Regions queued by the previous GC that allocating threads swept before the background sweeper got to them */
+	uintptr_t _unsweptRegions; /**< Regions queued by the previous GC that were still unswept when this GC started */
+	uint64_t _sweepLagTime; /**< Microseconds from the end of the previous GC until its queued regions were all swept (or this GC started) */
+
 	void clear();
 	void merge(MM_SweepStats *statsToMerge);
 
@@ -47,6 +47,9 @@ public:
 	uintptr_t workPacketsAcquired;
 	uintptr_t workPacketsReleased;
 	uintptr_t workPacketsExchanged; /**< The number of output packets converted into input packets without being returned to the shared pool first */
+	uintptr_t workPacketsCached; /**< The number of empty packets reused from the thread's packet cache instead of the shared lists */
+	uintptr_t packetListLockAcquires; /**< The number of times a packet list lock was taken */
+	uintptr_t packetListExchangeFailures; /**< The number of times a lock-free packet list update lost a race and was retried */
 	uintptr_t _workStallCount; /**< The number of times the thread stalled, and subsequently received more work */
 	uintptr_t _completeStallCount; /**< The number of times the thread stalled, and waited for all other threads to complete working */
 	uint64_t _workStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting to receive more work */
@@ -58,6 +61,9 @@ private:
 	uintptr_t _stwWorkStackOverflowCount;
 	bool _stwWorkStackOverflowOccured;
 	uintptr_t _stwWorkpacketCountAtOverflow;
+	uintptr_t _stwOverflowSpillCount; /**< The number of overflowed items held in the overflow spill buffers */
+	uintptr_t _stwOverflowMarkCount; /**< The number of overflowed items marked for a heap rescan because a spill buffer was full */
+	uintptr_t _stwOverflowHeapRescanCount; /**< The number of heap rescans done to find overflowed items */
 
 public:
 	void clear()
@@ -65,6 +71,9 @@ public:
 		_stwWorkStackOverflowCount = 0;
 		_stwWorkStackOverflowOccured = false;
 		_stwWorkpacketCountAtOverflow = 0;
+		_stwOverflowSpillCount = 0;
+		_stwOverflowMarkCount = 0;
+		_stwOverflowHeapRescanCount = 0;
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		_workStallCount = 0;
 		_completeStallCount = 0;
@@ -73,6 +82,9 @@ public:
 		workPacketsAcquired = 0;
 		workPacketsReleased = 0;
 		workPacketsExchanged = 0;
+		workPacketsCached = 0;
+		packetListLockAcquires = 0;
+		packetListExchangeFailures = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -81,6 +93,9 @@ public:
 		_stwWorkStackOverflowCount += statsToMerge->_stwWorkStackOverflowCount;
 		_stwWorkStackOverflowOccured = (_stwWorkStackOverflowOccured || statsToMerge->_stwWorkStackOverflowOccured);
 		_stwWorkpacketCountAtOverflow = OMR_MAX(_stwWorkpacketCountAtOverflow, statsToMerge->_stwWorkpacketCountAtOverflow);
+		_stwOverflowSpillCount += statsToMerge->_stwOverflowSpillCount;
+		_stwOverflowMarkCount += statsToMerge->_stwOverflowMarkCount;
+		_stwOverflowHeapRescanCount += statsToMerge->_stwOverflowHeapRescanCount;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		/* It may not ever be useful to merge these stats, but do it anyways */
@@ -91,6 +106,9 @@ public:
 		workPacketsAcquired += statsToMerge->workPacketsAcquired;
 		workPacketsReleased += statsToMerge->workPacketsReleased;
 		workPacketsExchanged += statsToMerge->workPacketsExchanged;
+		workPacketsCached += statsToMerge->workPacketsCached;
+		packetListLockAcquires += statsToMerge->packetListLockAcquires;
+		packetListExchangeFailures += statsToMerge->packetListExchangeFailures;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -141,12 +159,21 @@ public:
 	{
 		MM_AtomicOperations::add(&_stwWorkStackOverflowCount, 1);
 	}
+	MMINLINE uintptr_t getSTWOverflowSpillCount() { return _stwOverflowSpillCount; };
+	MMINLINE void incrementSTWOverflowSpillCount() { _stwOverflowSpillCount += 1; };
+	MMINLINE uintptr_t getSTWOverflowMarkCount() { return _stwOverflowMarkCount; };
+	MMINLINE void incrementSTWOverflowMarkCount() { _stwOverflowMarkCount += 1; };
+	MMINLINE uintptr_t getSTWOverflowHeapRescanCount() { return _stwOverflowHeapRescanCount; };
+	MMINLINE void incrementSTWOverflowHeapRescanCount() { _stwOverflowHeapRescanCount += 1; };
 
 	MM_WorkPacketStats() :
 		_gcCount(UDATA_MAX)
 		,workPacketsAcquired(0)
 		,workPacketsReleased(0)
 		,workPacketsExchanged(0)
+		,workPacketsCached(0)
+		,packetListLockAcquires(0)
+		,packetListExchangeFailures(0)
 		,_workStallCount(0)
 		,_completeStallCount(0)
 		,_workStallTime(0)
@@ -154,6 +181,9 @@ public:
 		,_stwWorkStackOverflowCount(0)
 		,_stwWorkStackOverflowOccured(false)
 		,_stwWorkpacketCountAtOverflow(0)
+		,_stwOverflowSpillCount(0)
+		,_stwOverflowMarkCount(0)
+		,_stwOverflowHeapRescanCount(0)
 	{}
 
 protected:
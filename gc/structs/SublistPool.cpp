@@ -387,6 +387,8 @@ MM_SublistPool::clear(MM_EnvironmentBase *env)
 	_list = NULL;
 	_allocPuddle = NULL;
 	_previousList = NULL;
+	_chunkPuddle = NULL;
+	_chunkLastPuddle = NULL;
 	_count = 0;
 }
 
@@ -452,3 +454,38 @@ MM_SublistPool::popPreviousPuddle(MM_SublistPuddle * returnedPuddle)
 	
 	return result;
 }
+
+void
+MM_SublistPool::startProcessingChunks()
+{
+	/* Puddles past the alloc puddle are guaranteed to be empty */
+	MM_SublistPuddle *puddle = _list;
+	while (NULL != puddle) {
+		puddle->startProcessingChunks();
+		if (puddle == _allocPuddle) {
+			break;
+		}
+		puddle = puddle->getNext();
+	}
+
+	_chunkPuddle = _list;
+	_chunkLastPuddle = _allocPuddle;
+}
+
+bool
+MM_SublistPool::claimChunk(uintptr_t chunkSize, uintptr_t **chunkBase, uintptr_t **chunkTop)
+{
+	MM_SublistPuddle *puddle = _chunkPuddle;
+	while (NULL != puddle) {
+		if (puddle->claimChunk(chunkSize, chunkBase, chunkTop)) {
+			return true;
+		}
+
+		/* This puddle is exhausted, move all threads on to the next one */
+		MM_SublistPuddle *nextPuddle = (puddle == _chunkLastPuddle) ? NULL : puddle->getNext();
+		MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_chunkPuddle, (uintptr_t)puddle, (uintptr_t)nextPuddle);
+		puddle = _chunkPuddle;
+	}
+
+	return false;
+}
@@ -65,6 +65,8 @@ private:
 	OMR::GC::AllocationCategory::Enum _allocCategory;
 	
 	MM_SublistPuddle *_previousList; /**< A list of the non-empty puddles when #startProcessingSublist() was called */
+	MM_SublistPuddle * volatile _chunkPuddle; /**< The puddle #claimChunk() is currently handing out chunks from */
+	MM_SublistPuddle *_chunkLastPuddle; /**< The last puddle that may hold elements when #startProcessingChunks() was called */
 	
 protected:
 public:
@@ -125,6 +127,26 @@ public:
 	 * @return a puddle to process, or NULL if the list is empty
 	 */
 	MM_SublistPuddle *popPreviousPuddle(MM_SublistPuddle * returnedPuddle);
+
+	/**
+	 * Prepare to process this sublist in fixed size chunks claimed by #claimChunk(). Unlike
+	 * #startProcessingSublist() the puddles stay on the list; elements added afterwards are not handed out.
+	 * Must not be called concurrently with other operations on the sublist.
+	 */
+	void startProcessingChunks();
+
+	/**
+	 * Claim the next chunk of elements that were in the sublist when #startProcessingChunks() was called.
+	 * This is lock free, so may safely be called by multiple threads. Elements must not be removed from
+	 * the sublist until all chunks have been processed, as a chunk may share a puddle with chunks claimed
+	 * by other threads.
+	 *
+	 * @param chunkSize[in] the maximum number of elements to claim
+	 * @param chunkBase[out] the first element claimed
+	 * @param chunkTop[out] the end of the elements claimed
+	 * @return true if a chunk was claimed, false if all elements have been handed out
+	 */
+	bool claimChunk(uintptr_t chunkSize, uintptr_t **chunkBase, uintptr_t **chunkTop);
 	
 	MM_SublistPool() 
 		: _list(NULL)
@@ -136,6 +158,8 @@ public:
 		, _count(0)
 		, _allocCategory(OMR::GC::AllocationCategory::OTHER)
 		, _previousList(NULL)
+		, _chunkPuddle(NULL)
+		, _chunkLastPuddle(NULL)
 	{}
 
 	friend class GC_SublistIterator;
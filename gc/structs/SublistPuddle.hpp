@@ -60,6 +60,9 @@ private:
 	uintptr_t * volatile _listCurrent;
 	uintptr_t *_listTop;
 
+	uintptr_t * volatile _chunkCurrent; /**< next element to be handed out by #claimChunk() */
+	uintptr_t *_chunkTop; /**< end of the elements present when chunk processing started */
+
 	uintptr_t _size;
 
 protected:
@@ -91,6 +94,41 @@ public:
 
 	void merge(MM_SublistPuddle *sourcePuddle);
 
+	/**
+	 * Prepare to hand out the elements currently in the puddle in chunks.
+	 * Elements added afterwards are not handed out.
+	 */
+	MMINLINE void
+	startProcessingChunks()
+	{
+		_chunkCurrent = _listBase;
+		_chunkTop = _listCurrent;
+	}
+
+	/**
+	 * Claim the next chunk of elements. This may safely be called by multiple threads.
+	 * @param chunkSize[in] the maximum number of elements to claim
+	 * @param chunkBase[out] the first element claimed
+	 * @param chunkTop[out] the end of the elements claimed
+	 * @return true if a chunk was claimed, false if all elements have been handed out
+	 */
+	MMINLINE bool
+	claimChunk(uintptr_t chunkSize, uintptr_t **chunkBase, uintptr_t **chunkTop)
+	{
+		bool result = false;
+		if (_chunkCurrent < _chunkTop) {
+			/* the cursor may run past _chunkTop by a chunk per racing thread, which is harmless */
+			uintptr_t chunkBytes = chunkSize * sizeof(uintptr_t);
+			uintptr_t *base = (uintptr_t *)(MM_AtomicOperations::add((volatile uintptr_t *)&_chunkCurrent, chunkBytes) - chunkBytes);
+			if (base < _chunkTop) {
+				*chunkBase = base;
+				*chunkTop = ((uintptr_t)(_chunkTop - base) > chunkSize) ? (base + chunkSize) : _chunkTop;
+				result = true;
+			}
+		}
+		return result;
+	}
+
 	MMINLINE MM_SublistPuddle *getNext() { return _next; }
 	MMINLINE void setNext(MM_SublistPuddle *next) { _next = next; }
 
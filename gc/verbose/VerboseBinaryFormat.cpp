@@ -0,0 +1,837 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "VerboseBinaryFormat.hpp"
+
+#include <string.h>
+
+/* Record opcodes. Tab, newline, carriage return and printable ASCII stand for themselves. */
+#define OP_NAME 0x01 /**< followed by a dictionary index: the name */
+#define OP_ATTRIBUTE 0x02 /**< followed by a dictionary index: a space, the name and =" */
+#define OP_NUMBER 0x03 /**< followed by a varint: the value in decimal */
+#define OP_SPACES 0x04 /**< followed by a varint: that many spaces */
+#define OP_ESCAPE 0x05 /**< followed by any byte: that byte */
+#define OP_TIMESTAMP 0x06 /**< followed by a varint year, a byte each for month, day, hour, minute and second, and two for milliseconds */
+#define OP_ADDRESS 0x07 /**< followed by 8 bytes: 16 upper case hex digits */
+
+/* Length of a timestamp, as in 2026-10-17T04:19:52.853 */
+#define TIMESTAMP_LENGTH 23
+/* Length of a 64 bit address or thread id, as in 000055F71D0A90B0 */
+#define ADDRESS_LENGTH 16
+
+/* Numbers of more digits may not fit in 64 bits */
+#define MAX_NUMBER_DIGITS 19
+
+/**
+ * Element and attribute names declared in schema.xsd, sorted by strcmp.
+ * Not every declared name fits in the dictionary; names found in neither table are kept as text.
+ * The index of a name is part of the format, so the dictionary may only change with a new format version.
+ */
+static const char * const names[] = {
+	"activeThreads",
+	"af-end",
+	"af-start",
+	"age",
+	"allocated-bytes",
+	"allocation-satisfied",
+	"allocation-stats",
+	"allocation-taxation",
+	"allocation-unsatisfied",
+	"amount",
+	"anonymousclassesunloaded",
+	"arraylet-primitive",
+	"arraylet-reference",
+	"arraylet-unknown",
+	"arrayletleaf",
+	"attribute",
+	"bysize",
+	"bytes",
+	"bytesAfter",
+	"bytesBefore",
+	"bytesByHelper",
+	"bytesByMutator",
+	"bytesRequested",
+	"bytesScanned",
+	"bytesTarget",
+	"bytesTotal",
+	"bytesTraced",
+	"bytesdiscarded",
+	"candidates",
+	"card-cleaning",
+	"cardclean-info",
+	"cards",
+	"cardsCleaned",
+	"chunks",
+	"classesunloaded",
+	"classloader",
+	"classloadercandidates",
+	"classloadersunloaded",
+	"classunload-info",
+	"cleaned",
+	"cleared",
+	"cold-mem-info",
+	"common",
+	"compact-info",
+	"concurrent-aborted",
+	"concurrent-end",
+	"concurrent-global-final",
+	"concurrent-halted",
+	"concurrent-kickoff",
+	"concurrent-mark-end",
+	"concurrent-mark-start",
+	"concurrent-start",
+	"concurrent-trace-info",
+	"contextid",
+	"copy-failed",
+	"count",
+	"cycle-continue",
+	"cycle-end",
+	"cycle-start",
+	"default",
+	"details",
+	"directObjectCount",
+	"discardedBytes",
+	"durationms",
+	"dynamicThreshold",
+	"eden",
+	"enqueued",
+	"entries",
+	"evacuated",
+	"event",
+	"exclusive-end",
+	"exclusive-start",
+	"exclusiveaccess-info",
+	"exclusiveaccessTimeMs",
+	"finalization",
+	"flushedBytes",
+	"free",
+	"free-mem",
+	"free-mem-delta",
+	"freebytes",
+	"fresh",
+	"from",
+	"gc-end",
+	"gc-op",
+	"gc-start",
+	"halted",
+	"heap-resize",
+	"id",
+	"idlems",
+	"initialized",
+	"intervalms",
+	"kickoff",
+	"largest",
+	"largest-consumer",
+	"lastid",
+	"lastname",
+	"leaves",
+	"local",
+	"macro-fragmented",
+	"marked",
+	"maxBytes",
+	"maxPriority",
+	"maxRegions",
+	"maxThreshold",
+	"maxTimeMs",
+	"maxTimestampMs",
+	"meanBytes",
+	"meanTimeMs",
+	"mem",
+	"mem-info",
+	"memory-cardclean",
+	"memory-copied",
+	"memory-traced",
+	"memorySpaceAddress",
+	"memorySpaceName",
+	"metronome",
+	"micro-fragmented",
+	"minBytes",
+	"minPriority",
+	"minTimeMs",
+	"movebytes",
+	"movecount",
+	"name",
+	"newtype",
+	"non-local",
+	"non-local-percent",
+	"non-monotonic-time",
+	"non-tlh",
+	"nondeterministic-sweep",
+	"numa",
+	"nurseryFreeBytes",
+	"object-monitors",
+	"objectcount",
+	"objects",
+	"objectsFound",
+	"oldtype",
+	"other",
+	"out-of-memory",
+	"ownableSynchronizers",
+	"packetCount",
+	"packetcount",
+	"pending-finalizers",
+	"percent",
+	"percolate-collect",
+	"postms",
+	"processed",
+	"prunetimems",
+	"quanta",
+	"quantumCount",
+	"quantumType",
+	"quiescems",
+	"reason",
+	"reasonForTermination",
+	"reference",
+	"references",
+	"region",
+	"regions",
+	"regionsoverflowed",
+	"regionsrebuilding",
+	"regionsstable",
+	"remainingFree",
+	"remembered-set",
+	"remembered-set-cleared",
+	"remembered-set-scan",
+	"response-info",
+	"reused",
+	"scan",
+	"scanTarget",
+	"scanbytes",
+	"scancount",
+	"scanms",
+	"scantimems",
+	"scavenger-info",
+	"setupms",
+	"space",
+	"stalltimems",
+	"state",
+	"status",
+	"stringconstants",
+	"success",
+	"survivor-age",
+	"survivor-ages",
+	"syncgc-info",
+	"sys-end",
+	"sys-start",
+	"system",
+	"systemtimems",
+	"targetBytes",
+	"taxation-threshold",
+	"tenureFreeBytes",
+	"tenureage",
+	"tenuremask",
+	"thread-priority",
+	"threadId",
+	"threadName",
+	"threadPriority",
+	"threads",
+	"thresholdBytes",
+	"thresholdFreeBytes",
+	"tiltratio",
+	"timeSliceCursor",
+	"timeSliceDurationArrayAddress",
+	"timems",
+	"timerDescription",
+	"timestamp",
+	"tlh",
+	"tlh-refreshes",
+	"to",
+	"total",
+	"totalBytes",
+	"totalBytesRequested",
+	"totalColdRegions",
+	"totalRegions",
+	"totalbytes",
+	"trace",
+	"trace-info",
+	"traced",
+	"tracedByHelpers",
+	"tracedByMutators",
+	"trigger-end",
+	"trigger-start",
+	"type",
+	"usertimems",
+	"utilization-tracker-overflow",
+	"utilizationTrackerAddress",
+	"value",
+	"verbosegc",
+	"version",
+	"vmarg",
+	"vmargs",
+	"warning",
+	"work-packet-overflow",
+	"workStackOverflowCount",
+};
+
+/**
+ * Names and attribute values which are common in the output but are not element or attribute names in schema.xsd, sorted by strcmp.
+ * Their indices follow those of the schema names, and the two together must fit in a byte.
+ */
+static const char * const extraNames[] = {
+	"OMR_VMThread",
+	"allocate",
+	"expand",
+	"false",
+	"global",
+	"mark",
+	"nursery",
+	"scavenge",
+	"survivor",
+	"sweep",
+	"tenure",
+	"true",
+};
+
+#define NAME_COUNT (sizeof(names) / sizeof(names[0]))
+#define EXTRA_NAME_COUNT (sizeof(extraNames) / sizeof(extraNames[0]))
+
+static MMINLINE bool
+isLiteral(uint8_t c)
+{
+	return ((c >= ' ') && (c < 0x7F)) || ('\t' == c) || ('\n' == c) || ('\r' == c);
+}
+
+static MMINLINE bool
+isNameStart(char c)
+{
+	return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || ('_' == c);
+}
+
+static MMINLINE bool
+isNamePart(char c)
+{
+	return isNameStart(c) || ((c >= '0') && (c <= '9')) || ('-' == c);
+}
+
+static MMINLINE bool
+isDigit(char c)
+{
+	return (c >= '0') && (c <= '9');
+}
+
+/**
+ * @return the length of the name starting at text, 0 if there is none
+ */
+static uintptr_t
+scanName(const char *text, const char *end)
+{
+	const char *cursor = text;
+	if ((cursor < end) && isNameStart(*cursor)) {
+		do {
+			cursor += 1;
+		} while ((cursor < end) && isNamePart(*cursor));
+	}
+	return cursor - text;
+}
+
+/**
+ * @return the index of the name in the sorted table, or -1 if it is not in the table
+ */
+static intptr_t
+findInTable(const char * const *table, uintptr_t count, const char *name, uintptr_t length)
+{
+	intptr_t low = 0;
+	intptr_t high = count - 1;
+	while (low <= high) {
+		intptr_t middle = (low + high) / 2;
+		const char *candidate = table[middle];
+		int compare = strncmp(candidate, name, length);
+		if ((0 == compare) && ('\0' != candidate[length])) {
+			/* the candidate has the name as a prefix so sorts after it */
+			compare = 1;
+		}
+		if (0 == compare) {
+			return middle;
+		} else if (compare < 0) {
+			low = middle + 1;
+		} else {
+			high = middle - 1;
+		}
+	}
+	return -1;
+}
+
+/**
+ * @return the dictionary index of the name, or -1 if it is not in the dictionary
+ */
+static intptr_t
+findName(const char *name, uintptr_t length)
+{
+	intptr_t index = findInTable(names, NAME_COUNT, name, length);
+	if (index < 0) {
+		index = findInTable(extraNames, EXTRA_NAME_COUNT, name, length);
+		if (index >= 0) {
+			index += NAME_COUNT;
+		}
+	}
+	return index;
+}
+
+static MMINLINE const char *
+getName(uint8_t index)
+{
+	return (index < NAME_COUNT) ? names[index] : extraNames[index - NAME_COUNT];
+}
+
+static MMINLINE bool
+isHexDigit(char c)
+{
+	return isDigit(c) || ((c >= 'A') && (c <= 'F'));
+}
+
+/**
+ * @return the value of the digits
+ */
+static uintptr_t
+parseDigits(const char *text, uintptr_t count)
+{
+	uintptr_t value = 0;
+	for (uintptr_t i = 0; i < count; i++) {
+		value = (value * 10) + (uintptr_t)(text[i] - '0');
+	}
+	return value;
+}
+
+/**
+ * @return true if the text starts with a timestamp in the form the verbose handlers print them
+ */
+static bool
+isTimestamp(const char *text, const char *end)
+{
+	const char *pattern = "dddd-dd-ddTdd:dd:dd.ddd";
+	if ((end - text) < TIMESTAMP_LENGTH) {
+		return false;
+	}
+	for (uintptr_t i = 0; i < TIMESTAMP_LENGTH; i++) {
+		if ('d' == pattern[i] ? !isDigit(text[i]) : (pattern[i] != text[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * @return true if the text starts with an address in the form the verbose handlers print them
+ */
+static bool
+isAddress(const char *text, const char *end)
+{
+	if ((end - text) < ADDRESS_LENGTH) {
+		return false;
+	}
+	for (uintptr_t i = 0; i < ADDRESS_LENGTH; i++) {
+		if (!isHexDigit(text[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static MMINLINE uint8_t
+hexValue(char c)
+{
+	return (uint8_t)(isDigit(c) ? (c - '0') : (c - 'A' + 10));
+}
+
+static MMINLINE uint8_t *
+writeVarint(uint8_t *out, uint64_t value)
+{
+	while (value >= 0x80) {
+		*out++ = (uint8_t)(value | 0x80);
+		value >>= 7;
+	}
+	*out++ = (uint8_t)value;
+	return out;
+}
+
+/**
+ * @return the position after the varint, or NULL if it runs past the end
+ */
+static const uint8_t *
+readVarint(const uint8_t *data, const uint8_t *end, uint64_t *value)
+{
+	uint64_t result = 0;
+	uintptr_t shift = 0;
+	while ((data < end) && (shift < 64)) {
+		uint8_t byte = *data++;
+		result |= ((uint64_t)(byte & 0x7F)) << shift;
+		if (0 == (byte & 0x80)) {
+			*value = result;
+			return data;
+		}
+		shift += 7;
+	}
+	return NULL;
+}
+
+/**
+ * Encode a chunk of text, without the length prefix.
+ * @return the position after the encoded text
+ */
+static uint8_t *
+encodeText(const char *text, const char *end, uint8_t *out)
+{
+	const char *cursor = text;
+	while (cursor < end) {
+		char c = *cursor;
+		if (' ' == c) {
+			uintptr_t nameLength = scanName(cursor + 1, end);
+			const char *nameEnd = cursor + 1 + nameLength;
+			if ((0 != nameLength) && ((end - nameEnd) >= 2) && ('=' == nameEnd[0]) && ('"' == nameEnd[1])) {
+				intptr_t index = findName(cursor + 1, nameLength);
+				if (index >= 0) {
+					*out++ = OP_ATTRIBUTE;
+					*out++ = (uint8_t)index;
+					cursor = nameEnd + 2;
+					continue;
+				}
+			}
+			const char *spaceEnd = cursor + 1;
+			while ((spaceEnd < end) && (' ' == *spaceEnd)) {
+				spaceEnd += 1;
+			}
+			uintptr_t spaceCount = spaceEnd - cursor;
+			if (spaceCount >= 3) {
+				/* indentation */
+				*out++ = OP_SPACES;
+				out = writeVarint(out, spaceCount);
+				cursor = spaceEnd;
+			} else {
+				*out++ = ' ';
+				cursor += 1;
+			}
+		} else if (isTimestamp(cursor, end)) {
+			*out++ = OP_TIMESTAMP;
+			out = writeVarint(out, parseDigits(cursor, 4));
+			*out++ = (uint8_t)parseDigits(cursor + 5, 2);
+			*out++ = (uint8_t)parseDigits(cursor + 8, 2);
+			*out++ = (uint8_t)parseDigits(cursor + 11, 2);
+			*out++ = (uint8_t)parseDigits(cursor + 14, 2);
+			*out++ = (uint8_t)parseDigits(cursor + 17, 2);
+			uintptr_t millis = parseDigits(cursor + 20, 3);
+			*out++ = (uint8_t)(millis & 0xFF);
+			*out++ = (uint8_t)(millis >> 8);
+			cursor += TIMESTAMP_LENGTH;
+		} else if (isAddress(cursor, end)) {
+			*out++ = OP_ADDRESS;
+			for (uintptr_t i = 0; i < ADDRESS_LENGTH; i += 2) {
+				*out++ = (uint8_t)((hexValue(cursor[i]) << 4) | hexValue(cursor[i + 1]));
+			}
+			cursor += ADDRESS_LENGTH;
+		} else if (isNameStart(c)) {
+			uintptr_t nameLength = scanName(cursor, end);
+			intptr_t index = findName(cursor, nameLength);
+			if (index >= 0) {
+				*out++ = OP_NAME;
+				*out++ = (uint8_t)index;
+			} else {
+				memcpy(out, cursor, nameLength);
+				out += nameLength;
+			}
+			cursor += nameLength;
+		} else if (isDigit(c)) {
+			const char *digitEnd = cursor + 1;
+			while ((digitEnd < end) && isDigit(*digitEnd)) {
+				digitEnd += 1;
+			}
+			uintptr_t digitCount = digitEnd - cursor;
+			if ((digitCount <= MAX_NUMBER_DIGITS) && (('0' != c) || (1 == digitCount))) {
+				uint64_t value = 0;
+				for (const char *digit = cursor; digit < digitEnd; digit++) {
+					value = (value * 10) + (uint64_t)(*digit - '0');
+				}
+				*out++ = OP_NUMBER;
+				out = writeVarint(out, value);
+			} else {
+				/* leading zeroes, as in addresses, would not survive the round trip */
+				memcpy(out, cursor, digitCount);
+				out += digitCount;
+			}
+			cursor = digitEnd;
+		} else {
+			if (!isLiteral((uint8_t)c)) {
+				*out++ = OP_ESCAPE;
+			}
+			*out++ = (uint8_t)c;
+			cursor += 1;
+		}
+	}
+	return out;
+}
+
+/**
+ * Decode one record payload, counting every byte of text but only storing what fits.
+ * @return false if the payload is malformed
+ */
+static bool
+decodeText(const uint8_t *data, const uint8_t *end, char *out, uintptr_t outSize, uintptr_t *position)
+{
+	uintptr_t written = *position;
+	while (data < end) {
+		uint8_t op = *data++;
+		const char *string = NULL;
+		uintptr_t length = 0;
+		char number[TIMESTAMP_LENGTH + 1];
+		uint64_t value = 0;
+		switch (op) {
+		case OP_NAME:
+		case OP_ATTRIBUTE:
+			if ((data >= end) || (*data >= (NAME_COUNT + EXTRA_NAME_COUNT))) {
+				return false;
+			}
+			string = getName(*data++);
+			length = strlen(string);
+			if (OP_ATTRIBUTE == op) {
+				if (written < outSize) {
+					out[written] = ' ';
+				}
+				written += 1;
+			}
+			break;
+		case OP_NUMBER:
+		{
+			data = readVarint(data, end, &value);
+			if (NULL == data) {
+				return false;
+			}
+			char *digit = number + sizeof(number);
+			do {
+				*--digit = (char)('0' + (value % 10));
+				value /= 10;
+			} while (0 != value);
+			string = digit;
+			length = (number + sizeof(number)) - digit;
+			break;
+		}
+		case OP_SPACES:
+			data = readVarint(data, end, &value);
+			if (NULL == data) {
+				return false;
+			}
+			for (uint64_t i = 0; i < value; i++) {
+				if (written < outSize) {
+					out[written] = ' ';
+				}
+				written += 1;
+			}
+			break;
+		case OP_TIMESTAMP:
+		{
+			uint64_t year = 0;
+			data = readVarint(data, end, &year);
+			if ((NULL == data) || (year > 9999) || ((end - data) < 7)) {
+				return false;
+			}
+			uintptr_t millis = data[5] | ((uintptr_t)data[6] << 8);
+			if ((data[0] > 99) || (data[1] > 99) || (data[2] > 99) || (data[3] > 99) || (data[4] > 99) || (millis > 999)) {
+				return false;
+			}
+			char *digit = number;
+			const uintptr_t fields[] = {(uintptr_t)year, data[0], data[1], data[2], data[3], data[4], millis};
+			const uintptr_t widths[] = {4, 2, 2, 2, 2, 2, 3};
+			const char separators[] = "--T::.";
+			for (uintptr_t field = 0; field < 7; field++) {
+				uintptr_t value = fields[field];
+				for (uintptr_t place = widths[field]; place > 0; place--) {
+					digit[place - 1] = (char)('0' + (value % 10));
+					value /= 10;
+				}
+				digit += widths[field];
+				if (field < 6) {
+					*digit++ = separators[field];
+				}
+			}
+			string = number;
+			length = TIMESTAMP_LENGTH;
+			data += 7;
+			break;
+		}
+		case OP_ADDRESS:
+		{
+			if ((end - data) < (ADDRESS_LENGTH / 2)) {
+				return false;
+			}
+			const char *hexDigits = "0123456789ABCDEF";
+			for (uintptr_t i = 0; i < ADDRESS_LENGTH / 2; i++) {
+				number[2 * i] = hexDigits[data[i] >> 4];
+				number[(2 * i) + 1] = hexDigits[data[i] & 0xF];
+			}
+			string = number;
+			length = ADDRESS_LENGTH;
+			data += ADDRESS_LENGTH / 2;
+			break;
+		}
+		case OP_ESCAPE:
+			if (data >= end) {
+				return false;
+			}
+			string = (const char *)data;
+			length = 1;
+			data += 1;
+			break;
+		default:
+			if (!isLiteral(op)) {
+				return false;
+			}
+			string = (const char *)(data - 1);
+			length = 1;
+			break;
+		}
+		for (uintptr_t i = 0; i < length; i++) {
+			if (written < outSize) {
+				out[written] = string[i];
+			}
+			written += 1;
+		}
+		if (OP_ATTRIBUTE == op) {
+			for (const char *suffix = "=\""; '\0' != *suffix; suffix++) {
+				if (written < outSize) {
+					out[written] = *suffix;
+				}
+				written += 1;
+			}
+		}
+	}
+	*position = written;
+	return true;
+}
+
+uintptr_t
+MM_VerboseBinaryFormat::writeFileHeader(uint8_t *out)
+{
+	memcpy(out, OMR_VERBOSE_BINARY_MAGIC, OMR_VERBOSE_BINARY_HEADER_SIZE - 1);
+	out[OMR_VERBOSE_BINARY_HEADER_SIZE - 1] = OMR_VERBOSE_BINARY_VERSION;
+	return OMR_VERBOSE_BINARY_HEADER_SIZE;
+}
+
+bool
+MM_VerboseBinaryFormat::isBinaryLog(const uint8_t *data, uintptr_t size)
+{
+	return (size >= OMR_VERBOSE_BINARY_HEADER_SIZE)
+		&& (0 == memcmp(data, OMR_VERBOSE_BINARY_MAGIC, OMR_VERBOSE_BINARY_HEADER_SIZE - 1))
+		&& (OMR_VERBOSE_BINARY_VERSION == data[OMR_VERBOSE_BINARY_HEADER_SIZE - 1]);
+}
+
+uintptr_t
+MM_VerboseBinaryFormat::encodeRecord(const char *text, uintptr_t length, uint8_t *out)
+{
+	/* encode past the largest prefix, then slide the payload down behind the actual one */
+	uint8_t *payload = out + OMR_VERBOSE_BINARY_MAX_PREFIX_SIZE;
+	uintptr_t payloadLength = encodeText(text, text + length, payload) - payload;
+	uint8_t *prefixEnd = writeVarint(out, payloadLength);
+	memmove(prefixEnd, payload, payloadLength);
+	return (prefixEnd - out) + payloadLength;
+}
+
+intptr_t
+MM_VerboseBinaryFormat::decode(const uint8_t *data, uintptr_t size, char *out, uintptr_t outSize)
+{
+	if (!isBinaryLog(data, size)) {
+		return -1;
+	}
+	if (NULL == out) {
+		outSize = 0;
+	}
+
+	const uint8_t *end = data + size;
+	const uint8_t *cursor = data + OMR_VERBOSE_BINARY_HEADER_SIZE;
+	uintptr_t written = 0;
+	while (cursor < end) {
+		uint64_t payloadLength = 0;
+		cursor = readVarint(cursor, end, &payloadLength);
+		if ((NULL == cursor) || (payloadLength > (uint64_t)(end - cursor))) {
+			return -1;
+		}
+		if (!decodeText(cursor, cursor + payloadLength, out, outSize, &written)) {
+			return -1;
+		}
+		cursor += payloadLength;
+	}
+
+	if (written < outSize) {
+		out[written] = '\0';
+	} else if (0 != outSize) {
+		out[outSize - 1] = '\0';
+	}
+	return (intptr_t)(written + 1);
+}
+
+char *
+MM_VerboseBinaryFormat::readAsXML(OMRPortLibrary *portLibrary, const char *binaryFilename, uintptr_t *length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	char *text = NULL;
+
+	intptr_t fd = omrfile_open(binaryFilename, EsOpenRead, 0);
+	if (-1 == fd) {
+		return NULL;
+	}
+	int64_t fileLength = omrfile_flength(fd);
+	uint8_t *data = NULL;
+	if (fileLength > 0) {
+		data = (uint8_t *)omrmem_allocate_memory((uintptr_t)fileLength, OMRMEM_CATEGORY_MM);
+	}
+	if (NULL != data) {
+		uintptr_t bytesRead = 0;
+		while (bytesRead < (uintptr_t)fileLength) {
+			intptr_t rc = omrfile_read(fd, data + bytesRead, (intptr_t)((uintptr_t)fileLength - bytesRead));
+			if (rc <= 0) {
+				break;
+			}
+			bytesRead += rc;
+		}
+		if (bytesRead == (uintptr_t)fileLength) {
+			intptr_t textSize = decode(data, bytesRead, NULL, 0);
+			if (textSize > 0) {
+				text = (char *)omrmem_allocate_memory(textSize, OMRMEM_CATEGORY_MM);
+				if (NULL != text) {
+					decode(data, bytesRead, text, textSize);
+					*length = textSize - 1;
+				}
+			}
+		}
+		omrmem_free_memory(data);
+	}
+	omrfile_close(fd);
+
+	return text;
+}
+
+bool
+MM_VerboseBinaryFormat::convertToXML(OMRPortLibrary *portLibrary, const char *binaryFilename, const char *xmlFilename)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	bool result = false;
+
+	uintptr_t length = 0;
+	char *text = readAsXML(portLibrary, binaryFilename, &length);
+	if (NULL != text) {
+		intptr_t fd = omrfile_open(xmlFilename, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 != fd) {
+			result = ((intptr_t)length == omrfile_write(fd, text, (intptr_t)length));
+			omrfile_close(fd);
+		}
+		omrmem_free_memory(text);
+	}
+
+	return result;
+}
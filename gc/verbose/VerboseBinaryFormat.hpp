@@ -0,0 +1,115 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYFORMAT_HPP_)
+#define VERBOSEBINARYFORMAT_HPP_
+
+#include "omrcfg.h"
+#include "modronbase.h"
+#include "omrport.h"
+
+/* Every binary verbose log starts with these 7 bytes followed by the format version */
+#define OMR_VERBOSE_BINARY_MAGIC "OMRVGCB"
+#define OMR_VERBOSE_BINARY_VERSION 1
+#define OMR_VERBOSE_BINARY_HEADER_SIZE 8
+
+/* Largest record length prefix: a 64 bit varint */
+#define OMR_VERBOSE_BINARY_MAX_PREFIX_SIZE 10
+
+/**
+ * Compact encoding of verbose GC output.
+ *
+ * A binary log is a file header followed by length-prefixed records, each holding one
+ * chunk of the XML text the verbose handlers produce. Within a record, element and
+ * attribute names declared in schema.xsd are replaced by a one byte dictionary index,
+ * attributes by a single opcode and decimal numbers by varints; everything else is
+ * kept as it is. Decoding the records in order reproduces the original text byte for
+ * byte, so a converted log is identical to what the text writers produce.
+ */
+class MM_VerboseBinaryFormat
+{
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Write the file header.
+	 * @param[out] out at least OMR_VERBOSE_BINARY_HEADER_SIZE bytes
+	 * @return the number of bytes written
+	 */
+	static uintptr_t writeFileHeader(uint8_t *out);
+
+	/**
+	 * @return true if the data starts with the header of a binary log this format can decode
+	 */
+	static bool isBinaryLog(const uint8_t *data, uintptr_t size);
+
+	/**
+	 * @return the largest possible record size for the given length of text
+	 */
+	static MMINLINE uintptr_t
+	maxRecordSize(uintptr_t length)
+	{
+		/* only escaped bytes grow, and they take two bytes each */
+		return OMR_VERBOSE_BINARY_MAX_PREFIX_SIZE + (2 * length);
+	}
+
+	/**
+	 * Encode text as one length-prefixed record.
+	 * @param[in] text the text to encode, not necessarily NUL terminated
+	 * @param[in] length the number of bytes of text
+	 * @param[out] out at least maxRecordSize(length) bytes
+	 * @return the number of bytes written
+	 */
+	static uintptr_t encodeRecord(const char *text, uintptr_t length, uint8_t *out);
+
+	/**
+	 * Decode a complete binary log, file header included, back to text.
+	 * As with omrstr_subst_tokens, call with a NULL buffer to find the size to allocate.
+	 * @param[in] data the log
+	 * @param[in] size the number of bytes of log
+	 * @param[out] out the text, NUL terminated when the buffer is large enough, may be NULL
+	 * @param[in] outSize the size of the out buffer
+	 * @return the size of buffer needed for the text and the terminating NUL, or -1 if the log is malformed
+	 */
+	static intptr_t decode(const uint8_t *data, uintptr_t size, char *out, uintptr_t outSize);
+
+	/**
+	 * Offline conversion of a binary log file to the XML the text writers would have written.
+	 * @param[in] portLibrary the port library
+	 * @param[in] binaryFilename the binary log to read
+	 * @param[in] xmlFilename the XML file to write
+	 * @return true on success, false if either file could not be accessed or the log is malformed
+	 */
+	static bool convertToXML(OMRPortLibrary *portLibrary, const char *binaryFilename, const char *xmlFilename);
+
+	/**
+	 * Read a binary log file and decode it to text.
+	 * @param[in] portLibrary the port library
+	 * @param[in] binaryFilename the binary log to read
+	 * @param[out] length the length of the text, excluding the terminating NUL
+	 * @return the NUL terminated text, to be freed with omrmem_free_memory, or NULL on failure
+	 */
+	static char *readAsXML(OMRPortLibrary *portLibrary, const char *binaryFilename, uintptr_t *length);
+};
+
+#endif /* VERBOSEBINARYFORMAT_HPP_ */
@@ -820,6 +820,13 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
 	}
 
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	if (!_extensions->isSegregatedHeap()) {
+		writer->formatAndOutput(env, 1, "<tlh-refreshes fresh=\"%zu\" reused=\"%zu\" discardedBytes=\"%zu\" flushedBytes=\"%zu\" />",
+				systemStats->_tlhRefreshCountFresh, systemStats->_tlhRefreshCountReused, systemStats->_tlhDiscardedBytes, systemStats->_tlhFlushedBytes);
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+
 	if(0 != _extensions->bytesAllocatedMost){
 		const char *dots = "";
 		char escapedThreadName[128];
@@ -0,0 +1,594 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrutil.h"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Math.hpp"
+#include "ModronAssertions.h"
+#include "VerboseBinaryFormat.hpp"
+#include "VerboseBuffer.hpp"
+#include "VerboseHandlerOutput.hpp"
+#include "VerboseManager.hpp"
+#include "VerboseWriterFileLoggingBinary.hpp"
+
+#include <string.h>
+
+#define SHARED_BUFFER (OMR_VERBOSE_BINARY_THREAD_BUFFERS)
+#define BUFFER_MASK (OMR_VERBOSE_BINARY_THREAD_BUFFER_SIZE - 1)
+
+MM_VerboseWriterFileLoggingBinary::MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_BINARY)
+	,_omrVM(env->getOmrVM())
+	,_sharedBufferLock(0)
+	,_nextSequence(0)
+	,_drainSequence(0)
+	,_lastDrainedBuffer(0)
+	,_drainMonitor(NULL)
+	,_drainThreadState(DRAIN_THREAD_NOT_STARTED)
+	,_drainRequested(false)
+	,_producersWaiting(0)
+	,_fileMutex(NULL)
+	,_logFileDescriptor(-1)
+	,_outputBuffer(NULL)
+	,_outputBufferUsed(0)
+	,_drainedBytes(0)
+	,_writtenBytes(0)
+{
+	memset(_threadBuffers, 0, sizeof(_threadBuffers));
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingBinary instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingBinary.
+ */
+MM_VerboseWriterFileLoggingBinary *
+MM_VerboseWriterFileLoggingBinary::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingBinary *agent = (MM_VerboseWriterFileLoggingBinary *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingBinary), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingBinary(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingBinary instance.
+ * Also called on reconfiguration, when the buffers and the drain thread already exist.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (NULL == _drainMonitor) {
+		if (0 != omrthread_monitor_init_with_name(&_drainMonitor, 0, "MM_VerboseWriterFileLoggingBinary::_drainMonitor")) {
+			_drainMonitor = NULL;
+			return false;
+		}
+	}
+	if (NULL == _fileMutex) {
+		if (0 != omrthread_monitor_init_with_name(&_fileMutex, 0, "MM_VerboseWriterFileLoggingBinary::_fileMutex")) {
+			_fileMutex = NULL;
+			return false;
+		}
+	}
+	if (NULL == _outputBuffer) {
+		_outputBuffer = (uint8_t *)extensions->getForge()->allocate(OMR_VERBOSE_BINARY_OUTPUT_BUFFER_SIZE, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _outputBuffer) {
+			return false;
+		}
+	}
+	if (NULL == _threadBuffers[SHARED_BUFFER].data) {
+		/* the shared buffer must always be usable, so it is not allocated lazily */
+		_threadBuffers[SHARED_BUFFER].data = (uint8_t *)extensions->getForge()->allocate(OMR_VERBOSE_BINARY_THREAD_BUFFER_SIZE, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _threadBuffers[SHARED_BUFFER].data) {
+			return false;
+		}
+	}
+
+	if (!MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles)) {
+		return false;
+	}
+
+	if (DRAIN_THREAD_NOT_STARTED == _drainThreadState) {
+		return startDrainThread(env);
+	}
+	return true;
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingBinary.
+ * Writes out any queued output and stops the drain thread.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	stopDrainThread(env);
+
+	if (NULL != _fileMutex) {
+		flush(env);
+		omrthread_monitor_enter(_fileMutex);
+		closeLogFile(env);
+		omrthread_monitor_exit(_fileMutex);
+		omrthread_monitor_destroy(_fileMutex);
+		_fileMutex = NULL;
+	}
+	if (NULL != _drainMonitor) {
+		omrthread_monitor_destroy(_drainMonitor);
+		_drainMonitor = NULL;
+	}
+
+	for (uintptr_t i = 0; i <= SHARED_BUFFER; i++) {
+		extensions->getForge()->free(_threadBuffers[i].data);
+		_threadBuffers[i].data = NULL;
+	}
+	extensions->getForge()->free(_outputBuffer);
+	_outputBuffer = NULL;
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+/**
+ * Opens the file to log output to and prints the header.
+ * When rotating files the file is opened by the drain thread, once the output queued for the previous file is written.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::openFile(MM_EnvironmentBase *env, bool printInitializedHeader)
+{
+	if (printInitializedHeader) {
+		uintptr_t fileNumber = _currentFile;
+		enqueue(env, QUEUED_OPEN, (const char *)&fileNumber, sizeof(fileNumber));
+		/* Print an Initialized Stanza in new file */
+		MM_VerboseBuffer* buffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+		if (NULL != buffer) {
+			_manager->getVerboseHandlerOutput()->outputInitializedStanza(env, buffer);
+			outputString(env, buffer->contents());
+			buffer->kill(env);
+		}
+		return true;
+	}
+
+	/* write out anything queued for the previous file, its close in particular, before opening this one */
+	flush(env);
+	omrthread_monitor_enter(_fileMutex);
+	bool result = openLogFile(env, _currentFile);
+	omrthread_monitor_exit(_fileMutex);
+	return result;
+}
+
+/**
+ * Queues printing the footer and closing the file being logged to.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::closeFile(MM_EnvironmentBase *env)
+{
+	enqueue(env, QUEUED_CLOSE, NULL, 0);
+}
+
+/**
+ * Closes the agent's output stream, once everything queued for it is written.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::closeStream(MM_EnvironmentBase *env)
+{
+	closeFile(env);
+	flush(env);
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	uintptr_t length = strlen(string);
+	while (length > 0) {
+		uintptr_t chunkLength = OMR_MIN(length, OMR_VERBOSE_BINARY_CHUNK_SIZE);
+		enqueue(env, QUEUED_TEXT, string, chunkLength);
+		string += chunkLength;
+		length -= chunkLength;
+	}
+}
+
+/**
+ * Cycles the output files if necessary, and has the drain thread write out the cycle.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::endOfCycle(MM_EnvironmentBase *env)
+{
+	MM_VerboseWriterFileLogging::endOfCycle(env);
+	wakeDrainThread();
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::flush(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_fileMutex);
+	drainRecords(env, true);
+	writeOutputBuffer(env);
+	omrthread_monitor_exit(_fileMutex);
+}
+
+MM_VerboseWriterFileLoggingBinary::ThreadBuffer *
+MM_VerboseWriterFileLoggingBinary::acquireThreadBuffer(MM_EnvironmentBase *env)
+{
+	omrthread_t self = omrthread_self();
+	for (uintptr_t i = 0; i < SHARED_BUFFER; i++) {
+		ThreadBuffer *buffer = &_threadBuffers[i];
+		omrthread_t owner = buffer->owner;
+		if (NULL == owner) {
+			if (NULL == (omrthread_t)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&buffer->owner, (uintptr_t)NULL, (uintptr_t)self)) {
+				/* the drainer does not look at the data until the owner queues a record */
+				buffer->data = (uint8_t *)env->getExtensions()->getForge()->allocate(OMR_VERBOSE_BINARY_THREAD_BUFFER_SIZE, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+				owner = self;
+			} else {
+				owner = buffer->owner;
+			}
+		}
+		if (self == owner) {
+			if (NULL != buffer->data) {
+				return buffer;
+			}
+			/* the buffer could not be allocated */
+			break;
+		}
+	}
+
+	/* all buffers are claimed, most likely by threads which have exited, so take turns with the shared buffer */
+	while (0 != MM_AtomicOperations::lockCompareExchange(&_sharedBufferLock, 0, 1)) {
+		omrthread_yield();
+	}
+	return &_threadBuffers[SHARED_BUFFER];
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::releaseThreadBuffer(ThreadBuffer *buffer)
+{
+	if (&_threadBuffers[SHARED_BUFFER] == buffer) {
+		MM_AtomicOperations::storeSync();
+		_sharedBufferLock = 0;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::enqueue(MM_EnvironmentBase *env, QueuedRecordType type, const char *text, uintptr_t length)
+{
+	uintptr_t recordSize = MM_Math::roundToCeiling(sizeof(uintptr_t), sizeof(QueuedRecord) + length);
+	ThreadBuffer *buffer = acquireThreadBuffer(env);
+
+	/* a record never wraps: skip to the start of the buffer if it does not fit before the end */
+	uintptr_t tail = buffer->tail;
+	uintptr_t offset = tail & BUFFER_MASK;
+	uintptr_t padding = 0;
+	if ((OMR_VERBOSE_BINARY_THREAD_BUFFER_SIZE - offset) < recordSize) {
+		padding = OMR_VERBOSE_BINARY_THREAD_BUFFER_SIZE - offset;
+	}
+	while ((OMR_VERBOSE_BINARY_THREAD_BUFFER_SIZE - (tail - buffer->head)) < (padding + recordSize)) {
+		waitForDrain();
+	}
+
+	if (padding >= sizeof(QueuedRecord)) {
+		/* too little padding for a header is skipped by the drainer without one */
+		QueuedRecord *pad = (QueuedRecord *)(buffer->data + offset);
+		pad->type = QUEUED_PAD;
+		pad->length = (uint32_t)(padding - sizeof(QueuedRecord));
+	}
+	QueuedRecord *record = (QueuedRecord *)(buffer->data + ((tail + padding) & BUFFER_MASK));
+	record->type = type;
+	record->length = (uint32_t)length;
+	if (0 != length) {
+		memcpy(record + 1, text, length);
+	}
+	/* numbering the record only once there is room for it keeps the gaps the drainer waits on short */
+	record->sequence = MM_AtomicOperations::add(&_nextSequence, 1) - 1;
+	/* the record must be visible before the drainer can see the new tail */
+	MM_AtomicOperations::storeSync();
+	tail += padding + recordSize;
+	buffer->tail = tail;
+	bool drainNow = (tail - buffer->head) > (OMR_VERBOSE_BINARY_THREAD_BUFFER_SIZE / 2);
+	releaseThreadBuffer(buffer);
+
+	if (drainNow) {
+		wakeDrainThread();
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::waitForDrain()
+{
+	omrthread_monitor_enter(_drainMonitor);
+	_drainRequested = true;
+	_producersWaiting += 1;
+	omrthread_monitor_notify_all(_drainMonitor);
+	/* timed in case the drain pass completed before we started waiting */
+	omrthread_monitor_wait_timed(_drainMonitor, 1, 0);
+	_producersWaiting -= 1;
+	omrthread_monitor_exit(_drainMonitor);
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::wakeDrainThread()
+{
+	omrthread_monitor_enter(_drainMonitor);
+	_drainRequested = true;
+	omrthread_monitor_notify_all(_drainMonitor);
+	omrthread_monitor_exit(_drainMonitor);
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::drainRecords(MM_EnvironmentBase *env, bool waitForAll)
+{
+	uintptr_t index = _lastDrainedBuffer;
+	uintptr_t checked = 0;
+	while (true) {
+		ThreadBuffer *buffer = &_threadBuffers[index];
+		uintptr_t head = buffer->head;
+		bool drained = false;
+		if (head != buffer->tail) {
+			MM_AtomicOperations::loadSync();
+			uintptr_t offset = head & BUFFER_MASK;
+			uintptr_t remaining = OMR_VERBOSE_BINARY_THREAD_BUFFER_SIZE - offset;
+			QueuedRecord *record = (QueuedRecord *)(buffer->data + offset);
+			if ((remaining < sizeof(QueuedRecord)) || (QUEUED_PAD == record->type)) {
+				head += remaining;
+				record = (QueuedRecord *)buffer->data;
+			}
+			if (_drainSequence == record->sequence) {
+				processRecord(env, record);
+				_drainSequence += 1;
+				/* the record must be consumed before the owner can reuse its space */
+				MM_AtomicOperations::sync();
+				buffer->head = head + MM_Math::roundToCeiling(sizeof(uintptr_t), sizeof(QueuedRecord) + record->length);
+				drained = true;
+			}
+		}
+
+		if (drained) {
+			/* the thread that queued this record most likely queued the next one too */
+			_lastDrainedBuffer = index;
+			checked = 0;
+		} else {
+			index = (index + 1) % (SHARED_BUFFER + 1);
+			checked += 1;
+			if (checked > SHARED_BUFFER) {
+				if (waitForAll && (_drainSequence != _nextSequence)) {
+					/* another thread has numbered its record but not yet published it */
+					omrthread_yield();
+					checked = 0;
+				} else {
+					break;
+				}
+			}
+		}
+	}
+
+	omrthread_monitor_enter(_drainMonitor);
+	if (0 != _producersWaiting) {
+		omrthread_monitor_notify_all(_drainMonitor);
+	}
+	omrthread_monitor_exit(_drainMonitor);
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::processRecord(MM_EnvironmentBase *env, QueuedRecord *record)
+{
+	switch (record->type) {
+	case QUEUED_TEXT:
+		outputText(env, (const char *)(record + 1), record->length);
+		_drainedBytes += record->length;
+		break;
+	case QUEUED_OPEN:
+	{
+		uintptr_t fileNumber = 0;
+		memcpy(&fileNumber, record + 1, sizeof(fileNumber));
+		closeLogFile(env);
+		openLogFile(env, fileNumber);
+		break;
+	}
+	case QUEUED_CLOSE:
+		closeLogFile(env);
+		break;
+	default:
+		Assert_MM_unreachable();
+		break;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::outputText(MM_EnvironmentBase *env, const char *text, uintptr_t length)
+{
+	if (-1 == _logFileDescriptor) {
+		/**
+		 * Under normal circumstances the file is open. If it could not be opened, attempt to open it
+		 * again before outputting the text, and failing that send the text to stderr as it is.
+		 */
+		if (!openLogFile(env, _currentFile)) {
+			OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+			omrfile_write_text(OMRPORT_TTY_ERR, text, length);
+			return;
+		}
+	}
+
+	if ((OMR_VERBOSE_BINARY_OUTPUT_BUFFER_SIZE - _outputBufferUsed) < MM_VerboseBinaryFormat::maxRecordSize(length)) {
+		writeOutputBuffer(env);
+	}
+	_outputBufferUsed += MM_VerboseBinaryFormat::encodeRecord(text, length, _outputBuffer + _outputBufferUsed);
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::writeOutputBuffer(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if ((0 != _outputBufferUsed) && (-1 != _logFileDescriptor)) {
+		if ((intptr_t)_outputBufferUsed == omrfile_write(_logFileDescriptor, _outputBuffer, (intptr_t)_outputBufferUsed)) {
+			_writtenBytes += _outputBufferUsed;
+		}
+	}
+	_outputBufferUsed = 0;
+}
+
+bool
+MM_VerboseWriterFileLoggingBinary::openLogFile(MM_EnvironmentBase *env, uintptr_t fileNumber)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	char *filenameToOpen = expandFilename(env, fileNumber);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == _logFileDescriptor) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 == _logFileDescriptor) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	_outputBufferUsed = MM_VerboseBinaryFormat::writeFileHeader(_outputBuffer);
+	const char *header = getHeader(env);
+	outputText(env, header, strlen(header));
+
+	return true;
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::closeLogFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (-1 != _logFileDescriptor) {
+		const char *footer = getFooter(env);
+		outputText(env, footer, strlen(footer));
+		outputText(env, "\n", strlen("\n"));
+		writeOutputBuffer(env);
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+	}
+}
+
+bool
+MM_VerboseWriterFileLoggingBinary::startDrainThread(MM_EnvironmentBase *env)
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of the thread so that it cannot notify us of its state before we wait */
+	omrthread_monitor_enter(_drainMonitor);
+	_drainThreadState = DRAIN_THREAD_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		drainThreadProc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (DRAIN_THREAD_STARTING == _drainThreadState) {
+			omrthread_monitor_wait(_drainMonitor);
+		}
+		success = (DRAIN_THREAD_RUNNING == _drainThreadState);
+	} else {
+		_drainThreadState = DRAIN_THREAD_ERROR;
+	}
+	omrthread_monitor_exit(_drainMonitor);
+
+	return success;
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::stopDrainThread(MM_EnvironmentBase *env)
+{
+	if (DRAIN_THREAD_RUNNING == _drainThreadState) {
+		omrthread_monitor_enter(_drainMonitor);
+		while (DRAIN_THREAD_TERMINATED != _drainThreadState) {
+			_drainThreadState = DRAIN_THREAD_TERMINATION_REQUESTED;
+			omrthread_monitor_notify_all(_drainMonitor);
+			omrthread_monitor_wait(_drainMonitor);
+		}
+		omrthread_monitor_exit(_drainMonitor);
+	}
+}
+
+int J9THREAD_PROC
+MM_VerboseWriterFileLoggingBinary::drainThreadProc(void *info)
+{
+	MM_VerboseWriterFileLoggingBinary *writer = (MM_VerboseWriterFileLoggingBinary *)info;
+	writer->drainThreadEntryPoint();
+	return 0;
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::drainThreadEntryPoint()
+{
+	/* the drainer runs no Java code and touches no heap, so it does not attach to the VM */
+	MM_EnvironmentBase env(_omrVM);
+
+	omrthread_monitor_enter(_drainMonitor);
+	_drainThreadState = DRAIN_THREAD_RUNNING;
+	omrthread_monitor_notify_all(_drainMonitor);
+	while (DRAIN_THREAD_TERMINATION_REQUESTED != _drainThreadState) {
+		if (!_drainRequested) {
+			omrthread_monitor_wait_timed(_drainMonitor, OMR_VERBOSE_BINARY_DRAIN_INTERVAL_MILLIS, 0);
+		}
+		_drainRequested = false;
+		omrthread_monitor_exit(_drainMonitor);
+
+		omrthread_monitor_enter(_fileMutex);
+		drainRecords(&env, false);
+		writeOutputBuffer(&env);
+		omrthread_monitor_exit(_fileMutex);
+
+		omrthread_monitor_enter(_drainMonitor);
+	}
+	_drainThreadState = DRAIN_THREAD_TERMINATED;
+	omrthread_monitor_notify_all(_drainMonitor);
+	omrthread_exit(_drainMonitor);
+}
@@ -0,0 +1,191 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGBINARY_HPP_)
+#define VERBOSEWRITERFILELOGGINGBINARY_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "VerboseWriterFileLogging.hpp"
+
+/* Threads with a buffer of their own; any further threads share one more */
+#define OMR_VERBOSE_BINARY_THREAD_BUFFERS 16
+/* Capacity of each thread buffer, a power of two */
+#define OMR_VERBOSE_BINARY_THREAD_BUFFER_SIZE (64 * 1024)
+/* Longer output is queued in chunks of this size, so that any record fits in a thread buffer */
+#define OMR_VERBOSE_BINARY_CHUNK_SIZE (8 * 1024)
+/* Encoded records are collected in a buffer of this size before being written */
+#define OMR_VERBOSE_BINARY_OUTPUT_BUFFER_SIZE (64 * 1024)
+/* Longest time queued output waits for the drain thread */
+#define OMR_VERBOSE_BINARY_DRAIN_INTERVAL_MILLIS 100
+
+/**
+ * Output agent which directs verbosegc output to file in the compact binary format of MM_VerboseBinaryFormat.
+ *
+ * Reporting threads only copy their text into a buffer of their own and return. A drain thread takes
+ * the queued text in the order it was output, encodes it and writes it to file, so neither the
+ * encoding nor the I/O is done in the reporting thread. Use MM_VerboseBinaryFormat::convertToXML
+ * to turn a log back into XML.
+ */
+class MM_VerboseWriterFileLoggingBinary : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	enum DrainThreadState {
+		DRAIN_THREAD_NOT_STARTED = 0,
+		DRAIN_THREAD_STARTING,
+		DRAIN_THREAD_RUNNING,
+		DRAIN_THREAD_TERMINATION_REQUESTED,
+		DRAIN_THREAD_TERMINATED,
+		DRAIN_THREAD_ERROR
+	};
+
+	enum QueuedRecordType {
+		QUEUED_TEXT = 0, /**< verbose output */
+		QUEUED_OPEN, /**< open the file whose uintptr_t number is the text */
+		QUEUED_CLOSE, /**< write the footer and close the file */
+		QUEUED_PAD /**< unused space up to the end of the buffer */
+	};
+
+	/**
+	 * Header of each entry in a thread buffer, followed by its text.
+	 */
+	struct QueuedRecord {
+		uintptr_t sequence; /**< position of the record in the output, for records other than QUEUED_PAD */
+		uint32_t type; /**< a QueuedRecordType */
+		uint32_t length; /**< number of bytes of text following the header */
+	};
+
+	/**
+	 * Single producer, single consumer byte ring owned by one reporting thread and emptied by the drainer.
+	 */
+	struct ThreadBuffer {
+		omrthread_t volatile owner; /**< the thread the buffer was claimed by, NULL while unclaimed */
+		uint8_t *data; /**< OMR_VERBOSE_BINARY_THREAD_BUFFER_SIZE bytes, allocated when the buffer is claimed */
+		volatile uintptr_t tail; /**< total bytes queued, only written by the owner */
+		volatile uintptr_t head; /**< total bytes drained, only written by the drainer */
+	};
+
+	OMR_VM *_omrVM; /**< the VM, for the drain thread's environment */
+	ThreadBuffer _threadBuffers[OMR_VERBOSE_BINARY_THREAD_BUFFERS + 1]; /**< the last buffer is shared by threads that could not claim one */
+	volatile uintptr_t _sharedBufferLock; /**< spin lock serializing the threads using the shared buffer */
+	volatile uintptr_t _nextSequence; /**< sequence number of the next record queued */
+	uintptr_t _drainSequence; /**< sequence number of the next record to be written */
+	uintptr_t _lastDrainedBuffer; /**< index of the thread buffer most recently drained, the likeliest to hold the next record */
+
+	omrthread_monitor_t _drainMonitor; /**< drain thread state and wake ups */
+	volatile DrainThreadState _drainThreadState;
+	volatile bool _drainRequested; /**< set to have the drain thread start a pass without waiting for the interval */
+	uintptr_t _producersWaiting; /**< threads waiting for space in their buffer, notified after each drain pass */
+
+	omrthread_monitor_t _fileMutex; /**< held while draining and while opening or closing the file */
+	intptr_t _logFileDescriptor; /**< the file being written to, -1 if none */
+	uint8_t *_outputBuffer; /**< encoded records waiting to be written */
+	uintptr_t _outputBufferUsed; /**< bytes of _outputBuffer in use */
+	uint64_t _drainedBytes; /**< total bytes of text drained */
+	uint64_t _writtenBytes; /**< total bytes of records written */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingBinary *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+	virtual void closeStream(MM_EnvironmentBase *env);
+
+	/**
+	 * Write out everything queued so far, waiting for any record that is being queued by another thread.
+	 */
+	void flush(MM_EnvironmentBase *env);
+
+	/**
+	 * @return the total number of bytes of text drained so far
+	 */
+	MMINLINE uint64_t getDrainedBytes() { return _drainedBytes; }
+
+	/**
+	 * @return the total number of bytes written to file so far
+	 */
+	MMINLINE uint64_t getWrittenBytes() { return _writtenBytes; }
+
+protected:
+	MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env, bool printInitializedHeader = false);
+	void closeFile(MM_EnvironmentBase *env);
+
+	/**
+	 * Queue a record in the calling thread's buffer, waiting for the drain thread if the buffer is full.
+	 */
+	void enqueue(MM_EnvironmentBase *env, QueuedRecordType type, const char *text, uintptr_t length);
+
+	/**
+	 * Find or claim the buffer of the calling thread.
+	 * @return the buffer, or the shared buffer (with the shared buffer lock held) if none could be claimed
+	 */
+	ThreadBuffer *acquireThreadBuffer(MM_EnvironmentBase *env);
+	void releaseThreadBuffer(ThreadBuffer *buffer);
+
+	/**
+	 * Block until the drain thread has made room in a buffer.
+	 */
+	void waitForDrain();
+	void wakeDrainThread();
+
+	/**
+	 * Write every queued record that is next in sequence. Caller must hold _fileMutex.
+	 * @param waitForAll wait for records other threads have started to queue, rather than leaving them for the next pass
+	 */
+	void drainRecords(MM_EnvironmentBase *env, bool waitForAll);
+	void processRecord(MM_EnvironmentBase *env, QueuedRecord *record);
+
+	void outputText(MM_EnvironmentBase *env, const char *text, uintptr_t length);
+	void writeOutputBuffer(MM_EnvironmentBase *env);
+
+	/**
+	 * Open the numbered file and write the headers. Caller must hold _fileMutex.
+	 */
+	bool openLogFile(MM_EnvironmentBase *env, uintptr_t fileNumber);
+	/**
+	 * Write the footer and close the file. Caller must hold _fileMutex.
+	 */
+	void closeLogFile(MM_EnvironmentBase *env);
+
+	bool startDrainThread(MM_EnvironmentBase *env);
+	void stopDrainThread(MM_EnvironmentBase *env);
+	static int J9THREAD_PROC drainThreadProc(void *info);
+	void drainThreadEntryPoint();
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGBINARY_HPP_ */
@@ -0,0 +1,318 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrport.h"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Math.hpp"
+#include "VerboseBuffer.hpp"
+#include "VerboseHandlerOutput.hpp"
+#include "VerboseManager.hpp"
+#include "VerboseWriterFileLoggingMapped.hpp"
+
+#include <string.h>
+
+/* Value of _reserved while there is no mapping to write to, too large for any output to fit */
+#define MAPPING_CLOSED (((uintptr_t)-1) >> 1)
+
+MM_VerboseWriterFileLoggingMapped::MM_VerboseWriterFileLoggingMapped(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_MAPPED)
+	,_fileSize(0)
+	,_mappingMutex(NULL)
+	,_logFileDescriptor(-1)
+	,_mapping(NULL)
+	,_base(NULL)
+	,_limit(0)
+	,_reserved(MAPPING_CLOSED)
+	,_committed(0)
+	,_fileFull(false)
+	,_remapCount(0)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingMapped instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingMapped.
+ */
+MM_VerboseWriterFileLoggingMapped *
+MM_VerboseWriterFileLoggingMapped::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingMapped *agent = (MM_VerboseWriterFileLoggingMapped *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingMapped), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingMapped(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+bool
+MM_VerboseWriterFileLoggingMapped::isSupported(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	return OMRPORT_MMAP_CAPABILITY_WRITE == (omrmmap_capabilities() & OMRPORT_MMAP_CAPABILITY_WRITE);
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingMapped instance.
+ * Also called on reconfiguration, when the mutex already exists.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingMapped::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (NULL == _mappingMutex) {
+		if (0 != omrthread_monitor_init_with_name(&_mappingMutex, 0, "MM_VerboseWriterFileLoggingMapped::_mappingMutex")) {
+			_mappingMutex = NULL;
+			return false;
+		}
+	}
+	_fileSize = OMR_MAX(extensions->mappedLogFileSize, (uintptr_t)OMR_VERBOSE_MAPPED_MINIMUM_FILE_SIZE);
+
+	return MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingMapped.
+ * Closes the file if it is still mapped.
+ */
+void
+MM_VerboseWriterFileLoggingMapped::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _mappingMutex) {
+		closeFile(env);
+		omrthread_monitor_destroy(_mappingMutex);
+		_mappingMutex = NULL;
+	}
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+/**
+ * Opens and maps the file to log output to and copies in the header.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingMapped::openFile(MM_EnvironmentBase *env, bool printInitializedHeader)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	omrthread_monitor_enter(_mappingMutex);
+	/* the file is read as well as written through the mapping */
+	_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == _logFileDescriptor) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	}
+	if ((-1 != _logFileDescriptor) && !mapFile(env, 0, _fileSize)) {
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+	}
+	if (-1 == _logFileDescriptor) {
+		omrthread_monitor_exit(_mappingMutex);
+		_manager->handleFileOpenError(env, filenameToOpen);
+		extensions->getForge()->free(filenameToOpen);
+		return false;
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	const char *header = getHeader(env);
+	uintptr_t headerLength = strlen(header);
+	memcpy(_base, header, headerLength);
+	_fileFull = false;
+	_committed = headerLength;
+	/* the mapping must be visible before writers can reserve space in it */
+	MM_AtomicOperations::storeSync();
+	_reserved = headerLength;
+	omrthread_monitor_exit(_mappingMutex);
+
+	/* Print an Initialized Stanza in new file */
+	if (printInitializedHeader) {
+		MM_VerboseBuffer* buffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+		if (NULL != buffer) {
+			_manager->getVerboseHandlerOutput()->outputInitializedStanza(env, buffer);
+			outputString(env, buffer->contents());
+			buffer->kill(env);
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Prints the footer and closes the file being logged to.
+ */
+void
+MM_VerboseWriterFileLoggingMapped::closeFile(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_mappingMutex);
+	uintptr_t used = retireMapping();
+	if (MAPPING_CLOSED != used) {
+		closeLogFile(env, used);
+	}
+	_fileFull = false;
+	omrthread_monitor_exit(_mappingMutex);
+}
+
+void
+MM_VerboseWriterFileLoggingMapped::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	uintptr_t length = strlen(string);
+
+	while (true) {
+		uintptr_t offset = _reserved;
+		if ((offset + length) <= _limit) {
+			if (offset == MM_AtomicOperations::lockCompareExchange(&_reserved, offset, offset + length)) {
+				/* the mapping cannot change until everything reserved in it has been committed */
+				memcpy(_base + offset, string, length);
+				MM_AtomicOperations::add(&_committed, length);
+				return;
+			}
+		} else if (!makeRoom(env, length)) {
+			OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+			omrfile_write_text(OMRPORT_TTY_ERR, string, length);
+			return;
+		}
+	}
+}
+
+bool
+MM_VerboseWriterFileLoggingMapped::makeRoom(MM_EnvironmentBase *env, uintptr_t length)
+{
+	bool retry = true;
+
+	omrthread_monitor_enter(_mappingMutex);
+	uintptr_t used = _reserved;
+	if (MAPPING_CLOSED == used) {
+		/**
+		 * Under normal circumstances, new file should be opened during endOfCycle call.
+		 * This path works as one backup, in case we failed to open the file, we'll attempt to open it again before outputting the string.
+		 */
+		retry = !_fileFull && openFile(env);
+	} else if ((used + length) > _limit) {
+		/* no other thread made room since this one found the mapping full */
+		used = retireMapping();
+		if (mapFile(env, used, _mapping->size + OMR_MAX(_fileSize, length))) {
+			_remapCount += 1;
+			_committed = used;
+			MM_AtomicOperations::storeSync();
+			_reserved = used;
+		} else {
+			/* keep what was written rather than reopening (and truncating) the file */
+			closeLogFile(env, used);
+			_fileFull = true;
+			retry = false;
+		}
+	}
+	omrthread_monitor_exit(_mappingMutex);
+
+	return retry;
+}
+
+uintptr_t
+MM_VerboseWriterFileLoggingMapped::retireMapping()
+{
+	uintptr_t used = _reserved;
+	while (MAPPING_CLOSED != used) {
+		uintptr_t found = MM_AtomicOperations::lockCompareExchange(&_reserved, used, MAPPING_CLOSED);
+		if (found == used) {
+			/* wait for the writers still copying into the space they reserved */
+			while (used != _committed) {
+				omrthread_yield();
+			}
+			break;
+		}
+		used = found;
+	}
+	return used;
+}
+
+bool
+MM_VerboseWriterFileLoggingMapped::mapFile(MM_EnvironmentBase *env, uintptr_t used, uintptr_t size)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (0 != omrfile_set_length(_logFileDescriptor, (int64_t)size)) {
+		return false;
+	}
+	J9MmapHandle *mapping = omrmmap_map_file(_logFileDescriptor, 0, size, NULL, OMRPORT_MMAP_FLAG_WRITE, OMRMEM_CATEGORY_MM);
+	if (NULL == mapping) {
+		return false;
+	}
+	if (NULL != _mapping) {
+		omrmmap_unmap_file(_mapping);
+	}
+	_mapping = mapping;
+	_base = (char *)mapping->pointer;
+	/* leave room for the footer and the newline after it */
+	_limit = size - (strlen(getFooter(env)) + 1);
+
+	return true;
+}
+
+void
+MM_VerboseWriterFileLoggingMapped::closeLogFile(MM_EnvironmentBase *env, uintptr_t used)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	const char *footer = getFooter(env);
+	uintptr_t footerLength = strlen(footer);
+	memcpy(_base + used, footer, footerLength);
+	used += footerLength;
+	_base[used] = '\n';
+	used += 1;
+
+	omrmmap_unmap_file(_mapping);
+	_mapping = NULL;
+	_base = NULL;
+	_limit = 0;
+	/* drop the unused end of the mapping so that the log is a well formed XML document */
+	omrfile_set_length(_logFileDescriptor, (int64_t)used);
+	omrfile_close(_logFileDescriptor);
+	_logFileDescriptor = -1;
+}
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGMAPPED_HPP_)
+#define VERBOSEWRITERFILELOGGINGMAPPED_HPP_
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#include "VerboseWriterFileLogging.hpp"
+
+/* Smallest size a log file is mapped at */
+#define OMR_VERBOSE_MAPPED_MINIMUM_FILE_SIZE (4 * 1024)
+
+/**
+ * Output agent which directs verbosegc output to memory mapped files.
+ *
+ * Each file of the ring (one file unless rotating files are requested) is extended to a fixed size
+ * and mapped when it is opened. Output is copied into the mapping after atomically reserving space
+ * for it, leaving the write back to the operating system, so reporting threads never block in write().
+ * A file which fills up is extended and mapped again. When a file is closed the footer is added and
+ * the file is truncated to what was written, so closed logs are ordinary XML files.
+ */
+class MM_VerboseWriterFileLoggingMapped : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	uintptr_t _fileSize; /**< size each file is mapped at initially, and grown by */
+	omrthread_monitor_t _mappingMutex; /**< serializes opening, growing and closing the mapping */
+	intptr_t _logFileDescriptor; /**< the file being mapped, -1 if none */
+	J9MmapHandle *_mapping; /**< the mapping of the file, NULL if none */
+	char *_base; /**< start of the mapping */
+	uintptr_t _limit; /**< bytes of the mapping available for output, leaving room for the footer */
+	volatile uintptr_t _reserved; /**< bytes of the mapping reserved by writers, or MAPPING_CLOSED */
+	volatile uintptr_t _committed; /**< bytes of the mapping copied in by writers */
+	bool _fileFull; /**< the file could not be grown, output is sent to stderr until the next file is opened */
+	uintptr_t _remapCount; /**< number of times a full file was grown and mapped again */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingMapped *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	/**
+	 * @return true if the platform supports writable file mappings
+	 */
+	static bool isSupported(MM_EnvironmentBase *env);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+
+	/**
+	 * @return the number of times a full file was grown and mapped again
+	 */
+	MMINLINE uintptr_t getRemapCount() { return _remapCount; }
+
+protected:
+	MM_VerboseWriterFileLoggingMapped(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env, bool printInitializedHeader = false);
+	void closeFile(MM_EnvironmentBase *env);
+
+	/**
+	 * Open a mapping when there is none, or grow the mapping when the output does not fit.
+	 * @param length[in] the number of bytes which did not fit
+	 * @return true if the output should be retried, false if it must go to stderr
+	 */
+	bool makeRoom(MM_EnvironmentBase *env, uintptr_t length);
+
+	/**
+	 * Stop writers reserving space in the mapping and wait for the writers which already did.
+	 * Caller must hold _mappingMutex.
+	 * @return the number of bytes written to the mapping, or MAPPING_CLOSED if it was already closed
+	 */
+	uintptr_t retireMapping();
+
+	/**
+	 * Extend the file and map it at a new size, keeping what was written. Caller must hold _mappingMutex.
+	 * @param used[in] the number of bytes written to the mapping
+	 * @param size[in] the new size of the mapping
+	 * @return true on success, false if the old mapping was kept
+	 */
+	bool mapFile(MM_EnvironmentBase *env, uintptr_t used, uintptr_t size);
+
+	/**
+	 * Add the footer, unmap the file and truncate it to what was written. Caller must hold _mappingMutex.
+	 * @param used[in] the number of bytes written to the mapping
+	 */
+	void closeLogFile(MM_EnvironmentBase *env, uintptr_t used);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGMAPPED_HPP_ */
@@ -30,6 +30,7 @@
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "ParallelDispatcher.hpp"
 #include "VerboseHandlerOutputStandard.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
@@ -298,6 +299,13 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
 			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
 
+	MM_WorkPacketStats *workPacketStats = &extensions->globalGCStats.workPacketStats;
+	if (workPacketStats->getSTWWorkStackOverflowOccured()) {
+		writer->formatAndOutput(env, 1, "<overflow-info overflowcount=\"%zu\" spilledcount=\"%zu\" rescancount=\"%zu\" heaprescans=\"%zu\" />",
+				workPacketStats->getSTWWorkStackOverflowCount(), workPacketStats->getSTWOverflowSpillCount(),
+				workPacketStats->getSTWOverflowMarkCount(), workPacketStats->getSTWOverflowHeapRescanCount());
+	}
+
 	handleMarkEndInternal(env, eventData);
 
 	handleGCOPOuterStanzaEnd(env);
@@ -321,10 +329,36 @@ MM_VerboseHandlerOutputStandard::handleSweepEnd(J9HookInterface** hook, uintptr_
 	uint64_t duration = 0;
 	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, sweepStats->_startTime, sweepStats->_endTime);
 
+	/* the background sweep counts of the previous GC are reported along with the regions left by this one */
+	bool backgroundSweep = (0 != sweepStats->_backgroundSweepRegions)
+			|| (0 != sweepStats->_backgroundSweptRegions)
+			|| (0 != sweepStats->_mutatorSweptRegions)
+			|| (0 != sweepStats->_unsweptRegions);
+
 	enterAtomicReportingBlock();
-	handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+	if ((0 == sweepStats->_deferredBytes) && !backgroundSweep) {
+		handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
 
-	handleSweepEndInternal(env, eventData);
+		handleSweepEndInternal(env, eventData);
+	} else {
+		/* part of the heap is left to be swept on allocation or in the background */
+		MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+		handleGCOPOuterStanzaStart(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+
+		if (0 != sweepStats->_deferredBytes) {
+			writer->formatAndOutput(env, 1, "<sweep-info deferredbytes=\"%zu\" />", sweepStats->_deferredBytes);
+		}
+		if (backgroundSweep) {
+			writer->formatAndOutput(env, 1, "<background-sweep-info sweptregions=\"%zu\" mutatorregions=\"%zu\" unsweptregions=\"%zu\" lagms=\"%llu.%03llu\" queuedregions=\"%zu\" />",
+					sweepStats->_backgroundSweptRegions, sweepStats->_mutatorSweptRegions, sweepStats->_unsweptRegions,
+					sweepStats->_sweepLagTime / 1000, sweepStats->_sweepLagTime % 1000, sweepStats->_backgroundSweepRegions);
+		}
+
+		handleSweepEndInternal(env, eventData);
+
+		handleGCOPOuterStanzaEnd(env);
+		writer->flush(env);
+	}
 	exitAtomicReportingBlock();
 }
 
@@ -363,6 +397,7 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	MM_VerboseManager* manager = getManager();
 	MM_VerboseWriterChain* writer = manager->getWriterChain();
 	MM_CompactStats *compactStats = &MM_GCExtensionsBase::getExtensions(env->getOmrVM())->globalGCStats.compactStats;
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 	uint64_t duration = 0;
 	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, compactStats->_startTime, compactStats->_endTime);
 
@@ -372,6 +407,14 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	if(COMPACT_PREVENTED_NONE == compactStats->_compactPreventedReason) {
 		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
 				compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+		uint64_t setupMicros = omrtime_hires_delta(compactStats->_setupStartTime, compactStats->_setupEndTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		uint64_t summaryMicros = omrtime_hires_delta(compactStats->_summaryStartTime, compactStats->_summaryEndTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		uint64_t moveMicros = omrtime_hires_delta(compactStats->_moveStartTime, compactStats->_moveEndTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		uint64_t fixupMicros = omrtime_hires_delta(compactStats->_fixupStartTime, compactStats->_fixupEndTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		uint64_t rootFixupMicros = omrtime_hires_delta(compactStats->_rootFixupStartTime, compactStats->_rootFixupEndTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		writer->formatAndOutput(env, 1, "<compact-passes setupms=\"%llu.%03llu\" summaryms=\"%llu.%03llu\" movems=\"%llu.%03llu\" fixupms=\"%llu.%03llu\" rootfixupms=\"%llu.%03llu\" />",
+				setupMicros / 1000, setupMicros % 1000, summaryMicros / 1000, summaryMicros % 1000, moveMicros / 1000, moveMicros % 1000,
+				fixupMicros / 1000, fixupMicros % 1000, rootFixupMicros / 1000, rootFixupMicros % 1000);
 	} else {
 		writer->formatAndOutput(env, 1, "<compact-info reason=\"%s\" />", getCompactionReasonAsString(compactStats->_compactReason));
 		writer->formatAndOutput(env, 1, "<warning details=\"compaction prevented due to %s\" />", getCompactionPreventedReasonAsString(compactStats->_compactPreventedReason));
@@ -412,6 +455,37 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 	if (event->cycleEnd) {
 		writer->formatAndOutput(env, 1, "<scavenger-info tenureage=\"%zu\" tenuremask=\"%4zx\" tiltratio=\"%zu\" />",
 				cycleScavengerStats->_tenureAge, cycleScavengerStats->getFlipHistory(0)->_tenureMask, cycleScavengerStats->_tiltRatio);
+		if (extensions->scavengerAdaptiveCacheSize) {
+			uint64_t cacheCount = 0;
+			for (uintptr_t i = 0; i < OMR_SCAVENGER_CACHESIZE_BINS; i++) {
+				cacheCount += cycleScavengerStats->_copy_cachesize_counts[i];
+			}
+			uint64_t averageCacheSize = (0 == cacheCount) ? 0 : (cycleScavengerStats->_copy_cachesize_sum / cacheCount);
+			writer->formatAndOutput(env, 1, "<copy-cache-size target=\"%zu\" average=\"%llu\" stallpercent=\"%zu\" previousstallpercent=\"%zu\" />",
+					cycleScavengerStats->_copyScanCacheSizeTarget, averageCacheSize, cycleScavengerStats->_scanStallPercent, cycleScavengerStats->_previousScanStallPercent);
+		}
+		if (0 != extensions->scavengerPauseTarget) {
+			writer->formatAndOutput(env, 1, "<thread-selection pausetargetms=\"%zu\" expectedbytes=\"%zu\" threads=\"%zu\" activethreads=\"%zu\" observedbytes=\"%zu\" efficiency=\"%zu\" />",
+					extensions->scavengerPauseTarget, cycleScavengerStats->_pauseTargetExpectedBytes, cycleScavengerStats->_pauseTargetThreads,
+					extensions->dispatcher->activeThreadCount(), cycleScavengerStats->_flipBytes + cycleScavengerStats->_tenureAggregateBytes,
+					100 - cycleScavengerStats->_scanStallPercent);
+		}
+		if (0.0 != extensions->scvTenureAdaptiveSurvivorOccupancy) {
+			writer->formatAndOutput(env, 1, "<survivor-ages>");
+			for (uintptr_t age = 1; age <= OBJECT_HEADER_AGE_MAX; age++) {
+				uint64_t *sizeCounts = cycleScavengerStats->_ageSizeHistogram[age];
+				uint64_t objectCount = 0;
+				for (uintptr_t i = 0; i < OMR_SCAVENGER_AGE_SIZE_BINS; i++) {
+					objectCount += sizeCounts[i];
+				}
+				if (0 != objectCount) {
+					writer->formatAndOutput(env, 2, "<survivor-age age=\"%zu\" objects=\"%llu\" bytes=\"%zu\" bysize=\"%llu %llu %llu %llu %llu %llu %llu %llu\" />",
+							age, objectCount, cycleScavengerStats->getFlipHistory(0)->_flipBytes[age],
+							sizeCounts[0], sizeCounts[1], sizeCounts[2], sizeCounts[3], sizeCounts[4], sizeCounts[5], sizeCounts[6], sizeCounts[7]);
+				}
+			}
+			writer->formatAndOutput(env, 1, "</survivor-ages>");
+		}
 	}
 
 	if (0 != scavengerStats->_flipCount) {
@@ -430,6 +504,27 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	if (0 != scavengerStats->_scanCacheStealAttemptCount) {
+		writer->formatAndOutput(env, 1, "<scan-cache-steal attempts=\"%zu\" steals=\"%zu\" failed=\"%zu\" />",
+				scavengerStats->_scanCacheStealAttemptCount, scavengerStats->_scanCacheStealCount, scavengerStats->_scanCacheStealFailCount);
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	if (0 != scavengerStats->_rememberedSetEntryCount) {
+		uint64_t scanMicros = omrtime_hires_delta(0, scavengerStats->_rememberedSetScanTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		uint64_t pruneMicros = omrtime_hires_delta(0, scavengerStats->_rememberedSetPruneTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		writer->formatAndOutput(env, 1, "<remembered-set-scan entries=\"%zu\" chunks=\"%zu\" scantimems=\"%llu.%03llu\" prunetimems=\"%llu.%03llu\" />",
+				scavengerStats->_rememberedSetEntryCount, scavengerStats->_rememberedSetChunkCount,
+				scanMicros / 1000, scanMicros % 1000, pruneMicros / 1000, pruneMicros % 1000);
+	}
+	if (extensions->scavengerNumaAwareCopy) {
+		for (uintptr_t i = 0; i < OMR_SCAVENGER_NUMA_NODE_BINS; i++) {
+			if ((0 != scavengerStats->_numaPreferredCopyCount[i]) || (0 != scavengerStats->_numaOtherCopyCount[i])) {
+				writer->formatAndOutput(env, 1, "<numa-copy node=\"%zu\" preferred=\"%llu\" other=\"%llu\" />",
+						i + 1, scavengerStats->_numaPreferredCopyCount[i], scavengerStats->_numaOtherCopyCount[i]);
+			}
+		}
+	}
 
 	handleScavengeEndInternal(env, eventData);
 	
@@ -674,6 +769,12 @@ MM_VerboseHandlerOutputStandard::handleConcurrentKickoff(J9HookInterface** hook,
 				env, 1, "<kickoff reason=\"%s\" targetBytes=\"%zu\" thresholdFreeBytes=\"%zu\" remainingFree=\"%zu\" tenureFreeBytes=\"%zu\" />",
 				reasonString, event->traceTarget, event->kickOffThreshold, event->remainingFree, event->commonData->tenureFreeBytes);
 	}
+	if (extensions->concurrentKickoffForecast) {
+		writer->formatAndOutput(
+				env, 1, "<kickoff-forecast allocationRateBytesPerMs=\"%zu\" burst=\"%s\" predictedms=\"%llu.%03llu\" predictedFreeBytes=\"%zu\" />",
+				event->forecastAllocationRate, event->forecastAllocationBurst ? "true" : "false",
+				event->predictedConcurrentTime / 1000, event->predictedConcurrentTime % 1000, event->predictedFreeAtCompletion);
+	}
 	writer->formatAndOutput(env, 0, "</concurrent-kickoff>");
 	writer->flush(env);
 
@@ -785,6 +886,12 @@ MM_VerboseHandlerOutputStandard::handleConcurrentCollectionStart(J9HookInterface
 		tagTemplate, deltaTime / 1000, deltaTime % 1000);
 	writer->formatAndOutput(env, 1, "<concurrent-trace-info reason=\"%s\" tracedByMutators=\"%zu\" tracedByHelpers=\"%zu\" cardsCleaned=\"%zu\" workStackOverflowCount=\"%zu\" />",
 		cardCleaningReasonString, event->tracedByMutators, event->tracedByHelpers, event->cardsCleaned, event->workStackOverflowCount);
+	if (_extensions->concurrentKickoffForecast) {
+		writer->formatAndOutput(env, 1, "<kickoff-forecast predictedms=\"%llu.%03llu\" actualms=\"%llu.%03llu\" predictedFreeBytes=\"%zu\" actualFreeBytes=\"%zu\" />",
+			event->predictedConcurrentTime / 1000, event->predictedConcurrentTime % 1000,
+			event->actualConcurrentTime / 1000, event->actualConcurrentTime % 1000,
+			event->predictedFreeAtCompletion, event->actualFreeAtCompletion);
+	}
   	writer->formatAndOutput(env, 0, "</concurrent-global-final>");
 
 	writer->flush(env);
@@ -506,6 +506,7 @@ typedef enum {
 #define OMR_SCV_TENURE_RATIO_HIGH 30
 #define OMR_SCV_REMSET_FRAGMENT_SIZE 32
 #define OMR_SCV_REMSET_SIZE 16384
+#define OMR_SCAVENGER_SLOT_BATCH_MAX 32
 
 #define J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK 20
 
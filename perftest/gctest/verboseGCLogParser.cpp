@@ -33,17 +33,24 @@
 #include "omrport.h"
 #include "omrthread.h"
 
+#include "VerboseBinaryFormat.hpp"
+
 const char* XPATH_GET_ALL_MARK_TIME = "/verbosegc/gc-op[@type='mark']";
 const char* XPATH_GET_ALL_SWEEP_TIME = "/verbosegc/gc-op[@type='sweep']";
 const char* XPATH_GET_ALL_EXPAND_TIME = "/verbosegc/heap-resize[@type='expand']";
 const char* XPATH_GET_TOTAL_GC_TIME = "/verbosegc/gc-end[@type='global']";
+const char* XPATH_GET_ALL_SCAVENGE = "/verbosegc/gc-op[@type='scavenge']";
 const char* SRC_DIR = "./";
 const char* VERBOSE_GC_FILE_PREFIX = "VerboseGC";
 
 double getAvg(std::vector<double> v);
 void analyze(char* fileName, OMRPortLibrary portLibrary);
 
-int main(void)
+/**
+ * Analyze the verbose GC logs in the current directory, text or binary.
+ * Given a binary log and an output file name, convert the log to XML instead.
+ */
+int main(int argc, char **argv)
 {
 	int32_t totalFiles = 0;
 	intptr_t rc = 0;
@@ -66,6 +73,16 @@ int main(void)
 
 	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
 
+	if (3 == argc) {
+		if (!MM_VerboseBinaryFormat::convertToXML(&portLibrary, argv[1], argv[2])) {
+			omrtty_printf("Failed to convert binary verbose GC file %s to %s\n", argv[1], argv[2]);
+			rc = -1;
+		}
+		portLibrary.port_shutdown_library(&portLibrary);
+		omrthread_detach(NULL);
+		return (int)rc;
+	}
+
 	rcFile = handle = omrfile_findfirst(SRC_DIR, resultBuffer);
 
 	if(rcFile == (uintptr_t)-1) {
@@ -114,6 +131,7 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	pugi::xpath_node_set sweepTimes;
 	pugi::xpath_node_set expandTimes;
 	pugi::xpath_node_set gcTimes;
+	pugi::xpath_node_set scavenges;
 
 	double maxMark = 0;
 	double minMark = 0;
@@ -131,10 +149,21 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	double minGCDuration = 0;
 	double avgGCDuration = 0;
 
+	double totalScavengeTime = 0;
+	uint64_t totalScavengeCopied = 0;
+
 	pugi::xml_document doc;
-	pugi::xml_parse_result result = doc.load_file(fileName);
+	pugi::xml_parse_result result;
 
 	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+	uintptr_t length = 0;
+	char *text = MM_VerboseBinaryFormat::readAsXML(&portLibrary, fileName, &length);
+	if (NULL != text) {
+		result = doc.load_buffer(text, length);
+		omrmem_free_memory(text);
+	} else {
+		result = doc.load_file(fileName);
+	}
 	if(!result) {
 		omrtty_printf("Error loading file : %s\n", fileName);
 		return;
@@ -170,6 +199,15 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	    gcduration_values.push_back(value);
 	}
 
+	scavenges = doc.select_nodes(XPATH_GET_ALL_SCAVENGE);
+	for (pugi::xpath_node_set::const_iterator it = scavenges.begin(); it != scavenges.end(); ++it) {
+	    pugi::xml_node node = it->node();
+	    totalScavengeTime += node.attribute("timems").as_double();
+	    for (pugi::xml_node copied = node.child("memory-copied"); copied; copied = copied.next_sibling("memory-copied")) {
+	        totalScavengeCopied += (uint64_t)copied.attribute("objects").as_double();
+	    }
+	}
+
 	if (!mark_values.empty()) {
 		maxMark = *std::max_element(mark_values.begin(), mark_values.end());
 		minMark = *std::min_element(mark_values.begin(), mark_values.end());
@@ -204,4 +242,10 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 
 	omrtty_printf("Average : %f        %f        %f        %f\n\n",
 								avgMark, avgSweep, avgExpand, avgGCDuration);
+
+	if (!scavenges.empty()) {
+		double copiedPerSecond = (totalScavengeTime > 0) ? ((double)totalScavengeCopied * 1000 / totalScavengeTime) : 0;
+		omrtty_printf("Scavenge: %zu collections, %llu objects copied in %f ms (%f objects/sec)\n\n",
+								(size_t)scavenges.size(), (unsigned long long)totalScavengeCopied, totalScavengeTime, copiedPerSecond);
+	}
 }
@@ -686,7 +686,17 @@ omrvmem_decommit_memory(struct OMRPortLibrary *portLibrary, void *address, uintp
 
 			if (byteAmount > 0) {
 				if (identifier->allocator == OMRPORT_VMEM_RESERVE_USED_MMAP) {
-					result = (intptr_t)madvise((void *)address, (size_t) byteAmount, MADV_DONTNEED);
+#if defined(MADV_FREE)
+					/* Lazily freed pages are only reclaimed under memory pressure, and may keep their contents
+					 * if they are used again first. Kernels without MADV_FREE fail the call. */
+					if (OMR_ARE_ANY_BITS_SET(identifier->mode, OMRPORT_VMEM_MEMORY_MODE_LAZY_DECOMMIT)) {
+						result = (intptr_t)madvise((void *)address, (size_t) byteAmount, MADV_FREE);
+					}
+					if (0 != result)
+#endif /* defined(MADV_FREE) */
+					{
+						result = (intptr_t)madvise((void *)address, (size_t) byteAmount, MADV_DONTNEED);
+					}
 				} else if (identifier->allocator == OMRPORT_VMEM_RESERVE_USED_MMAP_SHM) {
 					/* If heap is created using shared memory with mmap, we must set advice to MADV_REMOVE, because
 					* pages might not be immediately freed in a successful madvise used with MADV_DONTNEED in